@@ -45,13 +45,20 @@ int main(void)
 
     // Create the GUI
     GuiContainer gui = InitGuiContainer();
-    GuiElement* newGame = AddGuiButton(gui, (Rectangle){ 20, 20, 250, 60 }, "New Game");
-    GuiElement* loadGame = AddGuiButton(gui, (Rectangle){ 20, 90, 250, 60 }, "Load Game");
-    GuiElement* exit = AddGuiButton(gui, (Rectangle){ 20, 160, 250, 60 }, "Exit");
-    GuiElement* options = AddGuiButton(gui, (Rectangle){ 280, 90, 250, 60 }, "Options");
-    GuiElement* highscores = AddGuiButton(gui, (Rectangle){ 540, 90, 250, 60 }, "Highscores");
-    GuiElement* showFPS = AddCheckBox(gui, (Rectangle){ 20, 360, 60, 60 }, "Show FPS", false);
-    GuiElement* slider = AddSlider(gui, (Rectangle){ screenWidth - 300, 200, 150, 30 }, "Less", "More", 30, 0, 100);
+    GuiElement newGame = AddGuiButton(&gui, (Rectangle){ 20, 20, 250, 60 }, "New Game");
+    GuiElement loadGame = AddGuiButton(&gui, (Rectangle){ 20, 90, 250, 60 }, "Load Game");
+    GuiElement exit = AddGuiButton(&gui, (Rectangle){ 20, 160, 250, 60 }, "Exit");
+    GuiElement options = AddGuiButton(&gui, (Rectangle){ 280, 90, 250, 60 }, "Options");
+    GuiElement highscores = AddGuiButton(&gui, (Rectangle){ 540, 90, 250, 60 }, "Highscores");
+    GuiElement showFPS = AddCheckBox(&gui, (Rectangle){ 20, 360, 60, 60 }, "Show FPS", false);
+    GuiElement slider = AddSlider(&gui, (Rectangle){ screenWidth - 300, 200, 150, 30 }, "Less", "More", 30, 0, 100);
+
+    // Each button carries the message to show once it's pressed
+    SetGuiElementUserData(&gui, newGame, "Pressed the New Game button!");
+    SetGuiElementUserData(&gui, loadGame, "Now Loading the Game");
+    SetGuiElementUserData(&gui, exit, "Exit time... Bye bye!");
+    SetGuiElementUserData(&gui, options, "Options Time");
+    SetGuiElementUserData(&gui, highscores, "Show Highscores");
 
     const char* message = "Use the keyboard to handle input. Arrows/Enter";
     //--------------------------------------------------------------------------------------
@@ -61,21 +68,13 @@ int main(void)
         // Update the GUI
         UpdateGuiContainer(&gui);
 
-        // Check Button States
-        if (IsGuiButtonPressed(newGame)) {
-            message = "Pressed the New Game button!";
-        }
-        if (IsGuiButtonPressed(loadGame)) {
-            message = "Now Loading the Game";
-        }
-        if (IsGuiButtonPressed(exit)) {
-            message = "Exit time... Bye bye!";
-        }
-        if (IsGuiButtonPressed(options)) {
-            message = "Options Time";
-        }
-        if (IsGuiButtonPressed(highscores)) {
-            message = "Show Highscores";
+        // Handle what changed, rather than checking every button
+        int eventCount;
+        const GuiEvent* events = GetGuiContainerEvents(&gui, &eventCount);
+        for (int i = 0; i < eventCount; i++) {
+            if (events[i].type == GUI_EVENT_PRESSED) {
+                message = (const char*)events[i].userData;
+            }
         }
 
         // Draw
@@ -87,7 +86,7 @@ int main(void)
             DrawText(message, 190, 300, 20, DARKGRAY);
 
             // Check the High Resolution check box
-            if (IsGuiCheckBoxChecked(showFPS)) {
+            if (IsGuiCheckBoxChecked(&gui, showFPS)) {
                 DrawFPS(20, 0);
             }
 
@@ -6,28 +6,224 @@
  *   - raygui
  */
 
-#ifndef RAYGUI_CONTAINER_H_
+/**
+ * Retained drawing hooks, enabled with RAYGUI_CONTAINER_RETAINED, and the text measurement hook, enabled with
+ * RAYGUI_CONTAINER_TEXT_CACHE.
+ *
+ * raygui draws and measures text through a handful of raylib functions. The drawing hooks let the container record
+ * those calls into its draw cache instead of drawing them, and the measurement hook answers MeasureTextEx() from the
+ * sizes the container has already measured. With raylib, include this header before raygui's implementation so the
+ * hooks are in place when raygui is compiled. With RAYGUI_STANDALONE, call the Record functions from your drawing
+ * functions, and skip drawing when they return true, and look sizes up with FindGuiTextSize() from MeasureTextEx(),
+ * passing what you measure on a miss to CacheGuiTextSize().
+ */
+#if (defined(RAYGUI_CONTAINER_RETAINED) || defined(RAYGUI_CONTAINER_TEXT_CACHE)) && !defined(RAYGUI_CONTAINER_HOOKS_H_)
+#define RAYGUI_CONTAINER_HOOKS_H_
+
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+#if defined(RAYGUI_CONTAINER_RETAINED)
+bool RecordGuiDrawRectangle(int posX, int posY, int width, int height, Color color);
+bool RecordGuiDrawRectangleGradient(Rectangle rec, Color col1, Color col2, Color col3, Color col4);
+bool RecordGuiDrawText(Font font, const char* text, Vector2 position, float fontSize, float spacing, Color tint);
+bool RecordGuiDrawCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint);
+#endif
+#if defined(RAYGUI_CONTAINER_TEXT_CACHE)
+bool FindGuiTextSize(Font font, const char* text, float fontSize, float spacing, Vector2* size);
+void CacheGuiTextSize(Font font, const char* text, float fontSize, float spacing, Vector2 size);
+#if !defined(RAYGUI_STANDALONE)
+Vector2 MeasureGuiText(Font font, const char* text, float fontSize, float spacing);
+#endif
+#endif
+
+#if defined(__cplusplus)
+}            // Prevents name mangling of functions
+#endif
+
+// Route raylib's drawing through the hooks. Wrapping a name in parentheses, like (DrawRectangle)(...), calls raylib.
+#if !defined(RAYGUI_STANDALONE)
+#if defined(RAYGUI_CONTAINER_RETAINED)
+#define DrawRectangle(posX, posY, width, height, color) \
+    (RecordGuiDrawRectangle(posX, posY, width, height, color) ? (void)0 : (DrawRectangle)(posX, posY, width, height, color))
+#define DrawRectangleGradientEx(rec, col1, col2, col3, col4) \
+    (RecordGuiDrawRectangleGradient(rec, col1, col2, col3, col4) ? (void)0 : (DrawRectangleGradientEx)(rec, col1, col2, col3, col4))
+#define DrawRectangleGradientV(posX, posY, width, height, color1, color2) \
+    (RecordGuiDrawRectangleGradient((Rectangle){ (float)(posX), (float)(posY), (float)(width), (float)(height) }, color1, color2, color2, color1) ? \
+        (void)0 : (DrawRectangleGradientV)(posX, posY, width, height, color1, color2))
+#define DrawTextEx(font, text, position, fontSize, spacing, tint) \
+    (RecordGuiDrawText(font, text, position, fontSize, spacing, tint) ? (void)0 : (DrawTextEx)(font, text, position, fontSize, spacing, tint))
+#define DrawTextCodepoint(font, codepoint, position, fontSize, tint) \
+    (RecordGuiDrawCodepoint(font, codepoint, position, fontSize, tint) ? (void)0 : (DrawTextCodepoint)(font, codepoint, position, fontSize, tint))
+#endif
+#if defined(RAYGUI_CONTAINER_TEXT_CACHE)
+#define MeasureTextEx(font, text, fontSize, spacing) MeasureGuiText(font, text, fontSize, spacing)
+#endif
+#endif
+
+#endif  // RAYGUI_CONTAINER_HOOKS_H_
+
+// With the hooks enabled, the header may be included before raygui.h just for the hooks.
+#if !defined(RAYGUI_CONTAINER_H_) && (defined(RAYGUI_H) || !defined(RAYGUI_CONTAINER_HOOKS_H_))
 #define RAYGUI_CONTAINER_H_
 
 #if defined(__cplusplus)
 extern "C" {            // Prevents name mangling of functions
 #endif
 
+// The number of input bindings a container can hold.
+#ifndef RAYGUI_CONTAINER_MAX_BINDINGS
+#define RAYGUI_CONTAINER_MAX_BINDINGS 32
+#endif
+
+// The number of codepoints a text box takes in a single update. Further codepoints are dropped.
+#ifndef RAYGUI_CONTAINER_MAX_CHARS
+#define RAYGUI_CONTAINER_MAX_CHARS 16
+#endif
+
+/**
+ * Handle to an element in a GuiContainer.
+ *
+ * Handles stay valid while the container grows. Once the element is removed, its handle no longer resolves.
+ */
 typedef struct GuiElement {
-    GuiControl controlType;
-    Rectangle bounds;
-    const char *text;
-    const char *text2;
-    bool stateBool;
-    float stateFloat1;
-    float stateFloat2;
-    float stateFloat3;
+    int index;
+    unsigned int generation;
 } GuiElement;
 
+/**
+ * The kind of control an element is, which decides how it's drawn and how it takes input. Stored in a byte per element.
+ */
+typedef enum GuiElementType {
+    GUI_TYPE_GROUP = 0,                 // A panel, scroll panel or window box, holding a nested container
+    GUI_TYPE_BUTTON,
+    GUI_TYPE_CHECKBOX,
+    GUI_TYPE_TOGGLE,
+    GUI_TYPE_TOGGLEGROUP,
+    GUI_TYPE_SLIDER,
+    GUI_TYPE_SLIDERBAR,
+    GUI_TYPE_PROGRESSBAR,
+    GUI_TYPE_SPINNER,
+    GUI_TYPE_VALUEBOX,
+    GUI_TYPE_COMBOBOX,
+    GUI_TYPE_DROPDOWNBOX,
+    GUI_TYPE_TEXTBOX,
+    GUI_TYPE_COLORPICKER,
+    GUI_TYPE_LISTVIEW,
+    GUI_TYPE_COUNT
+} GuiElementType;
+
+/**
+ * The value of a slider, slider bar, progress bar, spinner or value box.
+ */
+typedef struct GuiValueState {
+    const char* textRight;              // The text right of a slider, slider bar or progress bar
+    float value;
+    float min;
+    float max;
+    float step;                         // The increment the value snaps to, or 0 for none
+    float pending;                      // The part of an adjustment that hasn't added up to a step yet
+} GuiValueState;
+
+/**
+ * The item chosen in a toggle group, combo box or dropdown box, from the items in its text, separated by ';'.
+ */
+typedef struct GuiChoiceState {
+    int active;
+    int count;                          // The number of items
+    const char** items;                 // The items, split out of the text the first time they're drawn, or NULL
+    int shown;                          // The item a combo box's text was last built with, or -1
+} GuiChoiceState;
+
+/**
+ * The text typed into a text box, kept in a buffer the element owns.
+ */
+typedef struct GuiTextBoxState {
+    char* buffer;
+    int size;                           // The size of the buffer, including the terminating null
+    int revision;                       // Counts the edits, so the draw cache sees the text change
+} GuiTextBoxState;
+
+typedef struct GuiColorState {
+    Color color;
+    float hue;                          // The hue adjustments move, kept apart so it survives grays and rounding
+} GuiColorState;
+
+/**
+ * The state of a single element, which is only read when the element is updated or drawn. Only the member for the
+ * element's GuiElementType is used.
+ *
+ * The text is copied into the container's string arena, so callers don't need to keep their strings alive.
+ */
+typedef struct GuiElementState {
+    const char *text;                   // The label, the left text of a slider, or the items of a choice
+    union {
+        bool pressed;                   // A button, pressed in the last update
+        bool checked;                   // A check box or toggle
+        GuiValueState value;
+        GuiChoiceState choice;
+        GuiTextBoxState textBox;
+        GuiColorState color;
+        struct GuiList* list;           // The rows of a list view
+        struct GuiContainer* container; // The nested container of a group
+    };
+} GuiElementState;
+
+/**
+ * Supply the rows of a list view. Only the rows in view are asked for, each time the list is drawn, and the returned
+ * text is copied, so it only needs to stay valid until the next call.
+ */
+typedef int (*GuiListCountCallback)(void* userData);
+typedef const char* (*GuiListTextCallback)(int row, void* userData);
+
+/**
+ * Flags describing an element, kept next to its bounds for hit-testing and navigation.
+ */
+enum GuiElementFlags {
+    GUI_ELEMENT_SELECTABLE = 1,
+    GUI_ELEMENT_GROUP = 2               // The element holds a nested container
+};
+
+/**
+ * The raygui control drawn around a nested container.
+ */
+typedef enum GuiGroupType {
+    GUI_GROUP_PANEL = 0,                // GuiPanel(), with an optional header
+    GUI_GROUP_SCROLL_PANEL,             // GuiScrollPanel(), which scrolls its content
+    GUI_GROUP_WINDOW_BOX                // GuiWindowBox(), which collapses when its close button is pressed
+} GuiGroupType;
+
+/**
+ * The elements are stored as a structure of arrays, indexed by element index. The bounds and flags are read for every
+ * element when hit-testing and navigating, so they are kept in their own arrays, apart from the rest of the state.
+ */
 typedef struct GuiContainer {
-    GuiElement* elements;
-    GuiElement* activeElement;
+    Rectangle* bounds;          // The bounds of each live element, packed at the start of the array
+    unsigned char* flags;       // The GuiElementFlags of each live element
+    unsigned char* types;       // The GuiElementType of each live element
+    GuiElementState* states;    // The state of each live element
+    int* ids;                   // The handle index of each live element
+    int count;                  // The number of live elements
+    int capacity;               // The number of elements allocated
+    int* slots;                 // For each handle index, the element index, or the next free handle index
+    unsigned int* generations;  // For each handle index, the generation of its current element
+    int slotCount;              // The number of handle indices that have been used
+    int freeSlot;               // The first free handle index, or -1
+    int activeElement;          // The element index that has focus, or -1
     bool focusLocked;
+    struct GuiSpatialIndex* spatialIndex;
+    struct GuiNavigationGraph* navigation;  // The cached neighbours of each element
+    struct GuiInput* input;             // The input bindings, the actions queued for the next update, and the last update's events
+    struct GuiElementHandlers* handlers;    // The callbacks and user data of the elements, or NULL if none were set
+    struct GuiDrawCache* drawCache;     // The retained draw commands, or NULL to draw every element each frame
+    struct GuiGroup* group;             // The panel this container is nested in, or NULL for the root container
+    struct GuiContainerStyle* style;    // The style overrides, lock and alpha the container is drawn with
+    struct GuiStringArena* strings;     // The element text, owned by the container, and the sizes measured for it
+    struct GuiLayoutTree* layout;       // The layouts that place the elements, or NULL
+    struct GuiContainerFile* file;      // The file the container was loaded from, or NULL
+    struct GuiProfile* profile;         // The timings and counters recorded with RAYGUI_CONTAINER_PROFILE, or NULL
+    struct GuiAnimation* animation;     // The tweens and the faded elements' alphas, or NULL if nothing was animated
 } GuiContainer;
 
 enum GuiDirection {
@@ -37,15 +233,280 @@ enum GuiDirection {
     LEFT
 };
 
+/**
+ * What the user asked the container to do, independent of the device they used.
+ */
+typedef enum GuiActionType {
+    GUI_ACTION_NAVIGATE = 0,        // Move focus in the direction given by value, or adjust a focus locked slider
+    GUI_ACTION_ACTIVATE,            // Press the focused element
+    GUI_ACTION_ADJUST,              // Change the focused element's value by value plus amount steps
+    GUI_ACTION_TAB,                 // Move focus to the next element
+    GUI_ACTION_POINTER_MOVE,        // The mouse moved to position
+    GUI_ACTION_POINTER_RELEASE,     // The mouse button was released at position
+    GUI_ACTION_FINE,                // While held, adjustments move by RAYGUI_CONTAINER_FINE_SCALE steps. Never queued
+    GUI_ACTION_COARSE,              // While held, adjustments move by RAYGUI_CONTAINER_COARSE_SCALE steps. Never queued
+    GUI_ACTION_TEXT,                // Type the codepoint given by value into a focus locked text box
+    GUI_ACTION_DELETE,              // Delete the last codepoint of a focus locked text box
+    GUI_ACTION_SCROLL,              // The mouse wheel moved by amount, with the mouse at position
+    GUI_ACTION_POINTER_DRAG         // The mouse button was held down at position
+} GuiActionType;
+
+typedef struct GuiAction {
+    int type;                       // The GuiActionType
+    int value;                      // The GuiDirection to navigate in, the number of steps to adjust by, or the codepoint typed
+    Vector2 position;               // The mouse position of pointer actions
+    float amount;                   // The steps to adjust by, on top of value, given in fractions by held and analog input
+} GuiAction;
+
+/**
+ * An element's place in the navigation graph, as returned by GetGuiContainerNavigation().
+ */
+typedef struct GuiNavigationNode {
+    GuiElement element;
+    GuiElement neighbours[4];       // The neighbour in each GuiDirection, with an index of -1 if there is none
+    GuiElement tabNext;             // The next element in tab order
+    bool reachable;                 // Whether the focused element can reach it with directional navigation
+} GuiNavigationNode;
+
+typedef enum GuiInputDevice {
+    GUI_INPUT_KEY = 0,
+    GUI_INPUT_GAMEPAD_BUTTON,
+    GUI_INPUT_GAMEPAD_AXIS          // Read as a button when pushed past RAYGUI_CONTAINER_AXIS_THRESHOLD, or as an analog adjustment
+} GuiInputDevice;
+
+/**
+ * Maps a key, gamepad button or gamepad axis to an action. Gamepad bindings apply to every connected gamepad.
+ *
+ * Held bindings that navigate or adjust repeat, faster the longer they're held. While the focused element is adjustable,
+ * adjustments are made continuously instead, by the time held, or by how far an axis is pushed.
+ */
+typedef struct GuiInputBinding {
+    int device;                     // The GuiInputDevice
+    int button;                     // The key, gamepad button or gamepad axis
+    int action;                     // The GuiActionType
+    int value;                      // The value of the action. Axis bindings that navigate UP or LEFT read the axis' negative side
+} GuiInputBinding;
+
+/**
+ * The devices a container polls for input, so each player of a split-screen game can have a container of their own.
+ */
+typedef struct GuiInputSource {
+    bool keyboard;
+    bool mouse;
+    unsigned int gamepads;          // A bit for each gamepad to poll, with gamepad 0 in the lowest bit
+} GuiInputSource;
+
+/**
+ * Everything an update reads from the input devices, sampled once by PollGuiContainerInput(), or read from a replay.
+ */
+typedef struct GuiInputFrame {
+    float frameTime;                // The seconds since the last frame, from GetFrameTime()
+    float values[RAYGUI_CONTAINER_MAX_BINDINGS];    // How far each binding is held, as read by the container
+    bool pressed[RAYGUI_CONTAINER_MAX_BINDINGS];    // Whether each key or button binding was pressed
+    int chars[RAYGUI_CONTAINER_MAX_CHARS];          // The codepoints typed into a focus locked text box
+    int charCount;
+    Vector2 mousePosition;
+    Vector2 mouseDelta;
+    float mouseWheel;
+    unsigned int mouseButtons;      // Bits for the left, right and middle buttons held, then pressed, then released
+} GuiInputFrame;
+
+/**
+ * What changed in an update, as listed by GetGuiContainerEvents().
+ */
+typedef enum GuiEventType {
+    GUI_EVENT_PRESSED = 0,          // A button was pressed
+    GUI_EVENT_TOGGLED,              // A check box or toggle was checked, with a newValue of 1, or unchecked
+    GUI_EVENT_VALUE_CHANGED,        // A value, the item chosen in a choice or list view, or a color picker's color changed
+    GUI_EVENT_FOCUS_CHANGED,        // The element took focus
+    GUI_EVENT_TEXT_CHANGED          // A text box was typed in, with the length of its text before and after
+} GuiEventType;
+
+typedef struct GuiEvent {
+    int type;                       // The GuiEventType
+    struct GuiContainer* container; // The container holding the element, which may be nested in the updated one
+    GuiElement element;
+    void* userData;                 // The element's user data, set with SetGuiElementUserData()
+    float oldValue;                 // The value before and after a toggle or value change
+    float newValue;
+} GuiEvent;
+
+/**
+ * Called for an element's events, once the update that caused them has processed all of its actions.
+ */
+typedef void (*GuiEventCallback)(const GuiEvent* event);
+
+/**
+ * How a layout places its children inside its bounds, less its padding, with its spacing between them.
+ */
+typedef enum GuiLayoutType {
+    GUI_LAYOUT_VERTICAL = 0,        // Top to bottom, each child as wide as the layout
+    GUI_LAYOUT_HORIZONTAL,          // Left to right, each child as tall as the layout
+    GUI_LAYOUT_GRID                 // Rows of equally wide columns, each row as tall as its largest min
+} GuiLayoutType;
+
+/**
+ * The size of a layout's child in the direction the layout stacks it. Each child gets its min size, and the space
+ * that's left is shared between the children by weight, up to their max.
+ */
+typedef struct GuiLayoutSize {
+    float min;
+    float max;                      // The largest size, or 0 for no limit
+    float weight;                   // The child's share of the space that's left, or 0 to keep its min size
+    bool fitText;                   // Raise min to fit the element's text, at the text size it's drawn with
+} GuiLayoutSize;
+
+/**
+ * Handle to a layout node in a GuiContainer. Handles are invalidated by ClearGuiContainerLayout().
+ */
+typedef struct GuiLayout {
+    int index;
+} GuiLayout;
+
+/**
+ * The parts of a frame timed with RAYGUI_CONTAINER_PROFILE. Phases nest: hit-testing and navigation searches happen
+ * while actions are processed, and culling while drawing.
+ */
+typedef enum GuiProfilePhase {
+    GUI_PHASE_UPDATE = 0,           // UpdateGuiContainer(), as a whole
+    GUI_PHASE_LAYOUT,               // The layout pass
+    GUI_PHASE_INPUT,                // Polling the input devices
+    GUI_PHASE_ACTIONS,              // Processing the actions, which resolves focus
+    GUI_PHASE_HIT_TEST,             // Finding the element under the mouse
+    GUI_PHASE_NAVIGATION,           // Searching for a neighbour that wasn't cached
+    GUI_PHASE_DRAW,                 // DrawGuiContainer(), as a whole
+    GUI_PHASE_CULL,                 // Finding the elements in view
+    GUI_PHASE_ANIMATE,              // Advancing the tweens, once the actions are processed
+    GUI_PHASE_COUNT
+} GuiProfilePhase;
+
+/**
+ * What a container did since its counters were last reset, recorded with RAYGUI_CONTAINER_PROFILE. A container's
+ * counters include the containers nested in it.
+ */
+typedef struct GuiProfileCounters {
+    int updates;
+    int draws;
+    double phaseTime[GUI_PHASE_COUNT];  // The seconds spent in each GuiProfilePhase
+    long long actions;                  // Actions processed
+    long long layoutNodes;              // Layout nodes visited by layout passes
+    long long elementsHitTested;        // Elements in the containers searched for the element under the mouse
+    long long navigationQueries;        // Neighbours asked for
+    long long navigationSearches;       // Neighbours searched for, as they weren't cached
+    long long elementsVisible;          // Elements found in view while drawing
+    long long elementsDrawn;            // Elements drawn through raygui, rather than replayed from the draw cache
+    long long commandsReplayed;         // Draw commands replayed from the draw cache
+    long long tweensAdvanced;           // Tweens advanced by updates
+} GuiProfileCounters;
+
 GuiContainer InitGuiContainer();
 void UnloadGuiContainer(GuiContainer container);
 void UpdateGuiContainer(GuiContainer* container);
-GuiElement* AddGuiButton(GuiContainer container, Rectangle bounds, const char* text);
-GuiElement* AddCheckBox(GuiContainer container, Rectangle bounds, const char* text, bool checked);
-GuiElement* AddSlider(GuiContainer container, Rectangle bounds, const char* textLeft, const char* textRight, float value, float minValue, float maxValue);
-bool IsGuiButtonPressed(GuiElement* element);
-bool IsGuiCheckBoxChecked(GuiElement* element);
-float GetGuiSliderValue(GuiElement* element);
+void DrawGuiContainer(GuiContainer container);
+GuiElement AddGuiButton(GuiContainer* container, Rectangle bounds, const char* text);
+GuiElement AddCheckBox(GuiContainer* container, Rectangle bounds, const char* text, bool checked);
+GuiElement AddSlider(GuiContainer* container, Rectangle bounds, const char* textLeft, const char* textRight, float value, float minValue, float maxValue);
+GuiContainer* AddGuiPanel(GuiContainer* container, Rectangle bounds, const char* text);
+GuiContainer* AddGuiScrollPanel(GuiContainer* container, Rectangle bounds, const char* text, Rectangle content);
+GuiContainer* AddGuiWindowBox(GuiContainer* container, Rectangle bounds, const char* title);
+GuiElement AddGuiListView(GuiContainer* container, Rectangle bounds, GuiListCountCallback getCount, GuiListTextCallback getText, void* userData);
+GuiElement AddGuiSliderBar(GuiContainer* container, Rectangle bounds, const char* textLeft, const char* textRight, float value, float minValue, float maxValue);
+GuiElement AddGuiSpinner(GuiContainer* container, Rectangle bounds, const char* text, int value, int minValue, int maxValue);
+GuiElement AddGuiValueBox(GuiContainer* container, Rectangle bounds, const char* text, int value, int minValue, int maxValue);
+GuiElement AddGuiProgressBar(GuiContainer* container, Rectangle bounds, const char* textLeft, const char* textRight, float value, float minValue, float maxValue);
+GuiElement AddGuiToggle(GuiContainer* container, Rectangle bounds, const char* text, bool active);
+GuiElement AddGuiToggleGroup(GuiContainer* container, Rectangle bounds, const char* text, int active);
+GuiElement AddGuiComboBox(GuiContainer* container, Rectangle bounds, const char* text, int active);
+GuiElement AddGuiDropdownBox(GuiContainer* container, Rectangle bounds, const char* text, int active);
+GuiElement AddGuiTextBox(GuiContainer* container, Rectangle bounds, const char* text, int textSize);
+GuiElement AddGuiColorPicker(GuiContainer* container, Rectangle bounds, const char* text, Color color);
+void RemoveGuiElement(GuiContainer* container, GuiElement element);
+bool IsGuiElementValid(GuiContainer* container, GuiElement element);
+void SetGuiElementBounds(GuiContainer* container, GuiElement element, Rectangle bounds);
+void SetGuiElementText(GuiContainer* container, GuiElement element, const char* text);
+void SetGuiSliderText(GuiContainer* container, GuiElement element, const char* textLeft, const char* textRight);
+const char* GetGuiElementText(GuiContainer* container, GuiElement element);
+bool IsGuiButtonPressed(GuiContainer* container, GuiElement element);
+bool IsGuiCheckBoxChecked(GuiContainer* container, GuiElement element);
+float GetGuiSliderValue(GuiContainer* container, GuiElement element);
+void SetGuiSliderValue(GuiContainer* container, GuiElement element, float value);
+int GetGuiSpinnerValue(GuiContainer* container, GuiElement element);
+void SetGuiElementStep(GuiContainer* container, GuiElement element, float step);
+int GetGuiListViewActive(GuiContainer* container, GuiElement element);
+void SetGuiListViewActive(GuiContainer* container, GuiElement element, int row);
+int GetGuiElementActive(GuiContainer* container, GuiElement element);
+void SetGuiElementActive(GuiContainer* container, GuiElement element, int active);
+const char* GetGuiTextBoxText(GuiContainer* container, GuiElement element);
+void SetGuiTextBoxText(GuiContainer* container, GuiElement element, const char* text);
+Color GetGuiColorPickerColor(GuiContainer* container, GuiElement element);
+void SetGuiColorPickerColor(GuiContainer* container, GuiElement element, Color color);
+GuiElementType GetGuiElementType(GuiContainer* container, GuiElement element);
+GuiElement GetGuiContainerElement(GuiContainer* container);
+GuiContainer* GetGuiFocusedContainer(GuiContainer* container);
+void SetGuiContainerCollapsed(GuiContainer* container, bool collapsed);
+bool IsGuiContainerCollapsed(GuiContainer* container);
+void SetGuiContainerScroll(GuiContainer* container, Vector2 scroll);
+Vector2 GetGuiContainerScroll(GuiContainer* container);
+int GetGuiContainerNavigation(GuiContainer* container, GuiNavigationNode* nodes, int maxNodes);
+bool ExportGuiContainerNavigation(GuiContainer* container, const char* fileName);
+void PollGuiContainerInput(GuiContainer* container);
+const GuiInputFrame* GetGuiInputFrame(GuiContainer* container);
+bool StartGuiInputRecording(GuiContainer* container, const char* fileName);
+bool StartGuiInputReplay(GuiContainer* container, const char* fileName);
+void StopGuiInputRecording(GuiContainer* container);
+bool IsGuiInputReplaying(GuiContainer* container);
+int GetGuiInputReplayMismatch(GuiContainer* container);
+#if defined(RAYGUI_STANDALONE)
+void HashGuiDraw(const void* data, int size);
+#endif
+bool PushGuiContainerAction(GuiContainer* container, GuiAction action);
+const GuiAction* GetGuiContainerActions(GuiContainer* container, int* count);
+void ProcessGuiContainerActions(GuiContainer* container);
+const GuiEvent* GetGuiContainerEvents(GuiContainer* container, int* count);
+void SetGuiElementCallback(GuiContainer* container, GuiElement element, GuiEventCallback callback);
+void SetGuiElementUserData(GuiContainer* container, GuiElement element, void* userData);
+void* GetGuiElementUserData(GuiContainer* container, GuiElement element);
+bool AddGuiContainerBinding(GuiContainer* container, GuiInputBinding binding);
+void ClearGuiContainerBindings(GuiContainer* container);
+void ResetGuiContainerBindings(GuiContainer* container);
+void SetGuiContainerInputSource(GuiContainer* container, GuiInputSource source);
+GuiInputSource GetGuiContainerInputSource(GuiContainer* container);
+bool SetGuiContainerStyle(GuiContainer* container, int control, int property, int value);
+int GetGuiContainerStyle(GuiContainer* container, int control, int property);
+void ClearGuiContainerStyles(GuiContainer* container);
+void SetGuiContainerLocked(GuiContainer* container, bool locked);
+bool IsGuiContainerLocked(GuiContainer* container);
+void SetGuiContainerAlpha(GuiContainer* container, float alpha);
+void EnableGuiContainerAnimation(GuiContainer* container);
+void DisableGuiContainerAnimation(GuiContainer* container);
+bool IsGuiContainerAnimating(GuiContainer* container);
+void FadeGuiElement(GuiContainer* container, GuiElement element, float alpha, float duration);
+float GetGuiElementAlpha(GuiContainer* container, GuiElement element);
+GuiLayout SetGuiContainerLayout(GuiContainer* container, GuiLayoutType type, Rectangle bounds);
+void SetGuiContainerLayoutBounds(GuiContainer* container, Rectangle bounds);
+GuiLayout AddGuiLayout(GuiContainer* container, GuiLayout parent, GuiLayoutType type, GuiLayoutSize size);
+void AddGuiLayoutElement(GuiContainer* container, GuiLayout parent, GuiElement element, GuiLayoutSize size);
+void SetGuiLayoutSize(GuiContainer* container, GuiLayout layout, GuiLayoutSize size);
+void SetGuiElementLayoutSize(GuiContainer* container, GuiElement element, GuiLayoutSize size);
+void SetGuiLayoutSpacing(GuiContainer* container, GuiLayout layout, float padding, float spacing);
+void SetGuiLayoutColumns(GuiContainer* container, GuiLayout layout, int columns);
+void ApplyGuiContainerLayout(GuiContainer* container);
+void ClearGuiContainerLayout(GuiContainer* container);
+GuiElement GetGuiElementAt(GuiContainer* container, int index);
+GuiContainer LoadGuiContainer(const char* fileName);
+bool ExportGuiContainer(GuiContainer* container, const char* fileName);
+GuiContainer LoadGuiContainerText(const char* fileName);
+bool ExportGuiContainerText(GuiContainer* container, const char* fileName);
+#if defined(RAYGUI_CONTAINER_PROFILE)
+GuiProfileCounters GetGuiContainerCounters(GuiContainer* container);
+void ResetGuiContainerCounters(GuiContainer* container);
+bool ExportGuiContainerTrace(GuiContainer* container, const char* fileName);
+#endif
+#if defined(RAYGUI_CONTAINER_RETAINED)
+void EnableGuiContainerDrawCache(GuiContainer* container);
+void DisableGuiContainerDrawCache(GuiContainer* container);
+void InvalidateGuiContainerDrawCache(GuiContainer* container);
+#endif
 
 #if defined(__cplusplus)
 }            // Prevents name mangling of functions
@@ -57,6 +518,39 @@ float GetGuiSliderValue(GuiElement* element);
 #ifndef RAYGUI_CONTAINER_IMPLEMENTATION_ONCE
 #define RAYGUI_CONTAINER_IMPLEMENTATION_ONCE
 
+// Pick the widest instruction set available for hit-testing, unless RAYGUI_CONTAINER_NO_SIMD is defined.
+#if !defined(RAYGUI_CONTAINER_NO_SIMD)
+    #if defined(__AVX2__)
+        #define RAYGUI_CONTAINER_AVX2
+        #include <immintrin.h>
+    #elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define RAYGUI_CONTAINER_SSE2
+        #include <emmintrin.h>
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #define RAYGUI_CONTAINER_NEON
+        #include <arm_neon.h>
+    #endif
+#endif
+
+#include <stdint.h>     // Required for: uintptr_t
+#include <stdio.h>      // Required for: FILE, fopen(), fprintf(), fclose()
+#include <stdlib.h>     // Required for: qsort(), strtof()
+#include <string.h>     // Required for: memcpy(), memcmp(), memset(), strlen()
+
+// Map container files into memory where mmap() is available, unless RAYGUI_CONTAINER_NO_MMAP is defined, and read
+// them into a single block otherwise.
+#if !defined(RAYGUI_CONTAINER_NO_MMAP) && (defined(__unix__) || defined(__APPLE__))
+    #define RAYGUI_CONTAINER_MMAP
+    #include <fcntl.h>      // Required for: open()
+    #include <sys/mman.h>   // Required for: mmap(), munmap()
+    #include <sys/stat.h>   // Required for: fstat()
+    #include <unistd.h>     // Required for: close()
+#endif
+
+#if defined(RAYGUI_CONTAINER_PROFILE) && defined(RAYGUI_STANDALONE)
+    #include <time.h>       // Required for: clock_gettime(), clock()
+#endif
+
 #if defined(__cplusplus)
 extern "C" {            // Prevents name mangling of functions
 #endif
@@ -66,335 +560,7322 @@ extern "C" {            // Prevents name mangling of functions
 #define RAYGUI_CONTAINER_SQRTF sqrtf
 #endif
 
-// TODO: Switch to a better memory management system.
-#ifndef RAYGUI_CONTAINER_MAX_ELEMENTS
-#define RAYGUI_CONTAINER_MAX_ELEMENTS 100
+// The number of elements allocated up front. The container doubles its capacity whenever it runs out.
+#ifndef RAYGUI_CONTAINER_INITIAL_CAPACITY
+#define RAYGUI_CONTAINER_INITIAL_CAPACITY 32
 #endif
 
-GuiContainer InitGuiContainer() {
-    GuiContainer container;
-    container.elements = (struct GuiElement*)MemAlloc(RAYGUI_CONTAINER_MAX_ELEMENTS * sizeof(struct GuiElement));
-    container.activeElement = container.elements;
-    container.focusLocked = false;
-    return container;
-}
-
-Vector2 GetGuiElementCenter(GuiElement* element) {
-    return (Vector2){element->bounds.x + element->bounds.width / 2, element->bounds.y + element->bounds.height / 2};
-}
+// The number of gamepads polled for input.
+#ifndef RAYGUI_CONTAINER_MAX_GAMEPADS
+#define RAYGUI_CONTAINER_MAX_GAMEPADS 4
+#endif
 
-bool IsGuiElementSelectable(GuiElement* element) {
-    switch (element->controlType) {
-        case BUTTON:
-        case CHECKBOX:
-        case SLIDER:
-            return true;
-    }
+// The number of actions that can be queued for a single update. Further actions are dropped.
+#ifndef RAYGUI_CONTAINER_MAX_ACTIONS
+#define RAYGUI_CONTAINER_MAX_ACTIONS 64
+#endif
 
-    return false;
-}
+// The seconds a binding is held before it repeats, and how often it repeats: RAYGUI_CONTAINER_REPEAT_RATE times a
+// second at first, speeding up by RAYGUI_CONTAINER_REPEAT_ACCELERATION every second, up to RAYGUI_CONTAINER_REPEAT_MAX_RATE.
+#ifndef RAYGUI_CONTAINER_REPEAT_DELAY
+#define RAYGUI_CONTAINER_REPEAT_DELAY 0.4f
+#endif
+#ifndef RAYGUI_CONTAINER_REPEAT_RATE
+#define RAYGUI_CONTAINER_REPEAT_RATE 6.0f
+#endif
+#ifndef RAYGUI_CONTAINER_REPEAT_ACCELERATION
+#define RAYGUI_CONTAINER_REPEAT_ACCELERATION 12.0f
+#endif
+#ifndef RAYGUI_CONTAINER_REPEAT_MAX_RATE
+#define RAYGUI_CONTAINER_REPEAT_MAX_RATE 30.0f
+#endif
 
-bool IsGuiElementPressed(GuiContainer* container, GuiElement* element) {
-    // If the button is not active, it's not being pushed.
-    if (container->activeElement != element) {
-        return false;
-    }
+// The part of a gamepad axis ignored around its center, how far the axis is pushed before it counts as a button, and
+// the steps a second it adjusts by when pushed all the way.
+#ifndef RAYGUI_CONTAINER_AXIS_DEADZONE
+#define RAYGUI_CONTAINER_AXIS_DEADZONE 0.2f
+#endif
+#ifndef RAYGUI_CONTAINER_AXIS_THRESHOLD
+#define RAYGUI_CONTAINER_AXIS_THRESHOLD 0.5f
+#endif
+#ifndef RAYGUI_CONTAINER_AXIS_RATE
+#define RAYGUI_CONTAINER_AXIS_RATE 10.0f
+#endif
 
-    // Keyboard or Gamepad
-    // TODO: Allow changing keyboard/gamepad controls?
-    if (IsKeyPressed(KEY_ENTER) || IsGamepadButtonPressed(0, GAMEPAD_BUTTON_RIGHT_FACE_DOWN)) {
-        return true;
-    }
+// The size of an adjustment step, as a fraction of the range of an element without a step of its own, and the scale
+// the fine and coarse modifiers apply to adjustments.
+#ifndef RAYGUI_CONTAINER_ADJUST_STEP
+#define RAYGUI_CONTAINER_ADJUST_STEP 0.05f
+#endif
+#ifndef RAYGUI_CONTAINER_FINE_SCALE
+#define RAYGUI_CONTAINER_FINE_SCALE 0.2f
+#endif
+#ifndef RAYGUI_CONTAINER_COARSE_SCALE
+#define RAYGUI_CONTAINER_COARSE_SCALE 5.0f
+#endif
 
-    // Mouse Button
-    Vector2 mousePosition = GetMousePosition();
-    if (IsMouseButtonReleased(MOUSE_BUTTON_LEFT)) {
-        if (CheckCollisionPointRec(mousePosition, element->bounds)) {
-            return true;
-        }
-    }
+// The seconds the focus highlight takes to slide to a newly focused element, and a press pulse takes to grow by
+// RAYGUI_CONTAINER_PULSE_SIZE pixels and fade out.
+#ifndef RAYGUI_CONTAINER_FOCUS_TIME
+#define RAYGUI_CONTAINER_FOCUS_TIME 0.12f
+#endif
+#ifndef RAYGUI_CONTAINER_PULSE_TIME
+#define RAYGUI_CONTAINER_PULSE_TIME 0.3f
+#endif
+#ifndef RAYGUI_CONTAINER_PULSE_SIZE
+#define RAYGUI_CONTAINER_PULSE_SIZE 8.0f
+#endif
 
-    return false;
-}
+// The number of style overrides a container can hold.
+#ifndef RAYGUI_CONTAINER_MAX_STYLES
+#define RAYGUI_CONTAINER_MAX_STYLES 16
+#endif
 
-void SetNextActiveGuiElement(GuiContainer* container, int direction) {
-    GuiElement* active = container->activeElement;
+// The number of timed phases each container keeps with RAYGUI_CONTAINER_PROFILE. Older phases are overwritten.
+#ifndef RAYGUI_CONTAINER_PROFILE_EVENTS
+#define RAYGUI_CONTAINER_PROFILE_EVENTS 4096
+#endif
 
-    Vector2 activeCenter = GetGuiElementCenter(active);
-    float targetDistance = 99999999; // The furthest away.
-    GuiElement* target = NULL;
+// The size of the blocks a container's string arena allocates at a time. Longer strings get a block of their own.
+#ifndef RAYGUI_CONTAINER_STRING_BLOCK_SIZE
+#define RAYGUI_CONTAINER_STRING_BLOCK_SIZE 1024
+#endif
 
-    // Find the closest selectable element in the desired direction.
-    for (int i = 0; i < RAYGUI_CONTAINER_MAX_ELEMENTS; i++) {
-        GuiElement* current = container->elements + i;
+// The height of the header raygui draws for panels and window boxes. raygui defines it while compiling its controls.
+#ifndef RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT
+#define RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT 24
+#endif
 
-        // The current element already has focus.
-        if (current == container->activeElement) {
-            continue;
-        }
+/**
+ * What an element's GuiElementType can do, as flags of its GuiElementClass.
+ */
+enum GuiElementClassFlags {
+    GUI_CLASS_SELECTABLE = 1,       // Takes focus
+    GUI_CLASS_ADJUSTABLE = 2,       // Adjusted continuously, in fractions of a step, rather than a step at a time
+    GUI_CLASS_VALUE = 4,            // Holds a GuiValueState
+    GUI_CLASS_CHOICE = 8,           // Holds a GuiChoiceState
+    GUI_CLASS_TEXT_INPUT = 16,      // Typed into while focus locked
+    GUI_CLASS_LIVE = 32             // Drawn every frame, as what it shows can change without its state changing
+};
 
-        // Only focus on selectable elements.
-        if (!IsGuiElementSelectable(current)) {
-            continue;
-        }
+/**
+ * How an element type is drawn and takes input. The container calls through the class of an element's type, rather
+ * than switching on the type, so a new control only needs a class and a function to add it. Hooks left NULL do
+ * nothing.
+ */
+typedef struct GuiElementClass {
+    int control;                // The raygui GuiControl whose style the element is drawn and measured with
+    int flags;                  // The GuiElementClassFlags
+    char letter;                // The element's line type in the text format, or 0 if it can't be saved
+    void (*draw)(GuiContainer* container, int element, Rectangle bounds);
+    void (*activate)(GuiContainer* container, int element);
+    void (*adjust)(GuiContainer* container, int element, float steps);
 
-        // Determine if the element is in the desired direction.
-        bool inCorrectDirection = false;
-        switch (direction) {
-            case UP:
-                inCorrectDirection = current->bounds.y < active->bounds.y;
-                break;
-            case DOWN:
-                inCorrectDirection = current->bounds.y > active->bounds.y;
-                break;
-            case LEFT:
-                inCorrectDirection = current->bounds.x < active->bounds.x;
-                break;
-            case RIGHT:
-                inCorrectDirection = current->bounds.x > active->bounds.x;
-                break;
-        }
+    // Handle a direction pressed while the element has focus, returning false to let focus move on.
+    bool (*navigate)(GuiContainer* container, int element, int direction);
 
-        // The element id not in the desired direction.
-        if (!inCorrectDirection) {
-            continue;
-        }
+    // Handle a click at a screen position while the element has focus. NULL presses it, if the click is on it.
+    void (*click)(GuiContainer* container, int element, Rectangle bounds, Vector2 point);
 
-        // Find the closest element, based on the magnitude of the center of the elements.
-        Vector2 currentCenter = GetGuiElementCenter(current);
-        Vector2 distance = (Vector2){activeCenter.x - currentCenter.x, activeCenter.y - currentCenter.y};
-        float currentDistance = RAYGUI_CONTAINER_SQRTF(distance.x * distance.x + distance.y * distance.y);
+    // Handle the mouse wheel moving by the given amount, or the mouse button held down, at a screen position while the
+    // element has focus.
+    void (*scroll)(GuiContainer* container, int element, Rectangle bounds, Vector2 point, float amount);
+    void (*drag)(GuiContainer* container, int element, Rectangle bounds, Vector2 point);
 
-        // Ensure the compared distances are based on their absolute value.
-        if (currentDistance < 0) {
-            currentDistance *= -1.0f;
-        }
+    // Free what the element owns.
+    void (*unload)(GuiContainer* container, int element);
+} GuiElementClass;
 
-        // If the current distance is shorter, set it as the new target.
-        if (currentDistance < targetDistance) {
-            target = current;
-            targetDistance = currentDistance;
-        }
-    }
+// The classes are defined along with the controls.
+const GuiElementClass* GetGuiElementClass(int type);
 
-    // Switch the active element to the new target.
-    if (target != NULL) {
-        container->activeElement = target;
-        container->focusLocked = false;
+/**
+ * Get where an element keeps the text right of it, or NULL if it has none.
+ */
+const char** GetGuiElementTextRight(GuiContainer* container, int element) {
+    if (!(GetGuiElementClass(container->types[element])->flags & GUI_CLASS_VALUE)) {
+        return NULL;
     }
+    return &container->states[element].value.textRight;
 }
 
-void UpdateGuiContainer(GuiContainer* container) {
-    // Update the state of any elements.
-    switch (container->activeElement->controlType) {
-        case CHECKBOX:
-            // Toggle the checkbox if pressed.
-            if (IsGuiElementPressed(container, container->activeElement)) {
-                container->activeElement->stateBool = !container->activeElement->stateBool;
-            }
-            break;
-        case BUTTON:
-            container->activeElement->stateBool = IsGuiElementPressed(container, container->activeElement);
-            break;
-        case SLIDER:
-            // Slider requires interaction, so we use a focus lock to determine its input behavior.
-            if (container->focusLocked) {
-                // Allow un-focus locking.
-                if (IsGuiElementPressed(container, container->activeElement)) {
-                    container->focusLocked = false;
-                    break;
-                }
+// The size of the cells in the spatial index used for directional navigation.
+#ifndef RAYGUI_CONTAINER_GRID_CELL_SIZE
+#define RAYGUI_CONTAINER_GRID_CELL_SIZE 64.0f
+#endif
 
-                // Move left/right by 5% of the slider.
-                float amount = (container->activeElement->stateFloat3 - container->activeElement->stateFloat2) * 0.05f;
+/**
+ * Spatial hash of the element centers, used to find directional neighbours without scanning every element.
+ *
+ * Elements are stored by their handle index, which doesn't change as other elements are removed. Each bucket holds a
+ * doubly linked list of handle indices, so adding and removing elements is O(1).
+ */
+typedef struct GuiSpatialIndex {
+    int* buckets;
+    int bucketMask;
+    int* next;
+    int* prev;
+    int* cellX;
+    int* cellY;
+    int* results;               // The element indices found by FindGuiElementsInArea()
+    int count;
+    int minCellX;
+    int minCellY;
+    int maxCellX;
+    int maxCellY;
+    float minWidth;
+    float minHeight;
+    float maxWidth;
+    float maxHeight;
+} GuiSpatialIndex;
 
-                // Move the slider left/right.
-                if (IsKeyPressed(KEY_LEFT)) {
-                    container->activeElement->stateFloat1 -= amount;
-                }
-                else if (IsKeyPressed(KEY_RIGHT)) {
-                    container->activeElement->stateFloat1 += amount;
-                }
+int GetGuiSpatialIndexBucket(GuiSpatialIndex* index, int cellX, int cellY) {
+    unsigned int hash = ((unsigned int)cellX * 73856093u) ^ ((unsigned int)cellY * 19349663u);
+    return (int)(hash & (unsigned int)index->bucketMask);
+}
 
-                // Keep the slider value in the min/max bounds.
-                if (container->activeElement->stateFloat1 < container->activeElement->stateFloat2) {
-                    container->activeElement->stateFloat1 = container->activeElement->stateFloat2;
-                }
-                else if (container->activeElement->stateFloat1 > container->activeElement->stateFloat3) {
-                    container->activeElement->stateFloat1 = container->activeElement->stateFloat3;
-                }
-            }
-            else {
-                if (IsGuiElementPressed(container, container->activeElement)) {
-                    container->focusLocked = true;
-                }
-            }
-            break;
-    }
+void LinkGuiSpatialIndexElement(GuiSpatialIndex* index, int element) {
+    int bucket = GetGuiSpatialIndexBucket(index, index->cellX[element], index->cellY[element]);
 
-    // Don't switch element if the user is actively
-    if (container->focusLocked) {
-        return;
+    // Push the element to the front of its bucket.
+    index->prev[element] = -1;
+    index->next[element] = index->buckets[bucket];
+    if (index->buckets[bucket] >= 0) {
+        index->prev[index->buckets[bucket]] = element;
     }
+    index->buckets[bucket] = element;
+}
 
-    // TODO: Support for multiple gamepads
-    if (IsKeyPressed(KEY_UP) || IsGamepadButtonPressed(0, GAMEPAD_BUTTON_LEFT_FACE_UP)) {
-        SetNextActiveGuiElement(container, UP);
+void ResizeGuiSpatialIndex(GuiSpatialIndex* index, int capacity) {
+    index->next = (int*)MemRealloc(index->next, capacity * sizeof(int));
+    index->prev = (int*)MemRealloc(index->prev, capacity * sizeof(int));
+    index->cellX = (int*)MemRealloc(index->cellX, capacity * sizeof(int));
+    index->cellY = (int*)MemRealloc(index->cellY, capacity * sizeof(int));
+    index->results = (int*)MemRealloc(index->results, capacity * sizeof(int));
+
+    // Keep about one bucket per element, using a power of two so the hash can be masked.
+    int bucketCount = index->bucketMask + 1;
+    if (bucketCount >= capacity) {
         return;
     }
-    else if (IsKeyPressed(KEY_DOWN) || IsGamepadButtonPressed(0, GAMEPAD_BUTTON_LEFT_FACE_DOWN)) {
-        SetNextActiveGuiElement(container, DOWN);
-        return;
+    int oldBucketCount = bucketCount;
+    while (bucketCount < capacity) {
+        bucketCount *= 2;
     }
-    else if (IsKeyPressed(KEY_RIGHT) || IsGamepadButtonPressed(0, GAMEPAD_BUTTON_LEFT_FACE_RIGHT)) {
-        SetNextActiveGuiElement(container, RIGHT);
-        return;
+
+    // Collect the indexed elements into a single list before re-linking them into the new buckets.
+    int list = -1;
+    for (int i = 0; i < oldBucketCount; i++) {
+        int current = index->buckets[i];
+        while (current >= 0) {
+            int next = index->next[current];
+            index->next[current] = list;
+            list = current;
+            current = next;
+        }
     }
-    else if (IsKeyPressed(KEY_LEFT) || IsGamepadButtonPressed(0, GAMEPAD_BUTTON_LEFT_FACE_LEFT)) {
-        SetNextActiveGuiElement(container, LEFT);
-        return;
+
+    MemFree(index->buckets);
+    index->buckets = (int*)MemAlloc(bucketCount * sizeof(int));
+    index->bucketMask = bucketCount - 1;
+    for (int i = 0; i < bucketCount; i++) {
+        index->buckets[i] = -1;
     }
 
-    // Switch the active element if the mouse moved.
-    Vector2 mouseMoved = GetMouseDelta();
-    if (mouseMoved.x != 0 && mouseMoved.y != 0) {
-        Vector2 mousePosition = GetMousePosition();
-        for (int i = 0; i < RAYGUI_CONTAINER_MAX_ELEMENTS; i++) {
-            GuiElement* current = container->elements + i;
-            if (IsGuiElementSelectable(current)) {
-                if (CheckCollisionPointRec(mousePosition, current->bounds)) {
-                    container->activeElement = current;
-                    return;
-                }
-            }
-        }
+    while (list >= 0) {
+        int next = index->next[list];
+        LinkGuiSpatialIndexElement(index, list);
+        list = next;
     }
+}
 
-    // Tab Indexing
-    if (IsKeyPressed(KEY_TAB)) {
-        // Find the index of active element.
-        int index = -1;
-        for (int i = 0; i < RAYGUI_CONTAINER_MAX_ELEMENTS; i++) {
-            if (container->activeElement == container->elements + i) {
-                index = i;
-                break;
-            }
-        }
+GuiSpatialIndex* InitGuiSpatialIndex(int capacity) {
+    GuiSpatialIndex* index = (GuiSpatialIndex*)MemAlloc(sizeof(GuiSpatialIndex));
+    index->buckets = (int*)MemAlloc(sizeof(int));
+    index->buckets[0] = -1;
+    index->bucketMask = 0;
+    index->next = NULL;
+    index->prev = NULL;
+    index->cellX = NULL;
+    index->cellY = NULL;
+    index->results = NULL;
+    index->count = 0;
+    ResizeGuiSpatialIndex(index, capacity);
+    return index;
+}
 
-        // Find the next selectable element after the current one.
-        while (++index < RAYGUI_CONTAINER_MAX_ELEMENTS) {
-            GuiElement* current = container->elements + index;
-            if (IsGuiElementSelectable(current)) {
-                container->activeElement = current;
-                break;
-            }
-        }
+void UnloadGuiSpatialIndex(GuiSpatialIndex* index) {
+    MemFree(index->buckets);
+    MemFree(index->next);
+    MemFree(index->prev);
+    MemFree(index->cellX);
+    MemFree(index->cellY);
+    MemFree(index->results);
+    MemFree(index);
+}
 
-        // If it reached the end, loop back to the beginning.
-        if (index == RAYGUI_CONTAINER_MAX_ELEMENTS) {
-            container->activeElement = container->elements;
-        }
-    }
+int GetGuiSpatialIndexCell(float position) {
+    return (int)floorf(position / RAYGUI_CONTAINER_GRID_CELL_SIZE);
 }
 
-void UnloadGuiContainer(GuiContainer container) {
-    MemFree(container.elements);
+Vector2 GetGuiElementCenter(Rectangle bounds) {
+    return (Vector2){bounds.x + bounds.width / 2, bounds.y + bounds.height / 2};
 }
 
-GuiElement* AddElement(GuiContainer* container, GuiElement element) {
-    for (int i = 0; i < RAYGUI_CONTAINER_MAX_ELEMENTS; i++) {
-        GuiElement* current = container->elements + i;
-        if (current->controlType == DEFAULT) {
-            current->bounds = element.bounds;
-            current->controlType = element.controlType;
-            current->stateBool = element.stateBool;
-            current->text = element.text;
-            current->text2 = element.text2;
-            current->stateFloat1 = element.stateFloat1;
-            current->stateFloat2 = element.stateFloat2;
-            current->stateFloat3 = element.stateFloat3;
-            return current;
-        }
+void AddGuiSpatialIndexElement(GuiSpatialIndex* index, int element, Rectangle bounds) {
+    Vector2 center = GetGuiElementCenter(bounds);
+    int cellX = GetGuiSpatialIndexCell(center.x);
+    int cellY = GetGuiSpatialIndexCell(center.y);
+
+    index->cellX[element] = cellX;
+    index->cellY[element] = cellY;
+    LinkGuiSpatialIndexElement(index, element);
+
+    // Grow the extents, which are used to clip the search. They never shrink, which keeps them conservative.
+    if (index->count == 0) {
+        index->minCellX = index->maxCellX = cellX;
+        index->minCellY = index->maxCellY = cellY;
+        index->minWidth = index->maxWidth = bounds.width;
+        index->minHeight = index->maxHeight = bounds.height;
+    }
+    else {
+        if (cellX < index->minCellX) index->minCellX = cellX;
+        if (cellX > index->maxCellX) index->maxCellX = cellX;
+        if (cellY < index->minCellY) index->minCellY = cellY;
+        if (cellY > index->maxCellY) index->maxCellY = cellY;
+        if (bounds.width < index->minWidth) index->minWidth = bounds.width;
+        if (bounds.width > index->maxWidth) index->maxWidth = bounds.width;
+        if (bounds.height < index->minHeight) index->minHeight = bounds.height;
+        if (bounds.height > index->maxHeight) index->maxHeight = bounds.height;
+    }
+    index->count++;
+}
+
+void RemoveGuiSpatialIndexElement(GuiSpatialIndex* index, int element) {
+    int next = index->next[element];
+    int prev = index->prev[element];
+
+    if (prev >= 0) {
+        index->next[prev] = next;
+    }
+    else {
+        index->buckets[GetGuiSpatialIndexBucket(index, index->cellX[element], index->cellY[element])] = next;
+    }
+
+    if (next >= 0) {
+        index->prev[next] = prev;
     }
 
-    return NULL;
+    index->count--;
 }
 
-GuiElement* AddGuiButton(GuiContainer container, Rectangle bounds, const char* text) {
-    GuiElement element;
-    element.bounds = bounds;
-    element.text = text;
-    element.controlType = BUTTON;
-    element.stateBool = false;
-    return AddElement(&container, element);
+/**
+ * The cached neighbours of each element, so navigating a static layout doesn't search for them on every press.
+ *
+ * Entries are indexed by handle index, and filled in the first time they're needed. When an element is added, removed
+ * or moved, only the entries it could affect are cleared: those that pointed at it, and those it is now closer to
+ * than their cached neighbour. They're found through the spatial index, within the largest cached distance.
+ */
+typedef struct GuiNavigationGraph {
+    int* neighbours;            // For each handle index, the handle index of its neighbour in each GuiDirection, or -1
+    float* distances;           // For each handle index, the distance to its neighbour in each GuiDirection
+    unsigned char* cached;      // For each handle index, a bit for each cached GuiDirection, and one for the tab order
+    int* tabNext;               // For each handle index, the handle index of the next element in tab order, or -1 to wrap
+    int* openIndex;             // For each handle index, its position in the open list, or -1
+    int* open;                  // The handle indices that have a cached direction without any neighbour
+    int openCount;
+    float maxDistance;          // The largest cached distance, which never shrinks
+} GuiNavigationGraph;
+
+// The bit in GuiNavigationGraph.cached for the tab order.
+#define GUI_NAVIGATION_TAB 4
+
+void ResizeGuiNavigationGraph(GuiNavigationGraph* graph, int capacity) {
+    graph->neighbours = (int*)MemRealloc(graph->neighbours, capacity * 4 * sizeof(int));
+    graph->distances = (float*)MemRealloc(graph->distances, capacity * 4 * sizeof(float));
+    graph->cached = (unsigned char*)MemRealloc(graph->cached, capacity * sizeof(unsigned char));
+    graph->tabNext = (int*)MemRealloc(graph->tabNext, capacity * sizeof(int));
+    graph->openIndex = (int*)MemRealloc(graph->openIndex, capacity * sizeof(int));
+    graph->open = (int*)MemRealloc(graph->open, capacity * sizeof(int));
 }
 
-GuiElement* AddCheckBox(GuiContainer container, Rectangle bounds, const char* text, bool checked) {
-    GuiElement element;
-    element.bounds = bounds;
-    element.text = text;
-    element.controlType = CHECKBOX;
-    element.stateBool = checked;
-    return AddElement(&container, element);
+GuiNavigationGraph* InitGuiNavigationGraph(int capacity) {
+    GuiNavigationGraph* graph = (GuiNavigationGraph*)MemAlloc(sizeof(GuiNavigationGraph));
+    graph->neighbours = NULL;
+    graph->distances = NULL;
+    graph->cached = NULL;
+    graph->tabNext = NULL;
+    graph->openIndex = NULL;
+    graph->open = NULL;
+    graph->openCount = 0;
+    graph->maxDistance = 0;
+    ResizeGuiNavigationGraph(graph, capacity);
+    return graph;
 }
 
-GuiElement* AddSlider(GuiContainer container, Rectangle bounds, const char* textLeft, const char* textRight, float value, float minValue, float maxValue) {
-    GuiElement element;
-    element.bounds = bounds;
-    element.text = textLeft;
-    element.text2 = textRight;
-    element.controlType = SLIDER;
-    element.stateFloat1 = value;
-    element.stateFloat2 = minValue;
-    element.stateFloat3 = maxValue;
-    return AddElement(&container, element);
+void UnloadGuiNavigationGraph(GuiNavigationGraph* graph) {
+    MemFree(graph->neighbours);
+    MemFree(graph->distances);
+    MemFree(graph->cached);
+    MemFree(graph->tabNext);
+    MemFree(graph->openIndex);
+    MemFree(graph->open);
+    MemFree(graph);
 }
 
-void DrawGuiContainer(GuiContainer container) {
-    for (int i = 0; i < RAYGUI_CONTAINER_MAX_ELEMENTS; i++) {
-        GuiElement* element = container.elements + i;
+/**
+ * The input bindings of a container, and the actions queued for its next update.
+ */
+typedef struct GuiInput {
+    GuiInputBinding bindings[RAYGUI_CONTAINER_MAX_BINDINGS];
+    int bindingCount;
+    float held[RAYGUI_CONTAINER_MAX_BINDINGS];     // The seconds each binding has been held
+    bool down[RAYGUI_CONTAINER_MAX_BINDINGS];       // Whether each binding was held in the last poll
+    GuiAction actions[RAYGUI_CONTAINER_MAX_ACTIONS];
+    int actionCount;
+    GuiInputSource source;
 
-        // Flip raygui's GUI focus state based on the active element.
-        if (container.activeElement == element) {
-            // If we're focus locked, use the pressed state.
-            if (container.focusLocked) {
-                guiState = STATE_PRESSED;
-            }
-            else {
-                guiState = STATE_FOCUSED;
-            }
-        }
-        else {
-            guiState = STATE_NORMAL;
-        }
+    // Each action causes at most one event.
+    GuiEvent events[RAYGUI_CONTAINER_MAX_ACTIONS];
+    GuiEventCallback callbacks[RAYGUI_CONTAINER_MAX_ACTIONS];  // The callback of each event's element
+    int eventCount;
 
-        // Display the element.
-        switch (element->controlType) {
-            case BUTTON:
-                GuiButton(element->bounds, element->text);
-                break;
-            case CHECKBOX:
-                element->stateBool = GuiCheckBox(element->bounds, element->text, element->stateBool);
-                break;
-            case SLIDER:
-                GuiSlider(element->bounds, element->text, element->text2, element->stateFloat1, element->stateFloat2, element->stateFloat3);
-                break;
-        }
+    GuiInputFrame frame;                    // What the last poll read
+    struct GuiInputRecording* recording;    // The recording being written or replayed, or NULL
+} GuiInput;
+
+bool AddGuiContainerBinding(GuiContainer* container, GuiInputBinding binding) {
+    GuiInput* input = container->input;
+    if (input->bindingCount == RAYGUI_CONTAINER_MAX_BINDINGS) {
+        return false;
     }
-}
 
-bool IsGuiButtonPressed(GuiElement* element) {
-    return element->stateBool;
+    input->held[input->bindingCount] = 0;
+    input->down[input->bindingCount] = false;
+    input->bindings[input->bindingCount++] = binding;
+    return true;
 }
 
-bool IsGuiCheckBoxChecked(GuiElement* element) {
-    return element->stateBool;
+void ClearGuiContainerBindings(GuiContainer* container) {
+    container->input->bindingCount = 0;
 }
 
-float GetGuiSliderValue(GuiElement* element) {
-    return element->stateFloat1;
+/**
+ * Restore the default bindings: arrows, the d-pad and the left stick navigate, enter and the bottom face button
+ * activate, tab moves to the next element, and the shoulder buttons and the right stick adjust sliders. Shift and the
+ * left trigger make adjustments finer, and control and the right trigger make them coarser. Backspace deletes from a
+ * text box.
+ */
+void ResetGuiContainerBindings(GuiContainer* container) {
+    GuiInputBinding defaults[] = {
+        { GUI_INPUT_KEY, KEY_ENTER, GUI_ACTION_ACTIVATE, 0 },
+        { GUI_INPUT_GAMEPAD_BUTTON, GAMEPAD_BUTTON_RIGHT_FACE_DOWN, GUI_ACTION_ACTIVATE, 0 },
+        { GUI_INPUT_KEY, KEY_UP, GUI_ACTION_NAVIGATE, UP },
+        { GUI_INPUT_GAMEPAD_BUTTON, GAMEPAD_BUTTON_LEFT_FACE_UP, GUI_ACTION_NAVIGATE, UP },
+        { GUI_INPUT_KEY, KEY_DOWN, GUI_ACTION_NAVIGATE, DOWN },
+        { GUI_INPUT_GAMEPAD_BUTTON, GAMEPAD_BUTTON_LEFT_FACE_DOWN, GUI_ACTION_NAVIGATE, DOWN },
+        { GUI_INPUT_KEY, KEY_RIGHT, GUI_ACTION_NAVIGATE, RIGHT },
+        { GUI_INPUT_GAMEPAD_BUTTON, GAMEPAD_BUTTON_LEFT_FACE_RIGHT, GUI_ACTION_NAVIGATE, RIGHT },
+        { GUI_INPUT_KEY, KEY_LEFT, GUI_ACTION_NAVIGATE, LEFT },
+        { GUI_INPUT_GAMEPAD_BUTTON, GAMEPAD_BUTTON_LEFT_FACE_LEFT, GUI_ACTION_NAVIGATE, LEFT },
+        { GUI_INPUT_KEY, KEY_TAB, GUI_ACTION_TAB, 0 },
+        { GUI_INPUT_GAMEPAD_BUTTON, GAMEPAD_BUTTON_LEFT_TRIGGER_1, GUI_ACTION_ADJUST, -1 },
+        { GUI_INPUT_GAMEPAD_BUTTON, GAMEPAD_BUTTON_RIGHT_TRIGGER_1, GUI_ACTION_ADJUST, 1 },
+        { GUI_INPUT_GAMEPAD_AXIS, GAMEPAD_AXIS_LEFT_Y, GUI_ACTION_NAVIGATE, UP },
+        { GUI_INPUT_GAMEPAD_AXIS, GAMEPAD_AXIS_LEFT_Y, GUI_ACTION_NAVIGATE, DOWN },
+        { GUI_INPUT_GAMEPAD_AXIS, GAMEPAD_AXIS_LEFT_X, GUI_ACTION_NAVIGATE, RIGHT },
+        { GUI_INPUT_GAMEPAD_AXIS, GAMEPAD_AXIS_LEFT_X, GUI_ACTION_NAVIGATE, LEFT },
+        { GUI_INPUT_GAMEPAD_AXIS, GAMEPAD_AXIS_RIGHT_X, GUI_ACTION_ADJUST, 1 },
+        { GUI_INPUT_KEY, KEY_LEFT_SHIFT, GUI_ACTION_FINE, 0 },
+        { GUI_INPUT_GAMEPAD_BUTTON, GAMEPAD_BUTTON_LEFT_TRIGGER_2, GUI_ACTION_FINE, 0 },
+        { GUI_INPUT_KEY, KEY_LEFT_CONTROL, GUI_ACTION_COARSE, 0 },
+        { GUI_INPUT_GAMEPAD_BUTTON, GAMEPAD_BUTTON_RIGHT_TRIGGER_2, GUI_ACTION_COARSE, 0 },
+        { GUI_INPUT_KEY, KEY_BACKSPACE, GUI_ACTION_DELETE, 0 },
+    };
+
+    ClearGuiContainerBindings(container);
+    for (int i = 0; i < (int)(sizeof(defaults) / sizeof(defaults[0])); i++) {
+        AddGuiContainerBinding(container, defaults[i]);
+    }
+}
+
+/**
+ * Queue an action for the next ProcessGuiContainerActions(), such as one read from a recording.
+ *
+ * @return False if the queue is full, and the action was dropped.
+ */
+bool PushGuiContainerAction(GuiContainer* container, GuiAction action) {
+    GuiInput* input = container->input;
+    if (input->actionCount == RAYGUI_CONTAINER_MAX_ACTIONS) {
+        return false;
+    }
+
+    input->actions[input->actionCount++] = action;
+    return true;
+}
+
+/**
+ * Get the actions queued for the next ProcessGuiContainerActions().
+ */
+const GuiAction* GetGuiContainerActions(GuiContainer* container, int* count) {
+    *count = container->input->actionCount;
+    return container->input->actions;
+}
+
+/**
+ * Get how many times a binding held for the given seconds has repeated. Repeats start after RAYGUI_CONTAINER_REPEAT_DELAY,
+ * at RAYGUI_CONTAINER_REPEAT_RATE a second, and speed up by RAYGUI_CONTAINER_REPEAT_ACCELERATION every second until
+ * they reach RAYGUI_CONTAINER_REPEAT_MAX_RATE.
+ *
+ * The count is fractional, so held adjustments move smoothly, and it only depends on the time held, so the frame rate
+ * doesn't change how far they move.
+ */
+float GetGuiRepeatCount(float held) {
+    float time = held - RAYGUI_CONTAINER_REPEAT_DELAY;
+    if (time <= 0) {
+        return 0;
+    }
+
+    float rampTime = (RAYGUI_CONTAINER_REPEAT_MAX_RATE - RAYGUI_CONTAINER_REPEAT_RATE) / RAYGUI_CONTAINER_REPEAT_ACCELERATION;
+    float ramp = time < rampTime ? time : rampTime;
+    float count = RAYGUI_CONTAINER_REPEAT_RATE * ramp + RAYGUI_CONTAINER_REPEAT_ACCELERATION * ramp * ramp / 2;
+    return count + RAYGUI_CONTAINER_REPEAT_MAX_RATE * (time - ramp);
+}
+
+/**
+ * Read how far a binding is held: 1 for a key or button that's down, or how far an axis is pushed on the side the
+ * binding reads, on whichever gamepad pushes it furthest.
+ */
+float GetGuiBindingValue(GuiInput* input, GuiInputBinding* binding, const int* gamepads, int gamepadCount) {
+    float value = 0;
+    if (binding->device == GUI_INPUT_KEY) {
+        value = input->source.keyboard && (IsKeyPressed(binding->button) || IsKeyDown(binding->button)) ? 1.0f : 0.0f;
+    }
+    for (int gamepad = 0; gamepad < gamepadCount; gamepad++) {
+        if (binding->device == GUI_INPUT_GAMEPAD_BUTTON) {
+            if (IsGamepadButtonPressed(gamepads[gamepad], binding->button) || IsGamepadButtonDown(gamepads[gamepad], binding->button)) {
+                value = 1.0f;
+            }
+        }
+        else if (binding->device == GUI_INPUT_GAMEPAD_AXIS) {
+            float axis = GetGamepadAxisMovement(gamepads[gamepad], binding->button);
+            bool negative = binding->action == GUI_ACTION_NAVIGATE ? binding->value == UP || binding->value == LEFT : binding->value < 0;
+            axis = negative ? -axis : axis;
+            value = axis > value ? axis : value;
+        }
+    }
+    return value;
+}
+
+/**
+ * Check whether a key or button binding was pressed since the last poll.
+ */
+bool IsGuiBindingPressed(GuiInput* input, GuiInputBinding* binding, const int* gamepads, int gamepadCount) {
+    if (binding->device == GUI_INPUT_KEY) {
+        return input->source.keyboard && IsKeyPressed(binding->button);
+    }
+    for (int gamepad = 0; gamepad < gamepadCount; gamepad++) {
+        if (IsGamepadButtonPressed(gamepads[gamepad], binding->button)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Read what the container's bindings and the mouse hold from the input devices.
+ */
+void SampleGuiInputFrame(GuiContainer* container, GuiInputFrame* frame) {
+    GuiInput* input = container->input;
+    memset(frame, 0, sizeof(GuiInputFrame));
+    frame->frameTime = GetFrameTime();
+
+    // Find the connected gamepads of the input source once, rather than for every binding.
+    int gamepads[RAYGUI_CONTAINER_MAX_GAMEPADS];
+    int gamepadCount = 0;
+    for (int gamepad = 0; gamepad < RAYGUI_CONTAINER_MAX_GAMEPADS; gamepad++) {
+        if ((input->source.gamepads & (1u << gamepad)) && IsGamepadAvailable(gamepad)) {
+            gamepads[gamepadCount++] = gamepad;
+        }
+    }
+    for (int i = 0; i < input->bindingCount; i++) {
+        GuiInputBinding* binding = input->bindings + i;
+        frame->values[i] = GetGuiBindingValue(input, binding, gamepads, gamepadCount);
+        frame->pressed[i] = binding->device != GUI_INPUT_GAMEPAD_AXIS && IsGuiBindingPressed(input, binding, gamepads, gamepadCount);
+    }
+
+    // A focus locked text box takes what's typed. Anything else leaves the typed text for the application.
+    GuiContainer* focused = GetGuiFocusedContainer(container);
+    int active = focused->activeElement;
+    if (active >= 0 && (GetGuiElementClass(focused->types[active])->flags & GUI_CLASS_TEXT_INPUT) && focused->focusLocked && input->source.keyboard) {
+        for (int codepoint = GetCharPressed(); codepoint > 0 && frame->charCount < RAYGUI_CONTAINER_MAX_CHARS; codepoint = GetCharPressed()) {
+            frame->chars[frame->charCount++] = codepoint;
+        }
+    }
+
+    if (input->source.mouse) {
+        frame->mousePosition = GetMousePosition();
+        frame->mouseDelta = GetMouseDelta();
+        frame->mouseWheel = GetMouseWheelMove();
+        for (int button = 0; button < 3; button++) {
+            frame->mouseButtons |= (IsMouseButtonDown(button) ? 1u : 0u) << button;
+            frame->mouseButtons |= (IsMouseButtonPressed(button) ? 1u : 0u) << (button + 3);
+            frame->mouseButtons |= (IsMouseButtonReleased(button) ? 1u : 0u) << (button + 6);
+        }
+    }
+}
+
+/**
+ * Queue the actions a frame of input maps to through the container's bindings.
+ *
+ * Held bindings repeat by the frame's time. Adjustments to an adjustable element are queued in fractions of a step,
+ * and scaled by the fine and coarse modifiers.
+ */
+void ApplyGuiInputFrame(GuiContainer* container, const GuiInputFrame* frame) {
+    GuiInput* input = container->input;
+    float frameTime = frame->frameTime;
+
+    // Left and right adjust a focus locked element, rather than navigating.
+    GuiContainer* focused = GetGuiFocusedContainer(container);
+    int active = focused->activeElement;
+    int flags = active >= 0 ? GetGuiElementClass(focused->types[active])->flags : 0;
+    bool adjustable = (flags & GUI_CLASS_ADJUSTABLE) != 0;
+    bool locked = adjustable && focused->focusLocked;
+
+    for (int i = 0; i < frame->charCount; i++) {
+        PushGuiContainerAction(container, (GuiAction){ GUI_ACTION_TEXT, frame->chars[i], (Vector2){ 0, 0 }, 0 });
+    }
+
+    // The modifiers apply to every adjustment, so they're read first.
+    float scale = 1.0f;
+    for (int i = 0; i < input->bindingCount; i++) {
+        GuiInputBinding* binding = input->bindings + i;
+        if ((binding->action == GUI_ACTION_FINE || binding->action == GUI_ACTION_COARSE) && frame->values[i] > RAYGUI_CONTAINER_AXIS_THRESHOLD) {
+            scale *= binding->action == GUI_ACTION_FINE ? RAYGUI_CONTAINER_FINE_SCALE : RAYGUI_CONTAINER_COARSE_SCALE;
+        }
+    }
+
+    for (int i = 0; i < input->bindingCount; i++) {
+        GuiInputBinding* binding = input->bindings + i;
+        if (binding->action == GUI_ACTION_FINE || binding->action == GUI_ACTION_COARSE) {
+            continue;
+        }
+
+        // An axis is held while it's pushed past the threshold, and pressed as it gets there.
+        float value = frame->values[i];
+        bool axis = binding->device == GUI_INPUT_GAMEPAD_AXIS;
+        bool down = value > (axis ? RAYGUI_CONTAINER_AXIS_THRESHOLD : 0.0f);
+        bool pressed = axis ? down && !input->down[i] : frame->pressed[i];
+        float held = input->held[i];
+        input->down[i] = down;
+        input->held[i] = down && !pressed ? held + frameTime : 0;
+
+        // Held bindings repeat by the time they've been held, in fractions for adjustments.
+        bool repeats = binding->action == GUI_ACTION_NAVIGATE || binding->action == GUI_ACTION_ADJUST || binding->action == GUI_ACTION_DELETE;
+        float repeatCount = GetGuiRepeatCount(held);
+        float nextRepeatCount = GetGuiRepeatCount(held + frameTime);
+
+        int direction = 0;
+        if (binding->action == GUI_ACTION_ADJUST && adjustable) {
+            direction = binding->value;
+        }
+        else if (binding->action == GUI_ACTION_NAVIGATE && locked && (binding->value == LEFT || binding->value == RIGHT)) {
+            direction = binding->value == LEFT ? -1 : 1;
+        }
+
+        if (direction != 0) {
+            // An axis adjusts by how far it's pushed past the dead zone, rather than repeating.
+            float amount = 0;
+            if (axis) {
+                float deflection = (value - RAYGUI_CONTAINER_AXIS_DEADZONE) / (1.0f - RAYGUI_CONTAINER_AXIS_DEADZONE);
+                amount = deflection > 0 ? deflection * RAYGUI_CONTAINER_AXIS_RATE * frameTime : 0;
+            }
+            else if (pressed) {
+                amount = 1.0f;
+            }
+            else if (down) {
+                amount = nextRepeatCount - repeatCount;
+            }
+            if (amount > 0) {
+                PushGuiContainerAction(container, (GuiAction){ GUI_ACTION_ADJUST, 0, (Vector2){ 0, 0 }, amount * (float)direction * scale });
+            }
+            continue;
+        }
+
+        int count = pressed ? 1 : 0;
+        if (!pressed && down && repeats) {
+            count = (int)nextRepeatCount - (int)repeatCount;
+        }
+        for (int repeat = 0; repeat < count; repeat++) {
+            PushGuiContainerAction(container, (GuiAction){ binding->action, binding->value, (Vector2){ 0, 0 }, 0 });
+        }
+    }
+
+    if (!input->source.mouse) {
+        return;
+    }
+
+    // The mouse wheel adjusts the element under the mouse, which has focus, or scrolls it if it can't be adjusted.
+    if (frame->mouseWheel != 0 && adjustable) {
+        PushGuiContainerAction(container, (GuiAction){ GUI_ACTION_ADJUST, 0, (Vector2){ 0, 0 }, frame->mouseWheel * scale });
+    }
+    else if (frame->mouseWheel != 0) {
+        PushGuiContainerAction(container, (GuiAction){ GUI_ACTION_SCROLL, 0, frame->mousePosition, frame->mouseWheel });
+    }
+
+    // The mouse is released before it moves, so a click lands on the element that had focus.
+    if (frame->mouseButtons & (1u << (MOUSE_BUTTON_LEFT + 6))) {
+        PushGuiContainerAction(container, (GuiAction){ GUI_ACTION_POINTER_RELEASE, 0, frame->mousePosition, 0 });
+    }
+
+    if (frame->mouseDelta.x != 0 || frame->mouseDelta.y != 0) {
+        PushGuiContainerAction(container, (GuiAction){ GUI_ACTION_POINTER_MOVE, 0, frame->mousePosition, 0 });
+    }
+
+    // Dragging follows the move, so it's on the element under the mouse.
+    if (frame->mouseButtons & (1u << MOUSE_BUTTON_LEFT)) {
+        PushGuiContainerAction(container, (GuiAction){ GUI_ACTION_POINTER_DRAG, 0, frame->mousePosition, 0 });
+    }
+}
+
+
+/**
+ * What's stored for a frame of a recording, besides the flags. Only what changed since the frame before is stored,
+ * and a run of frames where nothing changed is stored as a count.
+ */
+enum GuiRecordingFrameFlags {
+    GUI_RECORDING_IDLE = 0,             // Followed by the number of frames in a row where nothing changed
+    GUI_RECORDING_FRAME_TIME = 1,       // The frame time, as a float
+    GUI_RECORDING_MOUSE_MOVE = 2,       // The mouse moved by whole pixels, as two varints
+    GUI_RECORDING_MOUSE_EXACT = 4,      // The mouse position and movement, as four floats
+    GUI_RECORDING_MOUSE_BUTTONS = 8,    // The mouse buttons, as a varint
+    GUI_RECORDING_MOUSE_WHEEL = 16,     // The mouse wheel moved, as a float
+    GUI_RECORDING_BINDINGS = 32,        // The number of bindings that changed, then the index and state of each
+    GUI_RECORDING_CHARS = 64,           // The number of codepoints typed, then each codepoint
+    GUI_RECORDING_DRAW_HASH = 128       // The hash of what was drawn after the update, if it changed
+};
+
+#define GUI_RECORDING_VERSION 1
+
+/**
+ * The header of an input recording, followed by the container's bindings and then the frames.
+ */
+typedef struct GuiRecordingHeader {
+    char magic[4];                  // "rGIR"
+    int version;
+    int bindingCount;
+    GuiInputSource source;
+} GuiRecordingHeader;
+
+/**
+ * An input recording being streamed to or from a file.
+ */
+typedef struct GuiInputRecording {
+    FILE* file;
+    bool replaying;
+    bool ended;                     // Whether a replay reached the end of its file
+    GuiInputFrame previous;         // The last frame written or read, which the next frame is stored relative to
+    int frame;                      // The number of frames written or read
+    int idleFrames;                 // The frames where nothing changed that are still to be written or read
+    bool pending;                   // Whether previous still has to be written, once its draw hash is known
+    GuiInputFrame next;             // The frame waiting to be written
+    unsigned int drawHash;          // The hash of the last frame drawn, and whether it was drawn
+    bool drawn;
+    unsigned int recordedHash;      // The last draw hash stored in the recording, and whether one was
+    bool hashed;
+    int mismatch;                   // The first replayed frame that didn't draw what was recorded, or -1
+} GuiInputRecording;
+
+// The draw hash of the frame being drawn, added to by HashGuiDraw() while a recorded container is drawn.
+static unsigned int guiDrawHash = 0;
+static bool guiDrawHashing = false;
+static bool guiDrawHashed = false;
+
+void WriteGuiVarint(FILE* file, unsigned int value) {
+    while (value >= 0x80) {
+        fputc((int)(value & 0x7f) | 0x80, file);
+        value >>= 7;
+    }
+    fputc((int)value, file);
+}
+
+bool ReadGuiVarint(FILE* file, unsigned int* value) {
+    *value = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+        int byte = fgetc(file);
+        if (byte == EOF) {
+            return false;
+        }
+        *value |= (unsigned int)(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Check whether the mouse moved by whole pixels, as it does with a real mouse, so the move fits in two small varints.
+ */
+bool IsGuiMouseMoveWhole(const GuiInputFrame* previous, const GuiInputFrame* frame, int* x, int* y) {
+    *x = (int)frame->mouseDelta.x;
+    *y = (int)frame->mouseDelta.y;
+    return (float)*x == frame->mouseDelta.x && (float)*y == frame->mouseDelta.y &&
+        previous->mousePosition.x + (float)*x == frame->mousePosition.x && previous->mousePosition.y + (float)*y == frame->mousePosition.y;
+}
+
+/**
+ * Write a frame of input, and the hash of what was drawn after it, relative to the frame before.
+ */
+void WriteGuiRecordingFrame(GuiContainer* container, GuiInputRecording* recording, const GuiInputFrame* frame) {
+    const GuiInputFrame* previous = &recording->previous;
+    FILE* file = recording->file;
+    int flags = 0;
+    if (frame->frameTime != previous->frameTime) {
+        flags |= GUI_RECORDING_FRAME_TIME;
+    }
+    int moveX, moveY;
+    if (frame->mouseDelta.x != 0 || frame->mouseDelta.y != 0 || frame->mousePosition.x != previous->mousePosition.x ||
+        frame->mousePosition.y != previous->mousePosition.y) {
+        flags |= IsGuiMouseMoveWhole(previous, frame, &moveX, &moveY) ? GUI_RECORDING_MOUSE_MOVE : GUI_RECORDING_MOUSE_EXACT;
+    }
+    if (frame->mouseButtons != previous->mouseButtons) {
+        flags |= GUI_RECORDING_MOUSE_BUTTONS;
+    }
+    if (frame->mouseWheel != 0) {
+        flags |= GUI_RECORDING_MOUSE_WHEEL;
+    }
+    int changed = 0;
+    for (int i = 0; i < container->input->bindingCount; i++) {
+        if (frame->values[i] != previous->values[i] || frame->pressed[i] != previous->pressed[i]) {
+            changed++;
+        }
+    }
+    if (changed > 0) {
+        flags |= GUI_RECORDING_BINDINGS;
+    }
+    if (frame->charCount > 0) {
+        flags |= GUI_RECORDING_CHARS;
+    }
+    if (recording->drawn && (!recording->hashed || recording->drawHash != recording->recordedHash)) {
+        flags |= GUI_RECORDING_DRAW_HASH;
+    }
+
+    // Frames where nothing changed are counted, and written as a run.
+    if (flags == GUI_RECORDING_IDLE) {
+        recording->idleFrames++;
+        return;
+    }
+    if (recording->idleFrames > 0) {
+        fputc(GUI_RECORDING_IDLE, file);
+        WriteGuiVarint(file, (unsigned int)recording->idleFrames);
+        recording->idleFrames = 0;
+    }
+
+    fputc(flags, file);
+    if (flags & GUI_RECORDING_FRAME_TIME) {
+        fwrite(&frame->frameTime, sizeof(float), 1, file);
+    }
+    if (flags & GUI_RECORDING_MOUSE_MOVE) {
+        // Zigzag encode the moves, so small moves either way take a byte.
+        WriteGuiVarint(file, ((unsigned int)moveX << 1) ^ (unsigned int)(moveX >> 31));
+        WriteGuiVarint(file, ((unsigned int)moveY << 1) ^ (unsigned int)(moveY >> 31));
+    }
+    if (flags & GUI_RECORDING_MOUSE_EXACT) {
+        fwrite(&frame->mousePosition, sizeof(Vector2), 1, file);
+        fwrite(&frame->mouseDelta, sizeof(Vector2), 1, file);
+    }
+    if (flags & GUI_RECORDING_MOUSE_BUTTONS) {
+        WriteGuiVarint(file, frame->mouseButtons);
+    }
+    if (flags & GUI_RECORDING_MOUSE_WHEEL) {
+        fwrite(&frame->mouseWheel, sizeof(float), 1, file);
+    }
+    if (flags & GUI_RECORDING_BINDINGS) {
+        // Keys and buttons are held or not, so they take a byte. Axes take their value.
+        WriteGuiVarint(file, (unsigned int)changed);
+        for (int i = 0; i < container->input->bindingCount; i++) {
+            if (frame->values[i] == previous->values[i] && frame->pressed[i] == previous->pressed[i]) {
+                continue;
+            }
+            WriteGuiVarint(file, (unsigned int)i);
+            if (container->input->bindings[i].device == GUI_INPUT_GAMEPAD_AXIS) {
+                fwrite(frame->values + i, sizeof(float), 1, file);
+            }
+            else {
+                fputc((frame->values[i] > 0 ? 1 : 0) | (frame->pressed[i] ? 2 : 0), file);
+            }
+        }
+    }
+    if (flags & GUI_RECORDING_CHARS) {
+        WriteGuiVarint(file, (unsigned int)frame->charCount);
+        for (int i = 0; i < frame->charCount; i++) {
+            WriteGuiVarint(file, (unsigned int)frame->chars[i]);
+        }
+    }
+    if (flags & GUI_RECORDING_DRAW_HASH) {
+        fwrite(&recording->drawHash, sizeof(unsigned int), 1, file);
+        recording->recordedHash = recording->drawHash;
+        recording->hashed = true;
+    }
+}
+
+/**
+ * Read the next frame of a replay, relative to the frame before.
+ *
+ * @return false at the end of the recording.
+ */
+bool ReadGuiRecordingFrame(GuiContainer* container, GuiInputRecording* recording, GuiInputFrame* frame) {
+    // The mouse movement, the mouse wheel and typing only last a frame. The rest stays as it was.
+    *frame = recording->previous;
+    frame->mouseDelta = (Vector2){ 0, 0 };
+    frame->mouseWheel = 0;
+    frame->charCount = 0;
+    if (recording->idleFrames > 0) {
+        recording->idleFrames--;
+        return true;
+    }
+
+    FILE* file = recording->file;
+    int flags = fgetc(file);
+    if (flags == EOF) {
+        return false;
+    }
+    if (flags == GUI_RECORDING_IDLE) {
+        unsigned int count;
+        if (!ReadGuiVarint(file, &count) || count == 0) {
+            return false;
+        }
+        recording->idleFrames = (int)count - 1;
+        return true;
+    }
+
+    bool valid = true;
+    if (flags & GUI_RECORDING_FRAME_TIME) {
+        valid = valid && fread(&frame->frameTime, sizeof(float), 1, file) == 1;
+    }
+    if (flags & GUI_RECORDING_MOUSE_MOVE) {
+        unsigned int x = 0, y = 0;
+        valid = valid && ReadGuiVarint(file, &x) && ReadGuiVarint(file, &y);
+        frame->mouseDelta = (Vector2){ (float)(int)((x >> 1) ^ (0u - (x & 1))), (float)(int)((y >> 1) ^ (0u - (y & 1))) };
+        frame->mousePosition = (Vector2){ frame->mousePosition.x + frame->mouseDelta.x, frame->mousePosition.y + frame->mouseDelta.y };
+    }
+    if (flags & GUI_RECORDING_MOUSE_EXACT) {
+        valid = valid && fread(&frame->mousePosition, sizeof(Vector2), 1, file) == 1;
+        valid = valid && fread(&frame->mouseDelta, sizeof(Vector2), 1, file) == 1;
+    }
+    if (flags & GUI_RECORDING_MOUSE_BUTTONS) {
+        valid = valid && ReadGuiVarint(file, &frame->mouseButtons);
+    }
+    if (flags & GUI_RECORDING_MOUSE_WHEEL) {
+        valid = valid && fread(&frame->mouseWheel, sizeof(float), 1, file) == 1;
+    }
+    if (flags & GUI_RECORDING_BINDINGS) {
+        unsigned int changed = 0;
+        valid = valid && ReadGuiVarint(file, &changed);
+        for (unsigned int i = 0; i < changed && valid; i++) {
+            unsigned int binding = 0;
+            valid = ReadGuiVarint(file, &binding) && binding < (unsigned int)container->input->bindingCount;
+            if (!valid) {
+                break;
+            }
+            if (container->input->bindings[binding].device == GUI_INPUT_GAMEPAD_AXIS) {
+                valid = fread(frame->values + binding, sizeof(float), 1, file) == 1;
+            }
+            else {
+                int state = fgetc(file);
+                valid = state != EOF;
+                frame->values[binding] = (state & 1) ? 1.0f : 0.0f;
+                frame->pressed[binding] = (state & 2) != 0;
+            }
+        }
+    }
+    if (flags & GUI_RECORDING_CHARS) {
+        unsigned int count = 0;
+        valid = valid && ReadGuiVarint(file, &count) && count <= RAYGUI_CONTAINER_MAX_CHARS;
+        for (int i = 0; i < (int)count && valid; i++) {
+            unsigned int codepoint = 0;
+            valid = ReadGuiVarint(file, &codepoint);
+            frame->chars[frame->charCount++] = (int)codepoint;
+        }
+    }
+    if (flags & GUI_RECORDING_DRAW_HASH) {
+        valid = valid && fread(&recording->recordedHash, sizeof(unsigned int), 1, file) == 1;
+        recording->hashed = true;
+    }
+    return valid;
+}
+
+/**
+ * Start or restart the input state a recording is made or replayed from, so held keys repeat the same way.
+ */
+void ResetGuiRecordingInput(GuiContainer* container, GuiInputRecording* recording) {
+    GuiInput* input = container->input;
+    memset(input->held, 0, sizeof(input->held));
+    memset(input->down, 0, sizeof(input->down));
+    memset(recording, 0, sizeof(GuiInputRecording));
+    recording->mismatch = -1;
+    input->recording = recording;
+}
+
+/**
+ * Start streaming the input a container reads in each update to a file, stopping any recording or replay already
+ * going. With RAYGUI_STANDALONE, the hash of what's drawn after each update is recorded along with it, from the
+ * drawing functions' calls to HashGuiDraw().
+ *
+ * Each frame is stored relative to the one before, so a frame where nothing changed takes nothing, beyond a count of
+ * such frames. The recording can only be replayed by builds with the same byte order.
+ *
+ * @return false if the file couldn't be opened.
+ */
+bool StartGuiInputRecording(GuiContainer* container, const char* fileName) {
+    StopGuiInputRecording(container);
+    FILE* file = fopen(fileName, "wb");
+    if (file == NULL) {
+        return false;
+    }
+
+    GuiInput* input = container->input;
+    GuiRecordingHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, "rGIR", 4);
+    header.version = GUI_RECORDING_VERSION;
+    header.bindingCount = input->bindingCount;
+    header.source = input->source;
+    fwrite(&header, sizeof(header), 1, file);
+    fwrite(input->bindings, sizeof(GuiInputBinding), input->bindingCount, file);
+
+    ResetGuiRecordingInput(container, (GuiInputRecording*)MemAlloc(sizeof(GuiInputRecording)));
+    input->recording->file = file;
+    return true;
+}
+
+/**
+ * Drive a container from a recording instead of the input devices, one frame each update, until the recording ends.
+ * The container takes the bindings and input source it was recorded with. Start from the same elements and focus the
+ * recording started with, and draw the container after each update, as it was drawn while recording.
+ *
+ * raygui reads the mouse itself as it draws. With RAYGUI_STANDALONE, answer the mouse functions from
+ * GetGuiInputFrame() during a replay, so raygui sees the recorded mouse too.
+ *
+ * @return false if the file couldn't be read, or isn't a recording.
+ */
+bool StartGuiInputReplay(GuiContainer* container, const char* fileName) {
+    StopGuiInputRecording(container);
+    FILE* file = fopen(fileName, "rb");
+    if (file == NULL) {
+        return false;
+    }
+
+    GuiRecordingHeader header;
+    GuiInputBinding bindings[RAYGUI_CONTAINER_MAX_BINDINGS];
+    bool valid = fread(&header, sizeof(header), 1, file) == 1 && memcmp(header.magic, "rGIR", 4) == 0 &&
+        header.version == GUI_RECORDING_VERSION && header.bindingCount >= 0 && header.bindingCount <= RAYGUI_CONTAINER_MAX_BINDINGS &&
+        fread(bindings, sizeof(GuiInputBinding), header.bindingCount, file) == (size_t)header.bindingCount;
+    if (!valid) {
+        fclose(file);
+        return false;
+    }
+
+    GuiInput* input = container->input;
+    memcpy(input->bindings, bindings, header.bindingCount * sizeof(GuiInputBinding));
+    input->bindingCount = header.bindingCount;
+    input->source = header.source;
+    ResetGuiRecordingInput(container, (GuiInputRecording*)MemAlloc(sizeof(GuiInputRecording)));
+    input->recording->file = file;
+    input->recording->replaying = true;
+    return true;
+}
+
+/**
+ * Stop recording or replaying a container's input. A recording is written out to the end.
+ */
+void StopGuiInputRecording(GuiContainer* container) {
+    GuiInputRecording* recording = container->input->recording;
+    if (recording == NULL) {
+        return;
+    }
+
+    if (!recording->replaying) {
+        if (recording->pending) {
+            WriteGuiRecordingFrame(container, recording, &recording->next);
+        }
+        if (recording->idleFrames > 0) {
+            fputc(GUI_RECORDING_IDLE, recording->file);
+            WriteGuiVarint(recording->file, (unsigned int)recording->idleFrames);
+        }
+    }
+    if (recording->file != NULL) {
+        fclose(recording->file);
+    }
+    MemFree(recording);
+    container->input->recording = NULL;
+}
+
+/**
+ * Check whether a container is being driven by a replay that hasn't reached its end.
+ */
+bool IsGuiInputReplaying(GuiContainer* container) {
+    GuiInputRecording* recording = container->input->recording;
+    return recording != NULL && recording->replaying && !recording->ended;
+}
+
+/**
+ * Get the first frame of a replay that drew something other than what was drawn when it was recorded, as found with
+ * RAYGUI_STANDALONE.
+ *
+ * @return The frame, counted from 0, or -1 if every frame drew the same, or the container isn't replaying.
+ */
+int GetGuiInputReplayMismatch(GuiContainer* container) {
+    GuiInputRecording* recording = container->input->recording;
+    return recording != NULL && recording->replaying ? recording->mismatch : -1;
+}
+
+/**
+ * Add to the hash of what's drawn this frame, while a container that's recording or replaying is drawn. With
+ * RAYGUI_STANDALONE, call it from your drawing functions with what they draw, as you would the Record functions.
+ */
+void HashGuiDraw(const void* data, int size) {
+    if (!guiDrawHashing) {
+        return;
+    }
+
+    // FNV-1a
+    const unsigned char* bytes = (const unsigned char*)data;
+    for (int i = 0; i < size; i++) {
+        guiDrawHash = (guiDrawHash ^ bytes[i]) * 16777619u;
+    }
+    guiDrawHashed = true;
+}
+
+/**
+ * Start hashing what's drawn, if the container is being recorded or replayed.
+ */
+void BeginGuiDrawHash(GuiContainer* container) {
+    guiDrawHashing = container->input->recording != NULL;
+    guiDrawHash = 2166136261u;
+    guiDrawHashed = false;
+}
+
+/**
+ * Keep the hash of what was drawn for the frame being recorded, or compare it to the one that was recorded.
+ */
+void EndGuiDrawHash(GuiContainer* container) {
+    GuiInputRecording* recording = container->input->recording;
+    if (!guiDrawHashing || recording == NULL) {
+        return;
+    }
+
+    guiDrawHashing = false;
+    if (!guiDrawHashed) {
+        return;
+    }
+    if (!recording->replaying) {
+        recording->drawHash = guiDrawHash;
+        recording->drawn = true;
+    }
+    else if (!recording->ended && recording->hashed && guiDrawHash != recording->recordedHash && recording->mismatch < 0) {
+        recording->mismatch = recording->frame - 1;
+    }
+}
+
+/**
+ * Sample the keyboard, gamepads and mouse once, or read the next frame of a replay, and queue the actions they map to.
+ */
+void PollGuiContainerInput(GuiContainer* container) {
+    GuiInput* input = container->input;
+    GuiInputRecording* recording = input->recording;
+    if (recording != NULL && recording->replaying && !recording->ended) {
+        if (ReadGuiRecordingFrame(container, recording, &input->frame)) {
+            recording->previous = input->frame;
+            recording->frame++;
+        }
+        else {
+            recording->ended = true;
+            SampleGuiInputFrame(container, &input->frame);
+        }
+    }
+    else {
+        SampleGuiInputFrame(container, &input->frame);
+    }
+
+    // A recorded frame is written once the next one is polled, so it can take the hash of what was drawn after it.
+    if (recording != NULL && !recording->replaying) {
+        if (recording->pending) {
+            WriteGuiRecordingFrame(container, recording, &recording->next);
+            recording->previous = recording->next;
+        }
+        recording->next = input->frame;
+        recording->pending = true;
+        recording->drawn = false;
+        recording->frame++;
+    }
+
+    ApplyGuiInputFrame(container, &input->frame);
+}
+
+/**
+ * Get what the last update read from the input devices, or from a replay.
+ */
+const GuiInputFrame* GetGuiInputFrame(GuiContainer* container) {
+    return &container->input->frame;
+}
+
+/**
+ * The state of a nested container, which is owned by a group element in its parent.
+ *
+ * Elements in a nested container are positioned relative to the top left of its view, moved by the scroll offset.
+ */
+typedef struct GuiGroup {
+    GuiContainer* parent;
+    GuiElement element;         // The group element in the parent
+    int type;                   // The GuiGroupType
+    Rectangle content;          // The size of the scrollable content of a scroll panel
+    Rectangle view;             // The area the content is shown in, in the parent's coordinates
+    Vector2 scroll;
+    bool collapsed;
+} GuiGroup;
+
+/**
+ * Get the container the given container is nested in, at the top.
+ */
+GuiContainer* GetGuiRootContainer(GuiContainer* container) {
+    while (container->group != NULL) {
+        container = container->group->parent;
+    }
+    return container;
+}
+
+/**
+ * The callbacks and user data of a container's elements, indexed by handle index. They're allocated once the first
+ * is set, as most elements have neither.
+ */
+typedef struct GuiElementHandlers {
+    GuiEventCallback* callbacks;
+    void** userData;
+} GuiElementHandlers;
+
+GuiElementHandlers* GetGuiElementHandlers(GuiContainer* container) {
+    if (container->handlers == NULL) {
+        container->handlers = (GuiElementHandlers*)MemAlloc(sizeof(GuiElementHandlers));
+        container->handlers->callbacks = (GuiEventCallback*)MemAlloc(container->capacity * sizeof(GuiEventCallback));
+        container->handlers->userData = (void**)MemAlloc(container->capacity * sizeof(void*));
+        memset(container->handlers->callbacks, 0, container->capacity * sizeof(GuiEventCallback));
+        memset(container->handlers->userData, 0, container->capacity * sizeof(void*));
+    }
+    return container->handlers;
+}
+
+void ResizeGuiElementHandlers(GuiElementHandlers* handlers, int capacity) {
+    handlers->callbacks = (GuiEventCallback*)MemRealloc(handlers->callbacks, capacity * sizeof(GuiEventCallback));
+    handlers->userData = (void**)MemRealloc(handlers->userData, capacity * sizeof(void*));
+}
+
+void UnloadGuiElementHandlers(GuiElementHandlers* handlers) {
+    MemFree(handlers->callbacks);
+    MemFree(handlers->userData);
+    MemFree(handlers);
+}
+
+/**
+ * What a tween animates.
+ */
+enum GuiTweenType {
+    GUI_TWEEN_FOCUS = 0,        // The focus highlight's x, y, width and height, in screen coordinates
+    GUI_TWEEN_FADE,             // An element's alpha
+    GUI_TWEEN_PULSE             // How far the outline around a pressed element has grown, and its alpha
+};
+
+/**
+ * Up to four values animated from where they started to where they're going over a duration.
+ */
+typedef struct GuiTween {
+    float from[4];
+    float to[4];
+    float value[4];
+    float time;                 // The seconds since the tween started
+    float duration;
+    int type;                   // The GuiTweenType
+    GuiContainer* container;    // The container holding the animated element, or NULL for the focus highlight
+    int slot;                   // The handle index of the animated element
+} GuiTween;
+
+/**
+ * The animation state of a container, allocated once something in it is animated, as most containers never are.
+ *
+ * The tweens of a root container and of every container nested in it are kept together in the root container's pool,
+ * which an update advances in a single pass. Each container keeps the alphas of its own elements.
+ */
+typedef struct GuiAnimation {
+    GuiTween* tweens;
+    int tweenCount;
+    int tweenCapacity;
+    bool enabled;               // Whether the focus highlight is drawn, and pressed elements pulse
+    bool focusShown;            // Whether the focus highlight is on an element
+    Rectangle focusBounds;      // Where the focus highlight is, in screen coordinates
+    Rectangle focusTarget;      // Where the focused element is, which the focus highlight slides to
+    float* alphas;              // The alpha of each element, indexed by handle index, or NULL if none was faded
+    int* fades;                 // The fade tween of each element in the root container's pool, or -1, along with alphas
+} GuiAnimation;
+
+GuiAnimation* GetGuiAnimation(GuiContainer* container) {
+    if (container->animation == NULL) {
+        container->animation = (GuiAnimation*)MemAlloc(sizeof(GuiAnimation));
+        memset(container->animation, 0, sizeof(GuiAnimation));
+    }
+    return container->animation;
+}
+
+void ResizeGuiAnimation(GuiAnimation* animation, int previousCapacity, int capacity) {
+    if (animation->alphas != NULL) {
+        animation->alphas = (float*)MemRealloc(animation->alphas, capacity * sizeof(float));
+        animation->fades = (int*)MemRealloc(animation->fades, capacity * sizeof(int));
+        for (int i = previousCapacity; i < capacity; i++) {
+            animation->alphas[i] = 1.0f;
+            animation->fades[i] = -1;
+        }
+    }
+}
+
+/**
+ * Get the animation state of a container with its elements' alphas, which start out opaque the first time one is
+ * faded.
+ */
+GuiAnimation* GetGuiFadedAnimation(GuiContainer* container) {
+    GuiAnimation* animation = GetGuiAnimation(container);
+    if (animation->alphas == NULL) {
+        animation->alphas = (float*)MemAlloc(container->capacity * sizeof(float));
+        animation->fades = (int*)MemAlloc(container->capacity * sizeof(int));
+        for (int i = 0; i < container->capacity; i++) {
+            animation->alphas[i] = 1.0f;
+            animation->fades[i] = -1;
+        }
+    }
+    return animation;
+}
+
+void UnloadGuiAnimation(GuiAnimation* animation) {
+    MemFree(animation->tweens);
+    MemFree(animation->alphas);
+    MemFree(animation->fades);
+    MemFree(animation);
+}
+
+int GetGuiElementIndex(GuiContainer* container, GuiElement element);
+
+/**
+ * Call the given function for each of the element's events. Only the latest callback is kept, and NULL removes it.
+ */
+void SetGuiElementCallback(GuiContainer* container, GuiElement element, GuiEventCallback callback) {
+    if (GetGuiElementIndex(container, element) >= 0) {
+        GetGuiElementHandlers(container)->callbacks[element.index] = callback;
+    }
+}
+
+/**
+ * Attach a pointer to the element, which its events carry.
+ */
+void SetGuiElementUserData(GuiContainer* container, GuiElement element, void* userData) {
+    if (GetGuiElementIndex(container, element) >= 0) {
+        GetGuiElementHandlers(container)->userData[element.index] = userData;
+    }
+}
+
+void* GetGuiElementUserData(GuiContainer* container, GuiElement element) {
+    if (container->handlers == NULL || GetGuiElementIndex(container, element) < 0) {
+        return NULL;
+    }
+    return container->handlers->userData[element.index];
+}
+
+/**
+ * Add an event to the list of the root container, which the update that's running returns.
+ */
+void PushGuiEvent(GuiContainer* container, int element, GuiEventType type, float oldValue, float newValue) {
+    GuiInput* input = GetGuiRootContainer(container)->input;
+    if (input->eventCount == RAYGUI_CONTAINER_MAX_ACTIONS) {
+        return;
+    }
+
+    int slot = container->ids[element];
+    GuiEvent* event = input->events + input->eventCount;
+    event->type = type;
+    event->container = container;
+    event->element = (GuiElement){ slot, container->generations[slot] };
+    event->userData = container->handlers != NULL ? container->handlers->userData[slot] : NULL;
+    event->oldValue = oldValue;
+    event->newValue = newValue;
+    input->callbacks[input->eventCount++] = container->handlers != NULL ? container->handlers->callbacks[slot] : NULL;
+}
+
+/**
+ * Get what changed in the last update: the elements pressed, toggled or changed, and those that took focus, in the
+ * order it happened. A nested container gives the events of its root container.
+ *
+ * Changes made through the API, rather than by input, aren't listed.
+ */
+const GuiEvent* GetGuiContainerEvents(GuiContainer* container, int* count) {
+    GuiInput* input = GetGuiRootContainer(container)->input;
+    *count = input->eventCount;
+    return input->events;
+}
+
+/**
+ * The raygui style a container is drawn with, on top of raygui's own style and that of the containers it's nested in.
+ *
+ * raygui keeps its style and state in globals, so they're only changed while drawing, which happens on a single
+ * thread. Updating reads the overrides through GetGuiContainerStyle() instead, so it never writes to raygui.
+ */
+typedef struct GuiContainerStyle {
+    int controls[RAYGUI_CONTAINER_MAX_STYLES];
+    int properties[RAYGUI_CONTAINER_MAX_STYLES];
+    int values[RAYGUI_CONTAINER_MAX_STYLES];
+    int count;
+    int previous[RAYGUI_CONTAINER_MAX_STYLES][RAYGUI_MAX_CONTROLS];    // The values replaced while the container is drawn
+    bool previousLocked;
+    float previousAlpha;
+    bool locked;                // Whether raygui is locked while drawing, and input is ignored
+    float alpha;                // Multiplies raygui's alpha while drawing
+} GuiContainerStyle;
+
+/**
+ * Check whether a style override changes the given property: either the control's own, or DEFAULT's, which raygui
+ * applies to every control.
+ */
+bool IsGuiStyleOverride(GuiContainerStyle* style, int index, int control, int property) {
+    return style->properties[index] == property &&
+        (style->controls[index] == control || (style->controls[index] == DEFAULT && property < RAYGUI_MAX_PROPS_BASE));
+}
+
+/**
+ * Get a style property as the container is drawn with it, without changing raygui's style.
+ */
+int GetGuiContainerStyle(GuiContainer* container, int control, int property) {
+    // The innermost container wins, as its overrides are applied last. So do the last overrides of a container.
+    for (; container != NULL; container = container->group != NULL ? container->group->parent : NULL) {
+        GuiContainerStyle* style = container->style;
+        for (int i = style->count - 1; i >= 0; i--) {
+            if (IsGuiStyleOverride(style, i, control, property)) {
+                return style->values[i];
+            }
+        }
+    }
+    return GuiGetStyle(control, property);
+}
+
+/**
+ * Apply a container's style overrides, lock and alpha to raygui, keeping what they replace.
+ */
+void BeginGuiContainerStyle(GuiContainerStyle* style) {
+    for (int i = 0; i < style->count; i++) {
+        // Overriding a DEFAULT property sets it for every control, so every control's value is kept.
+        int controls = style->controls[i] == DEFAULT && style->properties[i] < RAYGUI_MAX_PROPS_BASE ? RAYGUI_MAX_CONTROLS : 1;
+        for (int control = 0; control < controls; control++) {
+            style->previous[i][control] = GuiGetStyle(controls > 1 ? control : style->controls[i], style->properties[i]);
+        }
+        GuiSetStyle(style->controls[i], style->properties[i], style->values[i]);
+    }
+
+    style->previousLocked = guiLocked;
+    style->previousAlpha = guiAlpha;
+    guiLocked = guiLocked || style->locked;
+    guiAlpha *= style->alpha;
+}
+
+/**
+ * Restore raygui's style and state from before BeginGuiContainerStyle().
+ */
+void EndGuiContainerStyle(GuiContainerStyle* style) {
+    guiLocked = style->previousLocked;
+    guiAlpha = style->previousAlpha;
+
+    for (int i = style->count - 1; i >= 0; i--) {
+        // Setting DEFAULT sets every control, so the other controls are restored after it.
+        int controls = style->controls[i] == DEFAULT && style->properties[i] < RAYGUI_MAX_PROPS_BASE ? RAYGUI_MAX_CONTROLS : 1;
+        for (int control = 0; control < controls; control++) {
+            GuiSetStyle(controls > 1 ? control : style->controls[i], style->properties[i], style->previous[i][control]);
+        }
+    }
+}
+
+/**
+ * Check whether a container, or one it's nested in, is locked.
+ */
+bool IsGuiContainerLocked(GuiContainer* container) {
+    for (; container != NULL; container = container->group != NULL ? container->group->parent : NULL) {
+        if (container->style->locked) {
+            return true;
+        }
+    }
+    return false;
+}
+
+#if defined(RAYGUI_CONTAINER_PROFILE)
+// The time in seconds, which raylib's GetTime() gives. Without raylib, it's the monotonic clock where <time.h> declares
+// it (POSIX), and clock() otherwise, which only counts the processor time of the program.
+#ifndef RAYGUI_CONTAINER_PROFILE_TIME
+#if defined(RAYGUI_STANDALONE)
+double GetGuiProfileTime(void) {
+#if defined(CLOCK_MONOTONIC)
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (double)time.tv_sec + (double)time.tv_nsec / 1e9;
+#else
+    return (double)clock() / CLOCKS_PER_SEC;
+#endif
+}
+#define RAYGUI_CONTAINER_PROFILE_TIME() GetGuiProfileTime()
+#else
+#define RAYGUI_CONTAINER_PROFILE_TIME() GetTime()
+#endif
+#endif
+
+/**
+ * A timed phase, as recorded in a container's ring buffer.
+ */
+typedef struct GuiProfileEvent {
+    double start;
+    float duration;
+    int phase;                  // The GuiProfilePhase
+    int count;                  // What the phase went through: the nodes, actions, elements or searches
+} GuiProfileEvent;
+
+/**
+ * The counters of a root container, and the last RAYGUI_CONTAINER_PROFILE_EVENTS phases it timed. Nested containers
+ * record into their root container, which is only updated by one thread at a time.
+ */
+typedef struct GuiProfile {
+    GuiProfileCounters counters;
+    GuiProfileEvent events[RAYGUI_CONTAINER_PROFILE_EVENTS];
+    long long eventCount;       // The number of phases timed, of which the last RAYGUI_CONTAINER_PROFILE_EVENTS are kept
+} GuiProfile;
+
+GuiProfile* GetGuiProfile(GuiContainer* container) {
+    return GetGuiRootContainer(container)->profile;
+}
+
+/**
+ * Record the time spent in a phase, which started at the given time.
+ */
+void EndGuiProfilePhase(GuiContainer* container, int phase, double start, long long count) {
+    GuiProfile* profile = GetGuiProfile(container);
+    double duration = RAYGUI_CONTAINER_PROFILE_TIME() - start;
+    profile->counters.phaseTime[phase] += duration;
+
+    GuiProfileEvent* event = profile->events + profile->eventCount++ % RAYGUI_CONTAINER_PROFILE_EVENTS;
+    event->start = start;
+    event->duration = (float)duration;
+    event->phase = phase;
+    event->count = (int)count;
+}
+
+// Time a phase, or add to a counter, of the root of the given container. Without RAYGUI_CONTAINER_PROFILE, these
+// compile to nothing, and their arguments aren't evaluated.
+#define GUI_PROFILE_BEGIN(start) double start = RAYGUI_CONTAINER_PROFILE_TIME()
+#define GUI_PROFILE_END(container, phase, start, count) EndGuiProfilePhase(container, phase, start, count)
+#define GUI_PROFILE_COUNT(container, counter, amount) (GetGuiProfile(container)->counters.counter += (amount))
+#else
+#define GUI_PROFILE_BEGIN(start)
+#define GUI_PROFILE_END(container, phase, start, count)
+#define GUI_PROFILE_COUNT(container, counter, amount)
+#endif
+
+/**
+ * A string held in a container's string arena.
+ */
+typedef struct GuiString {
+    char* text;                 // The string, in one of the arena's blocks
+    int length;
+    unsigned int hash;
+    int references;             // The number of element texts using the string, or 0 if it's only kept for its size
+    Vector2 size;               // The measured size, which is current if measured is the arena's epoch
+    unsigned int measured;
+} GuiString;
+
+/**
+ * The text of a container's elements, interned so each distinct string is stored once, along with the sizes raygui
+ * measured for it.
+ *
+ * Strings are copied into blocks that are never moved, so their addresses stay the same while they're referenced.
+ * Strings that are no longer referenced stay in the arena, as sizes are still cached for them, until they take up more
+ * than the referenced ones, when the referenced strings are copied into a new block and the old blocks are freed.
+ */
+typedef struct GuiStringArena {
+    char** blocks;
+    int blockCount;
+    int blockCapacity;
+    int blockSize;              // The size of the last block
+    int blockUsed;              // The bytes used in the last block
+    GuiString* strings;
+    int stringCount;
+    int stringCapacity;
+    int* table;                 // Open addressed hash table of string indices, with -1 for empty buckets
+    int tableMask;
+    int usedBytes;              // The bytes taken by every string in the arena
+    int liveBytes;              // The bytes taken by the referenced strings
+    Font font;                  // What the cached sizes were measured with
+    float fontSize;
+    float spacing;
+    unsigned int epoch;         // Incremented when the font, size or spacing change, which invalidates every size
+    bool mapped;                // Whether the strings and table point into a loaded container file
+} GuiStringArena;
+
+// The arena of the container being drawn, whose sizes answer raygui's text measurements.
+static GuiStringArena* guiTextArena = NULL;
+
+GuiStringArena* InitGuiStringArena(void) {
+    GuiStringArena* arena = (GuiStringArena*)MemAlloc(sizeof(GuiStringArena));
+    memset(arena, 0, sizeof(GuiStringArena));
+    arena->epoch = 1;
+    return arena;
+}
+
+void UnloadGuiStringArena(GuiStringArena* arena) {
+    for (int i = 0; i < arena->blockCount; i++) {
+        MemFree(arena->blocks[i]);
+    }
+    MemFree(arena->blocks);
+    if (!arena->mapped) {
+        MemFree(arena->strings);
+        MemFree(arena->table);
+    }
+    MemFree(arena);
+}
+
+/**
+ * Copy the strings and table of a loaded container out of its file, so they can grow. The text stays in the file.
+ */
+void DetachGuiStringArena(GuiStringArena* arena) {
+    if (!arena->mapped) {
+        return;
+    }
+
+    GuiString* strings = (GuiString*)MemAlloc(arena->stringCapacity * sizeof(GuiString));
+    memcpy(strings, arena->strings, arena->stringCount * sizeof(GuiString));
+    int* table = (int*)MemAlloc((arena->tableMask + 1) * sizeof(int));
+    memcpy(table, arena->table, (arena->tableMask + 1) * sizeof(int));
+    arena->strings = strings;
+    arena->table = table;
+    arena->mapped = false;
+}
+
+/**
+ * FNV-1a hash of a string, which also gives its length.
+ */
+unsigned int HashGuiString(const char* text, int* length) {
+    unsigned int hash = 2166136261u;
+    int i = 0;
+    for (; text[i] != '\0'; i++) {
+        hash = (hash ^ (unsigned char)text[i]) * 16777619u;
+    }
+    *length = i;
+    return hash;
+}
+
+/**
+ * Find the bucket holding the given string, or the empty bucket it would go in.
+ */
+int FindGuiStringBucket(GuiStringArena* arena, const char* text, int length, unsigned int hash) {
+    int bucket = (int)(hash & (unsigned int)arena->tableMask);
+    while (arena->table[bucket] >= 0) {
+        GuiString* string = arena->strings + arena->table[bucket];
+        if (string->hash == hash && string->length == length && memcmp(string->text, text, length) == 0) {
+            break;
+        }
+        bucket = (bucket + 1) & arena->tableMask;
+    }
+    return bucket;
+}
+
+/**
+ * Find a string in the arena.
+ *
+ * @return The index of the string, or -1 if it isn't in the arena.
+ */
+int FindGuiString(GuiStringArena* arena, const char* text, int length, unsigned int hash) {
+    if (arena->table == NULL) {
+        return -1;
+    }
+
+    return arena->table[FindGuiStringBucket(arena, text, length, hash)];
+}
+
+/**
+ * Rebuild the hash table with room for twice the strings it holds.
+ */
+void RehashGuiStringArena(GuiStringArena* arena, int capacity) {
+    MemFree(arena->table);
+    arena->table = (int*)MemAlloc(capacity * sizeof(int));
+    arena->tableMask = capacity - 1;
+    memset(arena->table, -1, capacity * sizeof(int));
+    for (int i = 0; i < arena->stringCount; i++) {
+        GuiString* string = arena->strings + i;
+        arena->table[FindGuiStringBucket(arena, string->text, string->length, string->hash)] = i;
+    }
+}
+
+/**
+ * Copy a string into the last block, starting a new block if it doesn't fit.
+ */
+char* CopyGuiStringToArena(GuiStringArena* arena, const char* text, int length) {
+    if (arena->blockCount == 0 || arena->blockUsed + length + 1 > arena->blockSize) {
+        if (arena->blockCount == arena->blockCapacity) {
+            arena->blockCapacity = arena->blockCapacity == 0 ? 4 : arena->blockCapacity * 2;
+            arena->blocks = (char**)MemRealloc(arena->blocks, arena->blockCapacity * sizeof(char*));
+        }
+        arena->blockSize = length + 1 > RAYGUI_CONTAINER_STRING_BLOCK_SIZE ? length + 1 : RAYGUI_CONTAINER_STRING_BLOCK_SIZE;
+        arena->blocks[arena->blockCount++] = (char*)MemAlloc(arena->blockSize);
+        arena->blockUsed = 0;
+    }
+
+    char* copy = arena->blocks[arena->blockCount - 1] + arena->blockUsed;
+    memcpy(copy, text, length);
+    copy[length] = '\0';
+    arena->blockUsed += length + 1;
+    arena->usedBytes += length + 1;
+    return copy;
+}
+
+/**
+ * Find a string in the arena, copying it in if it isn't there yet.
+ *
+ * @return The index of the string.
+ */
+int AddGuiString(GuiStringArena* arena, const char* text, int length, unsigned int hash) {
+    int index = FindGuiString(arena, text, length, hash);
+    if (index >= 0) {
+        return index;
+    }
+    DetachGuiStringArena(arena);
+
+    // Keep the table at most half full.
+    if (arena->table == NULL || (arena->stringCount + 1) * 2 > arena->tableMask + 1) {
+        RehashGuiStringArena(arena, arena->table == NULL ? 16 : (arena->tableMask + 1) * 2);
+    }
+    if (arena->stringCount == arena->stringCapacity) {
+        arena->stringCapacity = arena->stringCapacity == 0 ? 16 : arena->stringCapacity * 2;
+        arena->strings = (GuiString*)MemRealloc(arena->strings, arena->stringCapacity * sizeof(GuiString));
+    }
+
+    index = arena->stringCount++;
+    GuiString* string = arena->strings + index;
+    string->text = CopyGuiStringToArena(arena, text, length);
+    string->length = length;
+    string->hash = hash;
+    string->references = 0;
+    string->measured = 0;
+    arena->table[FindGuiStringBucket(arena, text, length, hash)] = index;
+    return index;
+}
+
+/**
+ * Take a reference to a copy of the text in the arena.
+ *
+ * @return The copy, which stays valid until the reference is released, or NULL if text is NULL.
+ */
+const char* InternGuiString(GuiStringArena* arena, const char* text) {
+    if (text == NULL) {
+        return NULL;
+    }
+
+    int length;
+    unsigned int hash = HashGuiString(text, &length);
+    int index = AddGuiString(arena, text, length, hash);
+    GuiString* string = arena->strings + index;
+    if (string->references++ == 0) {
+        arena->liveBytes += length + 1;
+    }
+    return string->text;
+}
+
+/**
+ * Release a reference taken by InternGuiString(). The string is kept until the arena is compacted.
+ */
+void ReleaseGuiString(GuiStringArena* arena, const char* text) {
+    if (text == NULL) {
+        return;
+    }
+
+    int length;
+    unsigned int hash = HashGuiString(text, &length);
+    int index = FindGuiString(arena, text, length, hash);
+    if (index >= 0 && --arena->strings[index].references == 0) {
+        arena->liveBytes -= length + 1;
+    }
+}
+
+/**
+ * Free the strings that are no longer referenced, once they take up more of the arena than the referenced ones.
+ *
+ * The referenced strings move, so this is only called outside of drawing, while raygui doesn't hold any of them.
+ */
+void CompactGuiStringArena(GuiContainer* container) {
+    GuiStringArena* arena = container->strings;
+    int deadBytes = arena->usedBytes - arena->liveBytes;
+    if (deadBytes <= arena->liveBytes || deadBytes < RAYGUI_CONTAINER_STRING_BLOCK_SIZE) {
+        return;
+    }
+    DetachGuiStringArena(arena);
+
+    // Copy the referenced strings into new blocks, keeping the old ones until the elements point at the copies.
+    char** blocks = arena->blocks;
+    int blockCount = arena->blockCount;
+    arena->blocks = NULL;
+    arena->blockCount = 0;
+    arena->blockCapacity = 0;
+    arena->usedBytes = 0;
+    int count = 0;
+    for (int i = 0; i < arena->stringCount; i++) {
+        GuiString string = arena->strings[i];
+        if (string.references > 0) {
+            string.text = CopyGuiStringToArena(arena, string.text, string.length);
+            arena->strings[count++] = string;
+        }
+    }
+    arena->stringCount = count;
+    RehashGuiStringArena(arena, arena->tableMask + 1);
+
+    for (int i = 0; i < container->count; i++) {
+        GuiElementState* state = container->states + i;
+        int length;
+        if (state->text != NULL) {
+            unsigned int hash = HashGuiString(state->text, &length);
+            state->text = arena->strings[FindGuiString(arena, state->text, length, hash)].text;
+        }
+        const char** textRight = GetGuiElementTextRight(container, i);
+        if (textRight != NULL && *textRight != NULL) {
+            unsigned int hash = HashGuiString(*textRight, &length);
+            *textRight = arena->strings[FindGuiString(arena, *textRight, length, hash)].text;
+        }
+    }
+
+    for (int i = 0; i < blockCount; i++) {
+        MemFree(blocks[i]);
+    }
+    MemFree(blocks);
+
+#if defined(RAYGUI_CONTAINER_RETAINED)
+    // The draw cache compares text by address, and new strings may now be given the addresses of the freed ones.
+    if (container->drawCache != NULL) {
+        InvalidateGuiContainerDrawCache(container);
+    }
+#endif
+}
+
+#if defined(RAYGUI_CONTAINER_TEXT_CACHE)
+/**
+ * Check that the arena's sizes were measured with the given font, size and spacing, invalidating them if not.
+ */
+void CheckGuiStringArenaFont(GuiStringArena* arena, Font font, float fontSize, float spacing) {
+    if (arena->fontSize != fontSize || arena->spacing != spacing || memcmp(&arena->font, &font, sizeof(Font)) != 0) {
+        arena->font = font;
+        arena->fontSize = fontSize;
+        arena->spacing = spacing;
+        arena->epoch++;
+    }
+}
+
+/**
+ * Look up the size of text measured while drawing the current container.
+ *
+ * @return Whether the size was found.
+ */
+bool FindGuiTextSize(Font font, const char* text, float fontSize, float spacing, Vector2* size) {
+    GuiStringArena* arena = guiTextArena;
+    if (arena == NULL || text == NULL) {
+        return false;
+    }
+
+    CheckGuiStringArenaFont(arena, font, fontSize, spacing);
+    int length;
+    unsigned int hash = HashGuiString(text, &length);
+    int index = FindGuiString(arena, text, length, hash);
+    if (index < 0 || arena->strings[index].measured != arena->epoch) {
+        return false;
+    }
+
+    *size = arena->strings[index].size;
+    return true;
+}
+
+/**
+ * Keep the size of text measured while drawing the current container. Text that isn't an element's, like the rows of
+ * a list view, or a label after its icon, is added to the arena.
+ */
+void CacheGuiTextSize(Font font, const char* text, float fontSize, float spacing, Vector2 size) {
+    GuiStringArena* arena = guiTextArena;
+    if (arena == NULL || text == NULL) {
+        return;
+    }
+
+    CheckGuiStringArenaFont(arena, font, fontSize, spacing);
+    int length;
+    unsigned int hash = HashGuiString(text, &length);
+    int index = AddGuiString(arena, text, length, hash);
+    GuiString* string = arena->strings + index;
+    string->size = size;
+    string->measured = arena->epoch;
+}
+
+#if !defined(RAYGUI_STANDALONE)
+Vector2 MeasureGuiText(Font font, const char* text, float fontSize, float spacing) {
+    Vector2 size;
+    if (!FindGuiTextSize(font, text, fontSize, spacing, &size)) {
+        size = (MeasureTextEx)(font, text, fontSize, spacing);
+        CacheGuiTextSize(font, text, fontSize, spacing, size);
+    }
+    return size;
+}
+#endif
+#endif
+
+/**
+ * Where a container is drawn: the screen position of its origin, and the area of the screen it's clipped to.
+ */
+typedef struct GuiDrawRegion {
+    Vector2 origin;
+    Rectangle clip;
+    bool scissor;               // Whether the clip is applied with BeginScissorMode()
+} GuiDrawRegion;
+
+Rectangle OffsetGuiRectangle(Rectangle rectangle, Vector2 offset) {
+    return (Rectangle){ rectangle.x + offset.x, rectangle.y + offset.y, rectangle.width, rectangle.height };
+}
+
+/**
+ * The state of a list view, whose rows are supplied by callbacks rather than stored.
+ *
+ * Only the text of the rows in view is held, while the list is drawn, so a list costs the same with 100 rows as with
+ * 100k.
+ */
+typedef struct GuiList {
+    GuiListCountCallback getCount;
+    GuiListTextCallback getText;
+    void* userData;
+    int scrollIndex;            // The first row in view
+    int focus;                  // The row that has focus while the list does
+    int active;                 // The selected row, or -1
+    const char** visibleText;   // The text of the rows in view, while the list is drawn
+    int* visibleOffsets;        // The offset of each row's text in textBuffer
+    int visibleCapacity;
+    char* textBuffer;           // Copies of the rows' text, which may be overwritten by the next callback
+    int textCapacity;
+} GuiList;
+
+GuiList* InitGuiList(GuiListCountCallback getCount, GuiListTextCallback getText, void* userData) {
+    GuiList* list = (GuiList*)MemAlloc(sizeof(GuiList));
+    list->getCount = getCount;
+    list->getText = getText;
+    list->userData = userData;
+    list->scrollIndex = 0;
+    list->focus = 0;
+    list->active = -1;
+    list->visibleText = NULL;
+    list->visibleOffsets = NULL;
+    list->visibleCapacity = 0;
+    list->textBuffer = NULL;
+    list->textCapacity = 0;
+    return list;
+}
+
+void UnloadGuiList(GuiList* list) {
+    MemFree(list->visibleText);
+    MemFree(list->visibleOffsets);
+    MemFree(list->textBuffer);
+    MemFree(list);
+}
+
+/**
+ * Get the number of rows a list view of the given height shows, using raygui's LISTVIEW style.
+ */
+int GetGuiListVisibleRows(GuiContainer* container, Rectangle bounds) {
+    return (int)bounds.height / (GetGuiContainerStyle(container, LISTVIEW, LIST_ITEMS_HEIGHT) + GetGuiContainerStyle(container, LISTVIEW, LIST_ITEMS_SPACING));
+}
+
+/**
+ * Keep a list's rows in range of its row count, which may have changed since it was last used.
+ *
+ * @return The number of rows.
+ */
+int ClampGuiList(GuiList* list, int visibleRows) {
+    int count = list->getCount(list->userData);
+    if (list->active >= count) {
+        list->active = -1;
+    }
+    if (list->focus >= count) {
+        list->focus = count - 1;
+    }
+    if (list->focus < 0) {
+        list->focus = 0;
+    }
+    if (list->scrollIndex > count - visibleRows) {
+        list->scrollIndex = count - visibleRows;
+    }
+    if (list->scrollIndex < 0) {
+        list->scrollIndex = 0;
+    }
+    return count;
+}
+
+/**
+ * Scroll a list so its focused row is in view.
+ */
+void ScrollGuiListToFocus(GuiList* list, int visibleRows) {
+    if (list->focus < list->scrollIndex) {
+        list->scrollIndex = list->focus;
+    }
+    else if (visibleRows > 0 && list->focus >= list->scrollIndex + visibleRows) {
+        list->scrollIndex = list->focus - visibleRows + 1;
+    }
+}
+
+/**
+ * Move a list's focus once it takes focus from navigation: to the first row in view when moving down onto it, and to
+ * the last row in view when moving up onto it.
+ *
+ * @param direction The GuiDirection focus moved in, or -1.
+ */
+void EnterGuiList(GuiContainer* container, GuiList* list, Rectangle bounds, int direction) {
+    int visibleRows = GetGuiListVisibleRows(container, bounds);
+    int count = ClampGuiList(list, visibleRows);
+    if (direction == DOWN) {
+        list->focus = list->scrollIndex;
+    }
+    else if (direction == UP) {
+        list->focus = (list->scrollIndex + visibleRows < count ? list->scrollIndex + visibleRows : count) - 1;
+    }
+    ClampGuiList(list, visibleRows);
+    ScrollGuiListToFocus(list, visibleRows);
+}
+
+/**
+ * Move a list's focus by the given number of rows, scrolling to keep it in view.
+ *
+ * @return False if the focus was already on the first or last row in that direction, so focus should leave the list.
+ */
+bool MoveGuiListFocus(GuiContainer* container, GuiList* list, Rectangle bounds, int rows) {
+    int visibleRows = GetGuiListVisibleRows(container, bounds);
+    int count = ClampGuiList(list, visibleRows);
+    if (count == 0 || (rows < 0 && list->focus == 0) || (rows > 0 && list->focus == count - 1)) {
+        return false;
+    }
+
+    list->focus += rows;
+    ClampGuiList(list, visibleRows);
+    ScrollGuiListToFocus(list, visibleRows);
+    return true;
+}
+
+/**
+ * Get the bounds of the rows of a list view, which are drawn beside raygui's scroll bar rather than under it.
+ */
+Rectangle GetGuiListRowBounds(GuiContainer* container, Rectangle bounds, bool scrollBar) {
+    if (scrollBar) {
+        bounds.width -= (float)(GetGuiContainerStyle(container, LISTVIEW, BORDER_WIDTH) + GetGuiContainerStyle(container, LISTVIEW, SCROLLBAR_WIDTH));
+    }
+    return bounds;
+}
+
+/**
+ * Find the row of a list view under the given point, with the list drawn at the given bounds.
+ *
+ * @return The row, or -1 if there is none.
+ */
+int FindGuiListRowAtPoint(GuiContainer* container, GuiList* list, Rectangle bounds, Vector2 point) {
+    int visibleRows = GetGuiListVisibleRows(container, bounds);
+    int count = ClampGuiList(list, visibleRows);
+    Rectangle rows = GetGuiListRowBounds(container, bounds, count > visibleRows);
+    if (!CheckCollisionPointRec(point, rows)) {
+        return -1;
+    }
+
+    float top = rows.y + (float)(GetGuiContainerStyle(container, LISTVIEW, LIST_ITEMS_SPACING) + GetGuiContainerStyle(container, DEFAULT, BORDER_WIDTH));
+    int row = (int)floorf((point.y - top) / (float)(GetGuiContainerStyle(container, LISTVIEW, LIST_ITEMS_HEIGHT) + GetGuiContainerStyle(container, LISTVIEW, LIST_ITEMS_SPACING)));
+    if (row < 0 || row >= visibleRows || list->scrollIndex + row >= count) {
+        return -1;
+    }
+    return list->scrollIndex + row;
+}
+
+/**
+ * Scroll a list by the given number of rows, up for positive rows as the mouse wheel does, if the point is on it.
+ */
+void ScrollGuiList(GuiContainer* container, GuiList* list, Rectangle bounds, Vector2 point, int rows) {
+    if (CheckCollisionPointRec(point, bounds)) {
+        list->scrollIndex -= rows;
+        ClampGuiList(list, GetGuiListVisibleRows(container, bounds));
+    }
+}
+
+/**
+ * Scroll a list to where the mouse is held down on its scroll bar, as raygui's scroll bar does, with the slider
+ * centered on the mouse.
+ */
+void DragGuiListScrollBar(GuiContainer* container, GuiList* list, Rectangle bounds, Vector2 point) {
+    int visibleRows = GetGuiListVisibleRows(container, bounds);
+    int count = ClampGuiList(list, visibleRows);
+    if (count <= visibleRows) {
+        return;
+    }
+
+    // The bar is right of the rows, and its track is between its arrows, if they're shown.
+    int border = GetGuiContainerStyle(container, SCROLLBAR, BORDER_WIDTH);
+    float width = (float)GetGuiContainerStyle(container, LISTVIEW, SCROLLBAR_WIDTH);
+    float arrows = GetGuiContainerStyle(container, SCROLLBAR, ARROWS_VISIBLE) ? width - (float)(2 * border) : 0;
+    Rectangle bar = GetGuiListRowBounds(container, bounds, true);
+    Rectangle track = {
+        bar.x + bar.width + (float)border, bounds.y + (float)(GetGuiContainerStyle(container, LISTVIEW, BORDER_WIDTH) + border) + arrows,
+        width - (float)(2 * border), bounds.height - (float)(2 * (GetGuiContainerStyle(container, DEFAULT, BORDER_WIDTH) + border)) - 2 * arrows
+    };
+    if (!CheckCollisionPointRec(point, track)) {
+        return;
+    }
+
+    float sliderSize = (float)(int)(bounds.height * (float)visibleRows / (float)count);
+    if (sliderSize >= track.height) {
+        sliderSize = (float)((int)track.height - 2);
+    }
+    list->scrollIndex = (int)((point.y - track.y - sliderSize / 2) * (float)(count - visibleRows) / (track.height - sliderSize));
+    ClampGuiList(list, visibleRows);
+}
+
+/**
+ * Draw a list view through GuiListViewEx(), asking for the text of the rows in view only.
+ *
+ * raygui indexes the text by row, from the first row, so it's called twice, with raygui locked, as the mouse wheel and
+ * scroll bar are handled by the container. The first call is given the row count without any text, and draws the
+ * frame and scroll bar. The second is given just the rows in view, and draws them with the list's focus and selection.
+ */
+void DrawGuiList(GuiContainer* container, GuiList* list, Rectangle bounds, bool focused) {
+    int visibleRows = GetGuiListVisibleRows(container, bounds);
+    int count = ClampGuiList(list, visibleRows);
+    bool locked = guiLocked;
+    guiLocked = true;
+    GuiListViewEx(bounds, NULL, count, NULL, &list->scrollIndex, -1);
+
+    int shown = count - list->scrollIndex < visibleRows ? count - list->scrollIndex : visibleRows;
+    if (shown > list->visibleCapacity) {
+        list->visibleCapacity = shown;
+        list->visibleText = (const char**)MemRealloc(list->visibleText, shown * sizeof(const char*));
+        list->visibleOffsets = (int*)MemRealloc(list->visibleOffsets, shown * sizeof(int));
+    }
+
+    // Copy each row's text, so the callback can return a temporary buffer, like TextFormat() does.
+    int textSize = 0;
+    for (int i = 0; i < shown; i++) {
+        const char* text = list->getText(list->scrollIndex + i, list->userData);
+        int length = text != NULL ? (int)strlen(text) : 0;
+        if (textSize + length + 1 > list->textCapacity) {
+            while (textSize + length + 1 > list->textCapacity) {
+                list->textCapacity = list->textCapacity == 0 ? 1024 : list->textCapacity * 2;
+            }
+            list->textBuffer = (char*)MemRealloc(list->textBuffer, list->textCapacity);
+        }
+        memcpy(list->textBuffer + textSize, text != NULL ? text : "", length);
+        list->textBuffer[textSize + length] = '\0';
+        list->visibleOffsets[i] = textSize;
+        textSize += length + 1;
+    }
+    for (int i = 0; i < shown; i++) {
+        list->visibleText[i] = list->textBuffer + list->visibleOffsets[i];
+    }
+
+    int focus = focused ? list->focus - list->scrollIndex : -1;
+    int active = list->active >= list->scrollIndex ? list->active - list->scrollIndex : -1;
+    GuiListViewEx(GetGuiListRowBounds(container, bounds, count > visibleRows), list->visibleText, shown, &focus, NULL, active);
+    guiLocked = locked;
+}
+
+// Groups draw their nested container, which draws its own groups in turn.
+void DrawGuiGroup(GuiContainer* container, int element, GuiDrawRegion region);
+
+/**
+ * Set raygui's alpha for the given element. A faded element multiplies the container's alpha by its own, and the
+ * containers without faded elements leave it be.
+ */
+void SetGuiElementDrawAlpha(GuiContainer* container, int element) {
+    GuiAnimation* animation = container->animation;
+    if (animation != NULL && animation->alphas != NULL) {
+        guiAlpha = container->style->previousAlpha * container->style->alpha * animation->alphas[container->ids[element]];
+    }
+}
+
+/**
+ * Set raygui's state for the given element, based on whether it has focus, and its alpha.
+ */
+void SetGuiElementDrawState(GuiContainer* container, int element) {
+    SetGuiElementDrawAlpha(container, element);
+
+    // Flip raygui's GUI focus state based on the active element.
+    if (container->activeElement == element) {
+        // If we're focus locked, use the pressed state.
+        if (container->focusLocked) {
+            guiState = STATE_PRESSED;
+        }
+        else {
+            guiState = STATE_FOCUSED;
+        }
+    }
+    else {
+        guiState = STATE_NORMAL;
+    }
+}
+
+/**
+ * Get the hue of a color, in degrees, or the given hue for a gray, which has none.
+ */
+float GetGuiColorHue(Color color, float gray) {
+    float r = color.r / 255.0f;
+    float g = color.g / 255.0f;
+    float b = color.b / 255.0f;
+    float max = r > g ? (r > b ? r : b) : (g > b ? g : b);
+    float min = r < g ? (r < b ? r : b) : (g < b ? g : b);
+    float chroma = max - min;
+    if (chroma <= 0) {
+        return gray;
+    }
+
+    float hue = max == r ? (g - b) / chroma : max == g ? 2.0f + (b - r) / chroma : 4.0f + (r - g) / chroma;
+    return hue < 0 ? hue * 60.0f + 360.0f : hue * 60.0f;
+}
+
+/**
+ * Give a color the given hue, in degrees, keeping its saturation, value and alpha.
+ */
+Color SetGuiColorHue(Color color, float hue) {
+    float max = (float)(color.r > color.g ? (color.r > color.b ? color.r : color.b) : (color.g > color.b ? color.g : color.b));
+    float min = (float)(color.r < color.g ? (color.r < color.b ? color.r : color.b) : (color.g < color.b ? color.g : color.b));
+    float chroma = max - min;
+    float sector = hue / 60.0f;
+    float half = sector - 2.0f * (float)(int)(sector / 2.0f);
+    float x = chroma * (1.0f - (half > 1.0f ? half - 1.0f : 1.0f - half));
+
+    float rgb[3] = { 0, 0, 0 };
+    int first = (int)sector % 6;
+    static const int major[6] = { 0, 1, 1, 2, 2, 0 };
+    static const int minor[6] = { 1, 0, 2, 1, 0, 2 };
+    rgb[major[first]] = chroma;
+    rgb[minor[first]] = x;
+    return (Color){ (unsigned char)(rgb[0] + min + 0.5f), (unsigned char)(rgb[1] + min + 0.5f), (unsigned char)(rgb[2] + min + 0.5f), color.a };
+}
+
+/**
+ * Get the items of a toggle group, combo box or dropdown box, split out of its text the first time they're drawn and
+ * kept until the text changes, so raygui doesn't split the text each frame. The element owns them, in one allocation.
+ */
+const char** GetGuiChoiceItems(GuiContainer* container, int element) {
+    GuiElementState* state = container->states + element;
+    if (state->choice.items != NULL || state->choice.count == 0) {
+        return state->choice.items;
+    }
+
+    // A combo box also keeps the text it's drawn with after its items, which is never longer than its own text plus a
+    // separator per item.
+    int length = (int)strlen(state->text);
+    int shown = container->types[element] == GUI_TYPE_COMBOBOX ? length + state->choice.count : 0;
+    char** items = (char**)MemAlloc(state->choice.count * sizeof(char*) + length + 1 + shown);
+    char* text = (char*)(items + state->choice.count);
+    memcpy(text, state->text, length + 1);
+    int count = 0;
+    items[count++] = text;
+    for (char* c = text; *c != '\0'; c++) {
+        if (*c == ';' || *c == '\n') {
+            *c = '\0';
+            items[count++] = c + 1;
+        }
+    }
+    state->choice.items = (const char**)items;
+    state->choice.shown = -1;
+    return state->choice.items;
+}
+
+/**
+ * Get the text a combo box is drawn with: its chosen item in its place among empty items, so GuiComboBox() shows the
+ * item and its position without splitting every item each frame. It's kept after the items, and only built again when
+ * the chosen item changes.
+ */
+const char* GetGuiComboBoxText(GuiContainer* container, int element) {
+    GuiChoiceState* choice = &container->states[element].choice;
+    const char** items = GetGuiChoiceItems(container, element);
+    if (items == NULL) {
+        return "";
+    }
+
+    const char* last = items[choice->count - 1];
+    char* text = (char*)last + strlen(last) + 1;
+    if (choice->shown != choice->active) {
+        char* c = text;
+        for (int i = 0; i < choice->count; i++) {
+            if (i > 0) {
+                *c++ = ';';
+            }
+            if (i == choice->active) {
+                size_t length = strlen(items[i]);
+                memcpy(c, items[i], length);
+                c += length;
+            }
+        }
+        *c = '\0';
+        choice->shown = choice->active;
+    }
+    return text;
+}
+
+void UnloadGuiChoiceItems(GuiChoiceState* choice) {
+    MemFree((void*)choice->items);
+    choice->items = NULL;
+}
+
+/**
+ * Get the bounds of an item of a toggle group, which shares its bounds out between its items.
+ */
+Rectangle GetGuiToggleGroupItemBounds(GuiContainer* container, int element, Rectangle bounds, int item) {
+    int count = container->states[element].choice.count;
+    float padding = (float)GetGuiContainerStyle(container, TOGGLE, GROUP_PADDING);
+    float width = count > 0 ? (bounds.width - padding * (float)(count - 1)) / (float)count : bounds.width;
+    return (Rectangle){ bounds.x + (float)item * (width + padding), bounds.y, width, bounds.height };
+}
+
+// Controls whose state only the container changes are drawn with raygui locked, so raygui doesn't read the mouse and
+// keyboard itself.
+
+void DrawGuiButtonElement(GuiContainer* container, int element, Rectangle bounds) {
+    GuiButton(bounds, container->states[element].text);
+}
+
+void DrawGuiCheckBoxElement(GuiContainer* container, int element, Rectangle bounds) {
+    GuiElementState* state = container->states + element;
+    bool locked = guiLocked;
+    guiLocked = true;
+    GuiCheckBox(bounds, state->text, state->checked);
+    guiLocked = locked;
+}
+
+void DrawGuiToggleElement(GuiContainer* container, int element, Rectangle bounds) {
+    GuiElementState* state = container->states + element;
+    bool locked = guiLocked;
+    guiLocked = true;
+    GuiToggle(bounds, state->text, state->checked);
+    guiLocked = locked;
+}
+
+/**
+ * Draw a toggle group a toggle at a time, in the bounds the mouse is checked against.
+ */
+void DrawGuiToggleGroupElement(GuiContainer* container, int element, Rectangle bounds) {
+    GuiChoiceState* choice = &container->states[element].choice;
+    const char** items = GetGuiChoiceItems(container, element);
+    bool locked = guiLocked;
+    guiLocked = true;
+    for (int i = 0; i < choice->count; i++) {
+        GuiToggle(GetGuiToggleGroupItemBounds(container, element, bounds, i), items[i], i == choice->active);
+    }
+    guiLocked = locked;
+}
+
+void DrawGuiSliderElement(GuiContainer* container, int element, Rectangle bounds) {
+    GuiElementState* state = container->states + element;
+    GuiSlider(bounds, state->text, state->value.textRight, state->value.value, state->value.min, state->value.max);
+}
+
+void DrawGuiSliderBarElement(GuiContainer* container, int element, Rectangle bounds) {
+    GuiElementState* state = container->states + element;
+    GuiSliderBar(bounds, state->text, state->value.textRight, state->value.value, state->value.min, state->value.max);
+}
+
+void DrawGuiProgressBarElement(GuiContainer* container, int element, Rectangle bounds) {
+    GuiElementState* state = container->states + element;
+    GuiProgressBar(bounds, state->text, state->value.textRight, state->value.value, state->value.min, state->value.max);
+}
+
+/**
+ * Draw a spinner or value box, in edit mode while it's focus locked.
+ */
+void DrawGuiSpinnerElement(GuiContainer* container, int element, Rectangle bounds) {
+    GuiElementState* state = container->states + element;
+    int value = (int)state->value.value;
+    bool editMode = guiState == STATE_PRESSED;
+    bool locked = guiLocked;
+    guiLocked = true;
+    if (container->types[element] == GUI_TYPE_SPINNER) {
+        GuiSpinner(bounds, state->text, &value, (int)state->value.min, (int)state->value.max, editMode);
+    }
+    else {
+        GuiValueBox(bounds, state->text, &value, (int)state->value.min, (int)state->value.max, editMode);
+    }
+    guiLocked = locked;
+}
+
+void DrawGuiComboBoxElement(GuiContainer* container, int element, Rectangle bounds) {
+    bool locked = guiLocked;
+    guiLocked = true;
+    GuiComboBox(bounds, GetGuiComboBoxText(container, element), container->states[element].choice.active);
+    guiLocked = locked;
+}
+
+/**
+ * Draw a dropdown box, open while it's focus locked. Closed, it only shows the chosen item, so only an open dropdown
+ * box has raygui split its text.
+ */
+void DrawGuiDropdownBoxElement(GuiContainer* container, int element, Rectangle bounds) {
+    GuiElementState* state = container->states + element;
+    bool locked = guiLocked;
+    guiLocked = true;
+    if (guiState == STATE_PRESSED) {
+        int active = state->choice.active;
+        GuiDropdownBox(bounds, state->text, &active, true);
+    }
+    else {
+        int active = 0;
+        const char** items = GetGuiChoiceItems(container, element);
+        GuiDropdownBox(bounds, state->choice.count > 0 ? items[state->choice.active] : NULL, &active, false);
+    }
+    guiLocked = locked;
+}
+
+/**
+ * Draw a text box, in edit mode while it's focus locked.
+ */
+void DrawGuiTextBoxElement(GuiContainer* container, int element, Rectangle bounds) {
+    GuiTextBoxState* textBox = &container->states[element].textBox;
+    bool locked = guiLocked;
+    guiLocked = true;
+    GuiTextBox(bounds, textBox->buffer, textBox->size, guiState == STATE_PRESSED);
+    guiLocked = locked;
+}
+
+/**
+ * Draw a color picker, which clicks pick from through the container, rather than through raygui.
+ */
+void DrawGuiColorPickerElement(GuiContainer* container, int element, Rectangle bounds) {
+    bool locked = guiLocked;
+    guiLocked = true;
+    GuiColorPicker(bounds, container->states[element].text, container->states[element].color.color);
+    guiLocked = locked;
+}
+
+void DrawGuiListViewElement(GuiContainer* container, int element, Rectangle bounds) {
+    DrawGuiList(container, container->states[element].list, bounds, container->activeElement == element);
+}
+
+/**
+ * Display a single element through raygui at the given screen bounds, using the current guiState.
+ */
+void DrawGuiElement(GuiContainer* container, int element, Rectangle bounds) {
+    GUI_PROFILE_COUNT(container, elementsDrawn, 1);
+    GetGuiElementClass(container->types[element])->draw(container, element, bounds);
+}
+
+#if defined(RAYGUI_CONTAINER_RETAINED)
+enum GuiDrawCommandType {
+    GUI_DRAW_RECTANGLE = 0,
+    GUI_DRAW_RECTANGLE_GRADIENT,
+    GUI_DRAW_TEXT,
+    GUI_DRAW_CODEPOINT,
+    GUI_DRAW_GROUP          // A group element, which is drawn live, by its handle index in text
+};
+
+/**
+ * A single recorded raylib drawing call.
+ */
+typedef struct GuiDrawCommand {
+    int type;               // The GuiDrawCommandType
+    Rectangle bounds;       // The rectangle, or the text position in x and y
+    Color colors[4];        // The color, or the four gradient colors
+    int text;               // The offset of the text in the text buffer, or the codepoint
+    int font;               // The index of the font in the font table
+    float fontSize;
+    float spacing;
+} GuiDrawCommand;
+
+/**
+ * A list of draw commands, along with the text they reference.
+ */
+typedef struct GuiDrawList {
+    GuiDrawCommand* commands;
+    int commandCount;
+    int commandCapacity;
+    char* texts;
+    int textSize;
+    int textCapacity;
+} GuiDrawList;
+
+/**
+ * The inputs an element was last recorded with. The element is recorded again when any of them change.
+ */
+typedef struct GuiDrawCacheEntry {
+    unsigned char type;
+    Rectangle bounds;
+    GuiElementState state;
+    GuiState guiState;
+    bool guiLocked;
+    float guiAlpha;
+    bool recorded;              // Whether the entry holds the inputs of its last recording
+    bool hovered;               // Whether the mouse was over the element when it was recorded
+    Rectangle extent;           // The area covered by the recorded commands
+    int commandStart;           // The element's commands in the last frame's list
+    int commandCount;
+    int textStart;              // The element's text in the last frame's list
+    int textSize;
+    unsigned int frame;         // The frame whose list holds the element's commands
+} GuiDrawCacheEntry;
+
+/**
+ * The retained draw commands of a container.
+ *
+ * Commands are recorded into one list while the other holds the last frame's commands, which are copied over for
+ * elements that haven't changed. Entries are indexed by handle index, so they survive other elements being removed.
+ */
+typedef struct GuiDrawCache {
+    GuiDrawList lists[2];
+    int current;                // The list holding the last frame's commands
+    unsigned int frame;         // The frame of the list holding the last frame's commands
+    GuiDrawCacheEntry* entries;
+    Font* fonts;
+    int fontCount;
+    int fontCapacity;
+    Rectangle extent;           // The area covered by the element being recorded
+    bool hasExtent;
+} GuiDrawCache;
+
+// The cache that raygui's drawing is being recorded into, or NULL when drawing directly.
+static GuiDrawCache* guiDrawRecorder = NULL;
+
+void ResizeGuiDrawCache(GuiDrawCache* cache, int capacity) {
+    cache->entries = (GuiDrawCacheEntry*)MemRealloc(cache->entries, capacity * sizeof(GuiDrawCacheEntry));
+}
+
+void UnloadGuiDrawCache(GuiDrawCache* cache) {
+    for (int i = 0; i < 2; i++) {
+        MemFree(cache->lists[i].commands);
+        MemFree(cache->lists[i].texts);
+    }
+    MemFree(cache->entries);
+    MemFree(cache->fonts);
+    MemFree(cache);
+}
+
+/**
+ * Record drawing into a draw cache, so DrawGuiContainer() only runs raygui for the elements that changed.
+ *
+ * The cache compares each element's bounds, state and raygui's global state against what it was recorded with. Text
+ * is compared by pointer, and raygui's style isn't tracked, so call InvalidateGuiContainerDrawCache() after changing
+ * either in place.
+ */
+void EnableGuiContainerDrawCache(GuiContainer* container) {
+    if (container->drawCache != NULL) {
+        return;
+    }
+
+    GuiDrawCache* cache = (GuiDrawCache*)MemAlloc(sizeof(GuiDrawCache));
+    memset(cache, 0, sizeof(GuiDrawCache));
+    container->drawCache = cache;
+    ResizeGuiDrawCache(cache, container->capacity);
+    InvalidateGuiContainerDrawCache(container);
+
+    // Nested containers record their own elements.
+    for (int i = 0; i < container->count; i++) {
+        if (container->flags[i] & GUI_ELEMENT_GROUP) {
+            EnableGuiContainerDrawCache(container->states[i].container);
+        }
+    }
+}
+
+void DisableGuiContainerDrawCache(GuiContainer* container) {
+    if (container->drawCache != NULL) {
+        UnloadGuiDrawCache(container->drawCache);
+        container->drawCache = NULL;
+    }
+
+    for (int i = 0; i < container->count; i++) {
+        if (container->flags[i] & GUI_ELEMENT_GROUP) {
+            DisableGuiContainerDrawCache(container->states[i].container);
+        }
+    }
+}
+
+/**
+ * Record every element again on the next DrawGuiContainer().
+ */
+void InvalidateGuiContainerDrawCache(GuiContainer* container) {
+    GuiDrawCache* cache = container->drawCache;
+    if (cache == NULL) {
+        return;
+    }
+
+    for (int i = 0; i < container->capacity; i++) {
+        cache->entries[i].recorded = false;
+    }
+    cache->fontCount = 0;
+
+    for (int i = 0; i < container->count; i++) {
+        if (container->flags[i] & GUI_ELEMENT_GROUP) {
+            InvalidateGuiContainerDrawCache(container->states[i].container);
+        }
+    }
+}
+
+GuiDrawCommand* AddGuiDrawCommand(GuiDrawList* list, int type) {
+    if (list->commandCount == list->commandCapacity) {
+        list->commandCapacity = list->commandCapacity == 0 ? 256 : list->commandCapacity * 2;
+        list->commands = (GuiDrawCommand*)MemRealloc(list->commands, list->commandCapacity * sizeof(GuiDrawCommand));
+    }
+
+    GuiDrawCommand* command = list->commands + list->commandCount++;
+    command->type = type;
+    return command;
+}
+
+/**
+ * Copy text into the list's text buffer.
+ *
+ * @return The offset of the text in the buffer.
+ */
+int AddGuiDrawText(GuiDrawList* list, const char* text, int length) {
+    if (list->textSize + length + 1 > list->textCapacity) {
+        while (list->textSize + length + 1 > list->textCapacity) {
+            list->textCapacity = list->textCapacity == 0 ? 1024 : list->textCapacity * 2;
+        }
+        list->texts = (char*)MemRealloc(list->texts, list->textCapacity);
+    }
+
+    int offset = list->textSize;
+    memcpy(list->texts + offset, text, length);
+    list->texts[offset + length] = '\0';
+    list->textSize += length + 1;
+    return offset;
+}
+
+/**
+ * Get the index of the font in the cache's font table, adding it if it's new.
+ */
+int GetGuiDrawCacheFont(GuiDrawCache* cache, Font font) {
+    for (int i = 0; i < cache->fontCount; i++) {
+        if (memcmp(cache->fonts + i, &font, sizeof(Font)) == 0) {
+            return i;
+        }
+    }
+
+    if (cache->fontCount == cache->fontCapacity) {
+        cache->fontCapacity = cache->fontCapacity == 0 ? 4 : cache->fontCapacity * 2;
+        cache->fonts = (Font*)MemRealloc(cache->fonts, cache->fontCapacity * sizeof(Font));
+    }
+    cache->fonts[cache->fontCount] = font;
+    return cache->fontCount++;
+}
+
+/**
+ * Grow the extent of the element being recorded, which decides whether the mouse is over it.
+ */
+void AddGuiDrawCacheExtent(GuiDrawCache* cache, Rectangle bounds) {
+    if (!cache->hasExtent) {
+        cache->extent = bounds;
+        cache->hasExtent = true;
+        return;
+    }
+
+    float right = cache->extent.x + cache->extent.width;
+    float bottom = cache->extent.y + cache->extent.height;
+    if (bounds.x + bounds.width > right) right = bounds.x + bounds.width;
+    if (bounds.y + bounds.height > bottom) bottom = bounds.y + bounds.height;
+    if (bounds.x < cache->extent.x) cache->extent.x = bounds.x;
+    if (bounds.y < cache->extent.y) cache->extent.y = bounds.y;
+    cache->extent.width = right - cache->extent.x;
+    cache->extent.height = bottom - cache->extent.y;
+}
+
+GuiDrawList* GetGuiDrawRecorderList(void) {
+    return guiDrawRecorder->lists + (1 - guiDrawRecorder->current);
+}
+
+bool RecordGuiDrawRectangle(int posX, int posY, int width, int height, Color color) {
+    if (guiDrawRecorder == NULL) {
+        return false;
+    }
+
+    GuiDrawCommand* command = AddGuiDrawCommand(GetGuiDrawRecorderList(), GUI_DRAW_RECTANGLE);
+    command->bounds = (Rectangle){ (float)posX, (float)posY, (float)width, (float)height };
+    command->colors[0] = color;
+    AddGuiDrawCacheExtent(guiDrawRecorder, command->bounds);
+    return true;
+}
+
+bool RecordGuiDrawRectangleGradient(Rectangle rec, Color col1, Color col2, Color col3, Color col4) {
+    if (guiDrawRecorder == NULL) {
+        return false;
+    }
+
+    GuiDrawCommand* command = AddGuiDrawCommand(GetGuiDrawRecorderList(), GUI_DRAW_RECTANGLE_GRADIENT);
+    command->bounds = rec;
+    command->colors[0] = col1;
+    command->colors[1] = col2;
+    command->colors[2] = col3;
+    command->colors[3] = col4;
+    AddGuiDrawCacheExtent(guiDrawRecorder, rec);
+    return true;
+}
+
+bool RecordGuiDrawText(Font font, const char* text, Vector2 position, float fontSize, float spacing, Color tint) {
+    if (guiDrawRecorder == NULL) {
+        return false;
+    }
+
+    // raygui may pass a temporary buffer, so the text is copied.
+    GuiDrawList* list = GetGuiDrawRecorderList();
+    int offset = AddGuiDrawText(list, text, (int)strlen(text));
+    GuiDrawCommand* command = AddGuiDrawCommand(list, GUI_DRAW_TEXT);
+    command->bounds = (Rectangle){ position.x, position.y, 0, 0 };
+    command->colors[0] = tint;
+    command->text = offset;
+    command->font = GetGuiDrawCacheFont(guiDrawRecorder, font);
+    command->fontSize = fontSize;
+    command->spacing = spacing;
+
+    Vector2 size = MeasureTextEx(font, text, fontSize, spacing);
+    AddGuiDrawCacheExtent(guiDrawRecorder, (Rectangle){ position.x, position.y, size.x, size.y });
+    return true;
+}
+
+bool RecordGuiDrawCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint) {
+    if (guiDrawRecorder == NULL) {
+        return false;
+    }
+
+    GuiDrawCommand* command = AddGuiDrawCommand(GetGuiDrawRecorderList(), GUI_DRAW_CODEPOINT);
+    command->bounds = (Rectangle){ position.x, position.y, 0, 0 };
+    command->colors[0] = tint;
+    command->text = codepoint;
+    command->font = GetGuiDrawCacheFont(guiDrawRecorder, font);
+    command->fontSize = fontSize;
+    AddGuiDrawCacheExtent(guiDrawRecorder, (Rectangle){ position.x, position.y, fontSize, fontSize });
+    return true;
+}
+
+/**
+ * Check whether an element's inputs match what it was recorded with.
+ */
+bool IsGuiDrawCacheEntryCurrent(GuiDrawCacheEntry* entry, GuiContainer* container, int element, Rectangle bounds) {
+    return entry->recorded &&
+        entry->type == container->types[element] &&
+        entry->bounds.x == bounds.x && entry->bounds.y == bounds.y &&
+        entry->bounds.width == bounds.width && entry->bounds.height == bounds.height &&
+        memcmp(&entry->state, container->states + element, sizeof(GuiElementState)) == 0 &&
+        entry->guiState == guiState && entry->guiLocked == guiLocked && entry->guiAlpha == guiAlpha;
+}
+
+/**
+ * Copy an element's commands and text from the last frame's list into the current one.
+ */
+void CopyGuiDrawCommands(GuiDrawList* from, GuiDrawList* to, GuiDrawCacheEntry* entry) {
+    while (to->commandCount + entry->commandCount > to->commandCapacity) {
+        to->commandCapacity = to->commandCapacity == 0 ? 256 : to->commandCapacity * 2;
+        to->commands = (GuiDrawCommand*)MemRealloc(to->commands, to->commandCapacity * sizeof(GuiDrawCommand));
+    }
+    if (to->textSize + entry->textSize > to->textCapacity) {
+        while (to->textSize + entry->textSize > to->textCapacity) {
+            to->textCapacity = to->textCapacity == 0 ? 1024 : to->textCapacity * 2;
+        }
+        to->texts = (char*)MemRealloc(to->texts, to->textCapacity);
+    }
+
+    // The element's text is contiguous, so it moves as a single block.
+    GuiDrawCommand* commands = to->commands + to->commandCount;
+    int textOffset = to->textSize - entry->textStart;
+    memcpy(commands, from->commands + entry->commandStart, entry->commandCount * sizeof(GuiDrawCommand));
+    memcpy(to->texts + to->textSize, from->texts + entry->textStart, entry->textSize);
+    for (int i = 0; i < entry->commandCount; i++) {
+        if (commands[i].type == GUI_DRAW_TEXT) {
+            commands[i].text += textOffset;
+        }
+    }
+    to->commandCount += entry->commandCount;
+    to->textSize += entry->textSize;
+}
+
+void DrawGuiDrawList(GuiDrawCache* cache, GuiDrawList* list, GuiContainer* container, GuiDrawRegion region) {
+    GUI_PROFILE_COUNT(container, commandsReplayed, list->commandCount);
+    for (int i = 0; i < list->commandCount; i++) {
+        GuiDrawCommand* command = list->commands + i;
+        Rectangle bounds = command->bounds;
+        switch (command->type) {
+            case GUI_DRAW_RECTANGLE:
+                (DrawRectangle)((int)bounds.x, (int)bounds.y, (int)bounds.width, (int)bounds.height, command->colors[0]);
+                break;
+            case GUI_DRAW_RECTANGLE_GRADIENT:
+                (DrawRectangleGradientEx)(bounds, command->colors[0], command->colors[1], command->colors[2], command->colors[3]);
+                break;
+            case GUI_DRAW_TEXT:
+                (DrawTextEx)(cache->fonts[command->font], list->texts + command->text, (Vector2){ bounds.x, bounds.y }, command->fontSize, command->spacing, command->colors[0]);
+                break;
+            case GUI_DRAW_CODEPOINT:
+                (DrawTextCodepoint)(cache->fonts[command->font], command->text, (Vector2){ bounds.x, bounds.y }, command->fontSize, command->colors[0]);
+                break;
+            case GUI_DRAW_GROUP:
+                DrawGuiGroup(container, container->slots[command->text], region);
+                break;
+        }
+    }
+}
+
+/**
+ * Check whether an element can reuse its commands from the last frame.
+ */
+bool IsGuiDrawCacheEntryClean(GuiDrawCache* cache, GuiContainer* container, int element, Rectangle bounds, Vector2 mouse, bool* hovered) {
+    GuiDrawCacheEntry* entry = cache->entries + container->ids[element];
+
+    // A group's command stays the same, as the group is drawn when the list is.
+    if (container->flags[element] & GUI_ELEMENT_GROUP) {
+        *hovered = false;
+        return entry->recorded && entry->frame == cache->frame;
+    }
+
+    // A list view's rows come from its callbacks, so there's no telling whether they changed.
+    if (GetGuiElementClass(container->types[element])->flags & GUI_CLASS_LIVE) {
+        *hovered = false;
+        return false;
+    }
+
+    // Only the elements drawn in the last frame have commands in its list.
+    *hovered = CheckCollisionPointRec(mouse, bounds) || (entry->recorded && CheckCollisionPointRec(mouse, entry->extent));
+    return entry->frame == cache->frame && !*hovered && !entry->hovered && IsGuiDrawCacheEntryCurrent(entry, container, element, bounds);
+}
+
+/**
+ * Draw the given elements of the container through its draw cache, or every element if elements is NULL.
+ *
+ * Elements whose inputs haven't changed reuse their commands from the last frame. Elements under the mouse are always
+ * recorded again, as raygui updates them from the mouse while drawing. When nothing changed, the last frame's list is
+ * drawn as it is.
+ */
+void DrawGuiContainerRetained(GuiContainer* container, GuiDrawRegion region, const int* elements, int count) {
+    GuiDrawCache* cache = container->drawCache;
+    GuiDrawList* last = cache->lists + cache->current;
+    GuiDrawList* next = cache->lists + (1 - cache->current);
+    Vector2 mouse = GetMousePosition();
+    bool hovered;
+
+    // Check whether every element is clean, and still in the same order.
+    int commandCount = 0;
+    int visible = 0;
+    for (; visible < count; visible++) {
+        int element = elements != NULL ? elements[visible] : visible;
+        GuiDrawCacheEntry* entry = cache->entries + container->ids[element];
+        SetGuiElementDrawState(container, element);
+        Rectangle bounds = OffsetGuiRectangle(container->bounds[element], region.origin);
+        if (entry->commandStart != commandCount || !IsGuiDrawCacheEntryClean(cache, container, element, bounds, mouse, &hovered)) {
+            break;
+        }
+        commandCount += entry->commandCount;
+    }
+    if (visible == count && commandCount == last->commandCount) {
+        DrawGuiDrawList(cache, last, container, region);
+        return;
+    }
+
+    next->commandCount = 0;
+    next->textSize = 0;
+    for (visible = 0; visible < count; visible++) {
+        int i = elements != NULL ? elements[visible] : visible;
+        GuiDrawCacheEntry* entry = cache->entries + container->ids[i];
+        SetGuiElementDrawState(container, i);
+        Rectangle bounds = OffsetGuiRectangle(container->bounds[i], region.origin);
+
+        int commandStart = next->commandCount;
+        int textStart = next->textSize;
+        if (IsGuiDrawCacheEntryClean(cache, container, i, bounds, mouse, &hovered)) {
+            CopyGuiDrawCommands(last, next, entry);
+        }
+        else {
+            if (container->flags[i] & GUI_ELEMENT_GROUP) {
+                AddGuiDrawCommand(next, GUI_DRAW_GROUP)->text = container->ids[i];
+                cache->hasExtent = false;
+            }
+            else {
+                guiDrawRecorder = cache;
+                cache->hasExtent = false;
+                DrawGuiElement(container, i, bounds);
+                guiDrawRecorder = NULL;
+            }
+
+            // The state is compared byte for byte, so it's copied byte for byte.
+            entry->type = container->types[i];
+            entry->bounds = bounds;
+            memcpy(&entry->state, container->states + i, sizeof(GuiElementState));
+            entry->guiState = guiState;
+            entry->guiLocked = guiLocked;
+            entry->guiAlpha = guiAlpha;
+            entry->recorded = true;
+            entry->hovered = hovered;
+            entry->extent = cache->hasExtent ? cache->extent : bounds;
+        }
+        entry->commandStart = commandStart;
+        entry->commandCount = next->commandCount - commandStart;
+        entry->textStart = textStart;
+        entry->textSize = next->textSize - textStart;
+        entry->frame = cache->frame + 1;
+    }
+
+    cache->current = 1 - cache->current;
+    cache->frame++;
+    DrawGuiDrawList(cache, next, container, region);
+}
+#endif
+
+/**
+ * Set up the parts of a container that don't depend on its elements: its focus, input, style and string arena.
+ */
+void InitGuiContainerSettings(GuiContainer* container) {
+    container->activeElement = -1;
+    container->focusLocked = false;
+    container->input = (GuiInput*)MemAlloc(sizeof(GuiInput));
+    container->input->bindingCount = 0;
+    container->input->actionCount = 0;
+    container->input->eventCount = 0;
+    container->input->source = (GuiInputSource){ true, true, ~0u };
+    memset(&container->input->frame, 0, sizeof(GuiInputFrame));
+    container->input->recording = NULL;
+    container->handlers = NULL;
+    container->animation = NULL;
+    container->drawCache = NULL;
+    container->group = NULL;
+    container->style = (GuiContainerStyle*)MemAlloc(sizeof(GuiContainerStyle));
+    container->style->count = 0;
+    container->style->locked = false;
+    container->style->alpha = 1.0f;
+    container->strings = InitGuiStringArena();
+    container->layout = NULL;
+    container->file = NULL;
+#if defined(RAYGUI_CONTAINER_PROFILE)
+    container->profile = (GuiProfile*)MemAlloc(sizeof(GuiProfile));
+    memset(container->profile, 0, sizeof(GuiProfile));
+#else
+    container->profile = NULL;
+#endif
+    ResetGuiContainerBindings(container);
+
+    // raygui loads its style the first time it's read. Load it now, as updates may read it from other threads.
+    GuiGetStyle(DEFAULT, BORDER_WIDTH);
+}
+
+GuiContainer InitGuiContainer() {
+    GuiContainer container;
+    container.count = 0;
+    container.capacity = RAYGUI_CONTAINER_INITIAL_CAPACITY;
+    container.bounds = (Rectangle*)MemAlloc(container.capacity * sizeof(Rectangle));
+    container.flags = (unsigned char*)MemAlloc(container.capacity * sizeof(unsigned char));
+    container.types = (unsigned char*)MemAlloc(container.capacity * sizeof(unsigned char));
+    container.states = (GuiElementState*)MemAlloc(container.capacity * sizeof(GuiElementState));
+    container.ids = (int*)MemAlloc(container.capacity * sizeof(int));
+    container.slots = (int*)MemAlloc(container.capacity * sizeof(int));
+    container.generations = (unsigned int*)MemAlloc(container.capacity * sizeof(unsigned int));
+    container.slotCount = 0;
+    container.freeSlot = -1;
+    container.spatialIndex = InitGuiSpatialIndex(container.capacity);
+    container.navigation = InitGuiNavigationGraph(container.capacity);
+    InitGuiContainerSettings(&container);
+    return container;
+}
+
+/**
+ * A container file, mapped into memory, or read into a single block where mmap() isn't available.
+ *
+ * A loaded container's element store, spatial index, navigation graph and string table point into the file, so loading
+ * doesn't copy or allocate anything per element. They're copied out the first time the container grows, or is given
+ * text that isn't in the file already. The text itself stays in the file until the container is unloaded.
+ */
+typedef struct GuiContainerFile {
+    unsigned char* data;
+    size_t size;
+    bool shared;                // Whether the element store still points into the file
+} GuiContainerFile;
+
+void* CopyGuiContainerFileArray(const void* array, size_t size) {
+    void* copy = MemAlloc((unsigned int)size);
+    memcpy(copy, array, size);
+    return copy;
+}
+
+/**
+ * Copy the element store of a loaded container out of its file, so it can be reallocated as the container grows.
+ */
+void DetachGuiContainerFile(GuiContainer* container) {
+    if (container->file == NULL || !container->file->shared) {
+        return;
+    }
+
+    size_t capacity = (size_t)container->capacity;
+    container->bounds = (Rectangle*)CopyGuiContainerFileArray(container->bounds, capacity * sizeof(Rectangle));
+    container->flags = (unsigned char*)CopyGuiContainerFileArray(container->flags, capacity * sizeof(unsigned char));
+    container->types = (unsigned char*)CopyGuiContainerFileArray(container->types, capacity * sizeof(unsigned char));
+    container->states = (GuiElementState*)CopyGuiContainerFileArray(container->states, capacity * sizeof(GuiElementState));
+    container->ids = (int*)CopyGuiContainerFileArray(container->ids, capacity * sizeof(int));
+    container->slots = (int*)CopyGuiContainerFileArray(container->slots, capacity * sizeof(int));
+    container->generations = (unsigned int*)CopyGuiContainerFileArray(container->generations, capacity * sizeof(unsigned int));
+
+    GuiSpatialIndex* index = container->spatialIndex;
+    index->buckets = (int*)CopyGuiContainerFileArray(index->buckets, (size_t)(index->bucketMask + 1) * sizeof(int));
+    index->next = (int*)CopyGuiContainerFileArray(index->next, capacity * sizeof(int));
+    index->prev = (int*)CopyGuiContainerFileArray(index->prev, capacity * sizeof(int));
+    index->cellX = (int*)CopyGuiContainerFileArray(index->cellX, capacity * sizeof(int));
+    index->cellY = (int*)CopyGuiContainerFileArray(index->cellY, capacity * sizeof(int));
+
+    GuiNavigationGraph* graph = container->navigation;
+    graph->neighbours = (int*)CopyGuiContainerFileArray(graph->neighbours, capacity * 4 * sizeof(int));
+    graph->distances = (float*)CopyGuiContainerFileArray(graph->distances, capacity * 4 * sizeof(float));
+    graph->cached = (unsigned char*)CopyGuiContainerFileArray(graph->cached, capacity * sizeof(unsigned char));
+    graph->tabNext = (int*)CopyGuiContainerFileArray(graph->tabNext, capacity * sizeof(int));
+    graph->openIndex = (int*)CopyGuiContainerFileArray(graph->openIndex, capacity * sizeof(int));
+    graph->open = (int*)CopyGuiContainerFileArray(graph->open, capacity * sizeof(int));
+    container->file->shared = false;
+}
+
+void UnloadGuiContainerFile(GuiContainerFile* file) {
+#if defined(RAYGUI_CONTAINER_MMAP)
+    munmap(file->data, file->size);
+#else
+    MemFree(file->data);
+#endif
+    MemFree(file);
+}
+
+void ResizeGuiLayoutTree(GuiContainer* container);
+
+/**
+ * Double the capacity of the container.
+ *
+ * Elements are referenced by handle rather than by pointer, so moving them is safe.
+ */
+void GrowGuiContainer(GuiContainer* container) {
+    DetachGuiContainerFile(container);
+    container->capacity *= 2;
+    container->bounds = (Rectangle*)MemRealloc(container->bounds, container->capacity * sizeof(Rectangle));
+    container->flags = (unsigned char*)MemRealloc(container->flags, container->capacity * sizeof(unsigned char));
+    container->types = (unsigned char*)MemRealloc(container->types, container->capacity * sizeof(unsigned char));
+    container->states = (GuiElementState*)MemRealloc(container->states, container->capacity * sizeof(GuiElementState));
+    container->ids = (int*)MemRealloc(container->ids, container->capacity * sizeof(int));
+    container->slots = (int*)MemRealloc(container->slots, container->capacity * sizeof(int));
+    container->generations = (unsigned int*)MemRealloc(container->generations, container->capacity * sizeof(unsigned int));
+    ResizeGuiSpatialIndex(container->spatialIndex, container->capacity);
+    ResizeGuiNavigationGraph(container->navigation, container->capacity);
+    if (container->layout != NULL) {
+        ResizeGuiLayoutTree(container);
+    }
+    if (container->handlers != NULL) {
+        ResizeGuiElementHandlers(container->handlers, container->capacity);
+    }
+    if (container->animation != NULL) {
+        ResizeGuiAnimation(container->animation, container->capacity / 2, container->capacity);
+    }
+#if defined(RAYGUI_CONTAINER_RETAINED)
+    if (container->drawCache != NULL) {
+        ResizeGuiDrawCache(container->drawCache, container->capacity);
+    }
+#endif
+}
+
+/**
+ * Get the element index of the given handle.
+ *
+ * @return The element index, or -1 if the handle doesn't refer to a live element.
+ */
+int GetGuiElementIndex(GuiContainer* container, GuiElement element) {
+    if (element.index < 0 || element.index >= container->slotCount) {
+        return -1;
+    }
+
+    if (container->generations[element.index] != element.generation) {
+        return -1;
+    }
+
+    return container->slots[element.index];
+}
+
+bool IsGuiElementValid(GuiContainer* container, GuiElement element) {
+    return GetGuiElementIndex(container, element) >= 0;
+}
+
+/**
+ * Find the topmost selectable element under the given point, from the elements in [start, end).
+ *
+ * Elements are drawn in order, so the topmost element is the one with the highest index.
+ *
+ * @return The element index, or -1 if there is none.
+ */
+int FindGuiElementAtPointInRange(GuiContainer* container, Vector2 point, int start, int end) {
+    for (int i = end - 1; i >= start; i--) {
+        if ((container->flags[i] & GUI_ELEMENT_SELECTABLE) && CheckCollisionPointRec(point, container->bounds[i])) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * Find the topmost selectable element under the given point by checking one element at a time.
+ */
+int FindGuiElementAtPointScalar(GuiContainer* container, Vector2 point) {
+    return FindGuiElementAtPointInRange(container, point, 0, container->count);
+}
+
+/**
+ * Check a batch of hit elements, given as a bit mask, from the top down for one that is selectable.
+ *
+ * @return The element index, or -1 if none of them are selectable.
+ */
+int FindSelectableGuiElementInMask(GuiContainer* container, int first, unsigned int mask) {
+    for (int bit = 31; mask != 0 && bit >= 0; bit--) {
+        if ((mask & (1u << bit)) == 0) {
+            continue;
+        }
+        mask &= ~(1u << bit);
+
+        if (container->flags[first + bit] & GUI_ELEMENT_SELECTABLE) {
+            return first + bit;
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * Find the topmost selectable element under the given point.
+ *
+ * Depending on the target, this checks 8 (AVX2) or 4 (SSE2, NEON) elements at a time, and gives the same result as
+ * FindGuiElementAtPointScalar().
+ *
+ * @return The element index, or -1 if there is none.
+ */
+int FindGuiElementAtPoint(GuiContainer* container, Vector2 point) {
+#if defined(RAYGUI_CONTAINER_AVX2)
+    const int width = 8;
+#elif defined(RAYGUI_CONTAINER_SSE2) || defined(RAYGUI_CONTAINER_NEON)
+    const int width = 4;
+#else
+    return FindGuiElementAtPointScalar(container, point);
+#endif
+
+#if defined(RAYGUI_CONTAINER_AVX2) || defined(RAYGUI_CONTAINER_SSE2) || defined(RAYGUI_CONTAINER_NEON)
+    int blocks = container->count / width;
+
+    // Check the elements that don't fill a whole batch first, as they're on top.
+    int hit = FindGuiElementAtPointInRange(container, point, blocks * width, container->count);
+    if (hit >= 0) {
+        return hit;
+    }
+
+    const float* bounds = (const float*)container->bounds;
+#if defined(RAYGUI_CONTAINER_AVX2)
+    __m256 px = _mm256_set1_ps(point.x);
+    __m256 py = _mm256_set1_ps(point.y);
+    for (int block = blocks - 1; block >= 0 && hit < 0; block--) {
+        // Load 8 rectangles, and transpose them into x, y, width and height vectors. The lanes end up in the order
+        // 0, 2, 4, 6, 1, 3, 5, 7.
+        const float* base = bounds + block * 32;
+        __m256 r01 = _mm256_loadu_ps(base);
+        __m256 r23 = _mm256_loadu_ps(base + 8);
+        __m256 r45 = _mm256_loadu_ps(base + 16);
+        __m256 r67 = _mm256_loadu_ps(base + 24);
+        __m256 xy0123 = _mm256_unpacklo_ps(r01, r23);
+        __m256 wh0123 = _mm256_unpackhi_ps(r01, r23);
+        __m256 xy4567 = _mm256_unpacklo_ps(r45, r67);
+        __m256 wh4567 = _mm256_unpackhi_ps(r45, r67);
+        __m256 x = _mm256_shuffle_ps(xy0123, xy4567, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 y = _mm256_shuffle_ps(xy0123, xy4567, _MM_SHUFFLE(3, 2, 3, 2));
+        __m256 w = _mm256_shuffle_ps(wh0123, wh4567, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 h = _mm256_shuffle_ps(wh0123, wh4567, _MM_SHUFFLE(3, 2, 3, 2));
+
+        // The same comparisons as CheckCollisionPointRec().
+        __m256 inside = _mm256_and_ps(
+            _mm256_and_ps(_mm256_cmp_ps(px, x, _CMP_GE_OQ), _mm256_cmp_ps(px, _mm256_add_ps(x, w), _CMP_LE_OQ)),
+            _mm256_and_ps(_mm256_cmp_ps(py, y, _CMP_GE_OQ), _mm256_cmp_ps(py, _mm256_add_ps(y, h), _CMP_LE_OQ)));
+        unsigned int lanes = (unsigned int)_mm256_movemask_ps(inside);
+        if (lanes == 0) {
+            continue;
+        }
+
+        // Put the lanes back into element order.
+        unsigned int mask = (lanes & 0x01) | ((lanes & 0x02) << 1) | ((lanes & 0x04) << 2) | ((lanes & 0x08) << 3) |
+            ((lanes & 0x10) >> 3) | ((lanes & 0x20) >> 2) | ((lanes & 0x40) >> 1) | (lanes & 0x80);
+        hit = FindSelectableGuiElementInMask(container, block * 8, mask);
+    }
+#elif defined(RAYGUI_CONTAINER_SSE2)
+    __m128 px = _mm_set1_ps(point.x);
+    __m128 py = _mm_set1_ps(point.y);
+    for (int block = blocks - 1; block >= 0 && hit < 0; block--) {
+        // Load 4 rectangles, and transpose them into x, y, width and height vectors.
+        const float* base = bounds + block * 16;
+        __m128 x = _mm_loadu_ps(base);
+        __m128 y = _mm_loadu_ps(base + 4);
+        __m128 w = _mm_loadu_ps(base + 8);
+        __m128 h = _mm_loadu_ps(base + 12);
+        _MM_TRANSPOSE4_PS(x, y, w, h);
+
+        // The same comparisons as CheckCollisionPointRec().
+        __m128 inside = _mm_and_ps(
+            _mm_and_ps(_mm_cmpge_ps(px, x), _mm_cmple_ps(px, _mm_add_ps(x, w))),
+            _mm_and_ps(_mm_cmpge_ps(py, y), _mm_cmple_ps(py, _mm_add_ps(y, h))));
+        unsigned int mask = (unsigned int)_mm_movemask_ps(inside);
+        if (mask != 0) {
+            hit = FindSelectableGuiElementInMask(container, block * 4, mask);
+        }
+    }
+#elif defined(RAYGUI_CONTAINER_NEON)
+    float32x4_t px = vdupq_n_f32(point.x);
+    float32x4_t py = vdupq_n_f32(point.y);
+    for (int block = blocks - 1; block >= 0 && hit < 0; block--) {
+        // Load 4 rectangles, de-interleaved into x, y, width and height vectors.
+        float32x4x4_t rects = vld4q_f32(bounds + block * 16);
+
+        // The same comparisons as CheckCollisionPointRec().
+        uint32x4_t inside = vandq_u32(
+            vandq_u32(vcgeq_f32(px, rects.val[0]), vcleq_f32(px, vaddq_f32(rects.val[0], rects.val[2]))),
+            vandq_u32(vcgeq_f32(py, rects.val[1]), vcleq_f32(py, vaddq_f32(rects.val[1], rects.val[3]))));
+        unsigned int mask = (vgetq_lane_u32(inside, 0) & 1) | (vgetq_lane_u32(inside, 1) & 2) |
+            (vgetq_lane_u32(inside, 2) & 4) | (vgetq_lane_u32(inside, 3) & 8);
+        if (mask != 0) {
+            hit = FindSelectableGuiElementInMask(container, block * 4, mask);
+        }
+    }
+#endif
+
+    return hit;
+#endif
+}
+
+/**
+ * Check whether two rectangles overlap, not counting rectangles that only touch.
+ */
+bool CheckGuiRectangleOverlap(Rectangle a, Rectangle b) {
+    return a.x < b.x + b.width && a.x + a.width > b.x && a.y < b.y + b.height && a.y + a.height > b.y;
+}
+
+/**
+ * Get the area covered by both rectangles, which has no width or height if they don't overlap.
+ */
+Rectangle GetGuiRectangleOverlap(Rectangle a, Rectangle b) {
+    float left = a.x > b.x ? a.x : b.x;
+    float top = a.y > b.y ? a.y : b.y;
+    float right = a.x + a.width < b.x + b.width ? a.x + a.width : b.x + b.width;
+    float bottom = a.y + a.height < b.y + b.height ? a.y + a.height : b.y + b.height;
+    return (Rectangle){ left, top, right > left ? right - left : 0, bottom > top ? bottom - top : 0 };
+}
+
+int CompareGuiElementIndices(const void* a, const void* b) {
+    return *(const int*)a - *(const int*)b;
+}
+
+/**
+ * Find the elements that overlap the given area, in the order they're drawn.
+ *
+ * Only the cells of the spatial index that could hold such an element are visited, so the cost depends on how many
+ * elements are in the area rather than how many are in the container.
+ *
+ * @return The number of element indices written to the spatial index's results, or -1 if every element may overlap.
+ */
+int FindGuiElementsInArea(GuiContainer* container, Rectangle area) {
+    GuiSpatialIndex* index = container->spatialIndex;
+    if (index->count == 0) {
+        return 0;
+    }
+
+    // An element's center is at most half of the largest element size outside of the area.
+    float left = area.x - index->maxWidth / 2;
+    float top = area.y - index->maxHeight / 2;
+    float right = area.x + area.width + index->maxWidth / 2;
+    float bottom = area.y + area.height + index->maxHeight / 2;
+    float gridLeft = (float)index->minCellX * RAYGUI_CONTAINER_GRID_CELL_SIZE;
+    float gridTop = (float)index->minCellY * RAYGUI_CONTAINER_GRID_CELL_SIZE;
+    float gridRight = (float)(index->maxCellX + 1) * RAYGUI_CONTAINER_GRID_CELL_SIZE;
+    float gridBottom = (float)(index->maxCellY + 1) * RAYGUI_CONTAINER_GRID_CELL_SIZE;
+    if (left <= gridLeft - index->maxWidth && top <= gridTop - index->maxHeight &&
+        right >= gridRight + index->maxWidth && bottom >= gridBottom + index->maxHeight) {
+        return -1;
+    }
+
+    int minX = GetGuiSpatialIndexCell(left);
+    int minY = GetGuiSpatialIndexCell(top);
+    int maxX = GetGuiSpatialIndexCell(right);
+    int maxY = GetGuiSpatialIndexCell(bottom);
+    if (minX < index->minCellX) minX = index->minCellX;
+    if (minY < index->minCellY) minY = index->minCellY;
+    if (maxX > index->maxCellX) maxX = index->maxCellX;
+    if (maxY > index->maxCellY) maxY = index->maxCellY;
+
+    if (minX > maxX || minY > maxY) {
+        return 0;
+    }
+
+    int count = 0;
+
+    // When the area spans more cells than there are elements, checking every element is cheaper, and already in order.
+    if ((float)(maxX - minX + 1) * (float)(maxY - minY + 1) > (float)container->count) {
+        for (int i = 0; i < container->count; i++) {
+            if (CheckGuiRectangleOverlap(container->bounds[i], area)) {
+                index->results[count++] = i;
+            }
+        }
+        return count;
+    }
+
+    for (int y = minY; y <= maxY; y++) {
+        for (int x = minX; x <= maxX; x++) {
+            int current = index->buckets[GetGuiSpatialIndexBucket(index, x, y)];
+            for (; current >= 0; current = index->next[current]) {
+                int element = container->slots[current];
+                if (index->cellX[current] == x && index->cellY[current] == y && CheckGuiRectangleOverlap(container->bounds[element], area)) {
+                    index->results[count++] = element;
+                }
+            }
+        }
+    }
+
+    qsort(index->results, count, sizeof(int), CompareGuiElementIndices);
+    return count;
+}
+
+/**
+ * Get the distance between two elements if the current element is in the given direction of the active element.
+ *
+ * @return The distance between the element centers, or -1 if the element is not in the desired direction.
+ */
+float GetGuiElementDirectionDistance(Rectangle active, Vector2 activeCenter, Rectangle current, int direction) {
+    // Determine if the element is in the desired direction.
+    bool inCorrectDirection = false;
+    switch (direction) {
+        case UP:
+            inCorrectDirection = current.y < active.y;
+            break;
+        case DOWN:
+            inCorrectDirection = current.y > active.y;
+            break;
+        case LEFT:
+            inCorrectDirection = current.x < active.x;
+            break;
+        case RIGHT:
+            inCorrectDirection = current.x > active.x;
+            break;
+    }
+
+    // The element id not in the desired direction.
+    if (!inCorrectDirection) {
+        return -1;
+    }
+
+    // Find the closest element, based on the magnitude of the center of the elements.
+    Vector2 currentCenter = GetGuiElementCenter(current);
+    Vector2 distance = (Vector2){activeCenter.x - currentCenter.x, activeCenter.y - currentCenter.y};
+    float currentDistance = RAYGUI_CONTAINER_SQRTF(distance.x * distance.x + distance.y * distance.y);
+
+    // Ensure the compared distances are based on their absolute value.
+    if (currentDistance < 0) {
+        currentDistance *= -1.0f;
+    }
+
+    return currentDistance;
+}
+
+/**
+ * Find the closest selectable element in the desired direction from the given bounds by checking every element.
+ *
+ * @param exclude The element index to skip, which is the one at the given bounds, or -1.
+ * @return The element index of the target, or -1 if there is none.
+ */
+int FindGuiElementFromBoundsLinear(GuiContainer* container, Rectangle active, int exclude, int direction) {
+    Vector2 activeCenter = GetGuiElementCenter(active);
+    float targetDistance = 99999999; // The furthest away.
+    int target = -1;
+
+    for (int i = 0; i < container->count; i++) {
+        // Only focus on selectable elements, other than the one that already has focus.
+        if (i == exclude || !(container->flags[i] & GUI_ELEMENT_SELECTABLE)) {
+            continue;
+        }
+
+        float currentDistance = GetGuiElementDirectionDistance(active, activeCenter, container->bounds[i], direction);
+
+        // If the current distance is shorter, set it as the new target.
+        if (currentDistance >= 0 && currentDistance < targetDistance) {
+            target = i;
+            targetDistance = currentDistance;
+        }
+    }
+
+    return target;
+}
+
+/**
+ * Find the closest selectable element in the desired direction from the given element by checking every element.
+ *
+ * @return The element index of the target, or -1 if there is none.
+ */
+int FindGuiElementInDirectionLinear(GuiContainer* container, int element, int direction) {
+    return FindGuiElementFromBoundsLinear(container, container->bounds[element], element, direction);
+}
+
+/**
+ * Check the elements in one cell of the spatial index, keeping the closest one in the desired direction.
+ */
+void FindGuiElementInCell(GuiContainer* container, Rectangle active, int exclude, int cellX, int cellY, int direction, int* target, float* targetDistance) {
+    GuiSpatialIndex* index = container->spatialIndex;
+    Vector2 activeCenter = GetGuiElementCenter(active);
+    int current = index->buckets[GetGuiSpatialIndexBucket(index, cellX, cellY)];
+
+    for (; current >= 0; current = index->next[current]) {
+        // Skip elements from other cells that share the bucket.
+        if (index->cellX[current] != cellX || index->cellY[current] != cellY) {
+            continue;
+        }
+
+        // Only focus on selectable elements, other than the one that already has focus.
+        int candidate = container->slots[current];
+        if (candidate == exclude || !(container->flags[candidate] & GUI_ELEMENT_SELECTABLE)) {
+            continue;
+        }
+
+        float currentDistance = GetGuiElementDirectionDistance(active, activeCenter, container->bounds[candidate], direction);
+        if (currentDistance < 0) {
+            continue;
+        }
+
+        // Prefer the lowest element index on ties, the same as a linear scan would.
+        if (currentDistance < *targetDistance || (currentDistance == *targetDistance && candidate < *target)) {
+            *target = candidate;
+            *targetDistance = currentDistance;
+        }
+    }
+}
+
+/**
+ * Find the closest selectable element in the desired direction from the given bounds through the spatial index.
+ *
+ * Cells are visited in growing rings around the bounds, and the search stops once no unvisited cell can hold a closer
+ * element. Ties are broken by the element index, so the result matches FindGuiElementFromBoundsLinear().
+ *
+ * @param exclude The element index to skip, which is the one at the given bounds, or -1.
+ * @return The element index of the target, or -1 if there is none.
+ */
+int FindGuiElementFromBoundsIndexed(GuiContainer* container, Rectangle active, int exclude, int direction) {
+    GuiSpatialIndex* index = container->spatialIndex;
+    if (index->count == 0) {
+        return -1;
+    }
+
+    // Only search the cells that could hold an element in the desired direction.
+    int minX = index->minCellX;
+    int minY = index->minCellY;
+    int maxX = index->maxCellX;
+    int maxY = index->maxCellY;
+    int limit;
+    switch (direction) {
+        case UP:
+            limit = GetGuiSpatialIndexCell(active.y + index->maxHeight / 2);
+            if (limit < maxY) maxY = limit;
+            break;
+        case DOWN:
+            limit = GetGuiSpatialIndexCell(active.y + index->minHeight / 2);
+            if (limit > minY) minY = limit;
+            break;
+        case LEFT:
+            limit = GetGuiSpatialIndexCell(active.x + index->maxWidth / 2);
+            if (limit < maxX) maxX = limit;
+            break;
+        case RIGHT:
+            limit = GetGuiSpatialIndexCell(active.x + index->minWidth / 2);
+            if (limit > minX) minX = limit;
+            break;
+    }
+    if (minX > maxX || minY > maxY) {
+        return -1;
+    }
+
+    // A sparse layout has more cells than elements, so checking every element is cheaper.
+    if ((float)(maxX - minX + 1) * (float)(maxY - minY + 1) > (float)index->count * 4) {
+        return FindGuiElementFromBoundsLinear(container, active, exclude, direction);
+    }
+
+    Vector2 activeCenter = GetGuiElementCenter(active);
+    int centerX = GetGuiSpatialIndexCell(activeCenter.x);
+    int centerY = GetGuiSpatialIndexCell(activeCenter.y);
+    float targetDistance = 99999999; // The furthest away.
+    int target = -1;
+
+    for (int ring = 0; ; ring++) {
+        int fromY = centerY - ring < minY ? minY : centerY - ring;
+        int toY = centerY + ring > maxY ? maxY : centerY + ring;
+        int fromX = centerX - ring < minX ? minX : centerX - ring;
+        int toX = centerX + ring > maxX ? maxX : centerX + ring;
+        for (int y = fromY; y <= toY; y++) {
+            // The top and bottom rows of the ring are complete, the others only have their left and right cells.
+            if (y == centerY - ring || y == centerY + ring) {
+                for (int x = fromX; x <= toX; x++) {
+                    FindGuiElementInCell(container, active, exclude, x, y, direction, &target, &targetDistance);
+                }
+            }
+            else {
+                if (centerX - ring >= minX && centerX - ring <= maxX) {
+                    FindGuiElementInCell(container, active, exclude, centerX - ring, y, direction, &target, &targetDistance);
+                }
+                if (centerX + ring >= minX && centerX + ring <= maxX) {
+                    FindGuiElementInCell(container, active, exclude, centerX + ring, y, direction, &target, &targetDistance);
+                }
+            }
+        }
+
+        // Unvisited cells are at least a ring away, with one more ring of slack for floating point error.
+        if (target >= 0 && targetDistance < (float)(ring - 1) * RAYGUI_CONTAINER_GRID_CELL_SIZE) {
+            break;
+        }
+
+        // Stop once the ring covers the whole search area.
+        if (centerX - ring <= minX && centerX + ring >= maxX && centerY - ring <= minY && centerY + ring >= maxY) {
+            break;
+        }
+    }
+
+    return target;
+}
+
+/**
+ * Find the closest selectable element in the desired direction from the given element through the spatial index.
+ *
+ * @return The element index of the target, or -1 if there is none.
+ */
+int FindGuiElementInDirectionIndexed(GuiContainer* container, int element, int direction) {
+    return FindGuiElementFromBoundsIndexed(container, container->bounds[element], element, direction);
+}
+
+/**
+ * Find the closest selectable element in the desired direction from the given bounds.
+ *
+ * @return The element index of the target, or -1 if there is none.
+ */
+int FindGuiElementFromBounds(GuiContainer* container, Rectangle active, int exclude, int direction) {
+    GUI_PROFILE_BEGIN(start);
+#if defined(RAYGUI_CONTAINER_NO_SPATIAL_INDEX)
+    int target = FindGuiElementFromBoundsLinear(container, active, exclude, direction);
+#else
+    int target = FindGuiElementFromBoundsIndexed(container, active, exclude, direction);
+#endif
+    GUI_PROFILE_END(container, GUI_PHASE_NAVIGATION, start, 1);
+    GUI_PROFILE_COUNT(container, navigationSearches, 1);
+    return target;
+}
+
+/**
+ * Keep the element in the open list only while it has a cached direction without any neighbour.
+ */
+void UpdateGuiNavigationOpen(GuiNavigationGraph* graph, int slot) {
+    bool open = false;
+    for (int direction = UP; direction <= LEFT; direction++) {
+        if ((graph->cached[slot] & (1 << direction)) && graph->neighbours[slot * 4 + direction] < 0) {
+            open = true;
+        }
+    }
+
+    if (open && graph->openIndex[slot] < 0) {
+        graph->openIndex[slot] = graph->openCount;
+        graph->open[graph->openCount++] = slot;
+    }
+    else if (!open && graph->openIndex[slot] >= 0) {
+        int last = graph->open[--graph->openCount];
+        graph->open[graph->openIndex[slot]] = last;
+        graph->openIndex[last] = graph->openIndex[slot];
+        graph->openIndex[slot] = -1;
+    }
+}
+
+/**
+ * Clear the cached directions of an element that the changed element affects.
+ *
+ * @param changed The element index of the element that was added or moved, or -1.
+ * @param target The handle index of the element that was removed or moved, or -1.
+ */
+void InvalidateGuiNavigationEntry(GuiContainer* container, int element, int changed, int target) {
+    GuiNavigationGraph* graph = container->navigation;
+    int slot = container->ids[element];
+    if (element == changed || (graph->cached[slot] & 0x0F) == 0) {
+        return;
+    }
+
+    Rectangle bounds = container->bounds[element];
+    Vector2 center = GetGuiElementCenter(bounds);
+    unsigned char cached = graph->cached[slot];
+    for (int direction = UP; direction <= LEFT; direction++) {
+        if ((cached & (1 << direction)) == 0) {
+            continue;
+        }
+
+        int neighbour = graph->neighbours[slot * 4 + direction];
+        if (target >= 0 && neighbour == target) {
+            cached &= ~(1 << direction);
+            continue;
+        }
+
+        // The changed element takes over if it's at least as close as the cached neighbour.
+        if (changed >= 0) {
+            float distance = GetGuiElementDirectionDistance(bounds, center, container->bounds[changed], direction);
+            if (distance >= 0 && (neighbour < 0 || distance <= graph->distances[slot * 4 + direction])) {
+                cached &= ~(1 << direction);
+            }
+        }
+    }
+
+    if (cached != graph->cached[slot]) {
+        graph->cached[slot] = cached;
+        UpdateGuiNavigationOpen(graph, slot);
+    }
+}
+
+/**
+ * Clear the cached directions affected by a change around the given bounds.
+ *
+ * Any entry that pointed at the element, or that the element is now closer to, is within the largest cached distance
+ * of it, or has no neighbour at all.
+ *
+ * @param changed The element index of the element that was added or moved, or -1.
+ * @param target The handle index of the element that was removed or moved, or -1.
+ */
+void InvalidateGuiNavigationAround(GuiContainer* container, Rectangle bounds, int changed, int target) {
+    GuiNavigationGraph* graph = container->navigation;
+    GuiSpatialIndex* index = container->spatialIndex;
+    if (changed >= 0 && !(container->flags[changed] & GUI_ELEMENT_SELECTABLE)) {
+        changed = -1;
+    }
+    if (changed < 0 && target < 0) {
+        return;
+    }
+
+    // Entries without a neighbour in some direction could pick up any element.
+    if (changed >= 0) {
+        for (int i = graph->openCount - 1; i >= 0; i--) {
+            InvalidateGuiNavigationEntry(container, container->slots[graph->open[i]], changed, -1);
+        }
+    }
+
+    // Visit the cells within the largest cached distance, or every element if that's cheaper.
+    Vector2 center = GetGuiElementCenter(bounds);
+    float radius = graph->maxDistance + RAYGUI_CONTAINER_GRID_CELL_SIZE;
+    int minX = GetGuiSpatialIndexCell(center.x - radius);
+    int maxX = GetGuiSpatialIndexCell(center.x + radius);
+    int minY = GetGuiSpatialIndexCell(center.y - radius);
+    int maxY = GetGuiSpatialIndexCell(center.y + radius);
+    if (minX < index->minCellX) minX = index->minCellX;
+    if (maxX > index->maxCellX) maxX = index->maxCellX;
+    if (minY < index->minCellY) minY = index->minCellY;
+    if (maxY > index->maxCellY) maxY = index->maxCellY;
+
+    if ((float)(maxX - minX + 1) * (float)(maxY - minY + 1) > (float)container->count) {
+        for (int i = 0; i < container->count; i++) {
+            InvalidateGuiNavigationEntry(container, i, changed, target);
+        }
+        return;
+    }
+
+    for (int y = minY; y <= maxY; y++) {
+        for (int x = minX; x <= maxX; x++) {
+            int current = index->buckets[GetGuiSpatialIndexBucket(index, x, y)];
+            for (; current >= 0; current = index->next[current]) {
+                if (index->cellX[current] == x && index->cellY[current] == y) {
+                    InvalidateGuiNavigationEntry(container, container->slots[current], changed, target);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Clear the cached tab order of the elements before the given element index, up to and including the first selectable
+ * one, which are the elements whose next element could be the given one.
+ */
+void InvalidateGuiNavigationTabOrder(GuiContainer* container, int element) {
+    GuiNavigationGraph* graph = container->navigation;
+    for (int i = element - 1; i >= 0; i--) {
+        graph->cached[container->ids[i]] &= ~(1 << GUI_NAVIGATION_TAB);
+        if (container->flags[i] & GUI_ELEMENT_SELECTABLE) {
+            break;
+        }
+    }
+}
+
+/**
+ * Clear every cached direction and the tab order of the element at the given handle index.
+ */
+void ClearGuiNavigationEntry(GuiNavigationGraph* graph, int slot) {
+    graph->cached[slot] = 0;
+    UpdateGuiNavigationOpen(graph, slot);
+}
+
+/**
+ * Get the neighbour of an element in the given direction, searching for it only if it isn't cached.
+ *
+ * @return The element index of the neighbour, or -1 if there is none.
+ */
+int GetGuiElementNeighbour(GuiContainer* container, int element, int direction) {
+    GuiNavigationGraph* graph = container->navigation;
+    int slot = container->ids[element];
+    GUI_PROFILE_COUNT(container, navigationQueries, 1);
+    if (graph->cached[slot] & (1 << direction)) {
+        int neighbour = graph->neighbours[slot * 4 + direction];
+        return neighbour >= 0 ? container->slots[neighbour] : -1;
+    }
+
+    int target = FindGuiElementFromBounds(container, container->bounds[element], element, direction);
+
+    graph->cached[slot] |= 1 << direction;
+    graph->neighbours[slot * 4 + direction] = target >= 0 ? container->ids[target] : -1;
+    if (target >= 0) {
+        Rectangle bounds = container->bounds[element];
+        float distance = GetGuiElementDirectionDistance(bounds, GetGuiElementCenter(bounds), container->bounds[target], direction);
+        graph->distances[slot * 4 + direction] = distance;
+        if (distance > graph->maxDistance) {
+            graph->maxDistance = distance;
+        }
+    }
+    else {
+        UpdateGuiNavigationOpen(graph, slot);
+    }
+
+    return target;
+}
+
+/**
+ * Get the next element in tab order, which is the next selectable element, wrapping around to the first element.
+ *
+ * @return The element index of the next element.
+ */
+int GetGuiElementTabNext(GuiContainer* container, int element) {
+    GuiNavigationGraph* graph = container->navigation;
+    int slot = container->ids[element];
+    if ((graph->cached[slot] & (1 << GUI_NAVIGATION_TAB)) == 0) {
+        // Find the next selectable element after the current one.
+        int next = element;
+        while (++next < container->count && !(container->flags[next] & GUI_ELEMENT_SELECTABLE));
+
+        graph->tabNext[slot] = next < container->count ? container->ids[next] : -1;
+        graph->cached[slot] |= 1 << GUI_NAVIGATION_TAB;
+    }
+
+    // If it reached the end, loop back to the beginning.
+    int next = graph->tabNext[slot];
+    return next >= 0 ? container->slots[next] : 0;
+}
+
+/**
+ * Find the elements the focused element can reach with directional navigation, filling in any uncached neighbours.
+ *
+ * @return An array of flags, indexed by element index, to be freed with MemFree().
+ */
+unsigned char* FindReachableGuiElements(GuiContainer* container) {
+    unsigned char* reachable = (unsigned char*)MemAlloc(container->count > 0 ? container->count : 1);
+    int* queue = (int*)MemAlloc((container->count > 0 ? container->count : 1) * sizeof(int));
+    for (int i = 0; i < container->count; i++) {
+        reachable[i] = 0;
+    }
+
+    int head = 0;
+    int tail = 0;
+    if (container->activeElement >= 0) {
+        reachable[container->activeElement] = 1;
+        queue[tail++] = container->activeElement;
+    }
+
+    while (head < tail) {
+        int element = queue[head++];
+        for (int direction = UP; direction <= LEFT; direction++) {
+            int neighbour = GetGuiElementNeighbour(container, element, direction);
+            if (neighbour >= 0 && !reachable[neighbour]) {
+                reachable[neighbour] = 1;
+                queue[tail++] = neighbour;
+            }
+        }
+    }
+
+    MemFree(queue);
+    return reachable;
+}
+
+GuiElement GetGuiElementHandle(GuiContainer* container, int element) {
+    if (element < 0) {
+        return (GuiElement){-1, 0};
+    }
+
+    int slot = container->ids[element];
+    return (GuiElement){slot, container->generations[slot]};
+}
+
+/**
+ * Get the navigation graph of the selectable elements, to debug elements that can't be reached with the keyboard or
+ * gamepad. Any neighbours that aren't cached yet are found first.
+ *
+ * @return The number of nodes written, at most maxNodes.
+ */
+int GetGuiContainerNavigation(GuiContainer* container, GuiNavigationNode* nodes, int maxNodes) {
+    unsigned char* reachable = FindReachableGuiElements(container);
+    int count = 0;
+    for (int i = 0; i < container->count && count < maxNodes; i++) {
+        if (!(container->flags[i] & GUI_ELEMENT_SELECTABLE)) {
+            continue;
+        }
+
+        GuiNavigationNode* node = nodes + count++;
+        node->element = GetGuiElementHandle(container, i);
+        for (int direction = UP; direction <= LEFT; direction++) {
+            node->neighbours[direction] = GetGuiElementHandle(container, GetGuiElementNeighbour(container, i, direction));
+        }
+        node->tabNext = GetGuiElementHandle(container, GetGuiElementTabNext(container, i));
+        node->reachable = reachable[i];
+    }
+
+    MemFree(reachable);
+    return count;
+}
+
+/**
+ * Save the navigation graph as a Graphviz DOT file. Elements that can't be reached are drawn in red.
+ */
+bool ExportGuiContainerNavigation(GuiContainer* container, const char* fileName) {
+    FILE* file = fopen(fileName, "w");
+    if (file == NULL) {
+        return false;
+    }
+
+    const char* directions[] = { "UP", "RIGHT", "DOWN", "LEFT" };
+    unsigned char* reachable = FindReachableGuiElements(container);
+    fprintf(file, "digraph GuiContainer {\n");
+    for (int i = 0; i < container->count; i++) {
+        if (!(container->flags[i] & GUI_ELEMENT_SELECTABLE)) {
+            continue;
+        }
+
+        // Quotes would end the label early.
+        fprintf(file, "    e%d [label=\"", container->ids[i]);
+        for (const char* text = container->states[i].text; text != NULL && *text != '\0'; text++) {
+            fputc(*text == '"' ? '\'' : *text, file);
+        }
+        fprintf(file, "\"%s];\n", reachable[i] ? "" : ", color=red");
+
+        for (int direction = UP; direction <= LEFT; direction++) {
+            int neighbour = GetGuiElementNeighbour(container, i, direction);
+            if (neighbour >= 0) {
+                fprintf(file, "    e%d -> e%d [label=\"%s\"];\n", container->ids[i], container->ids[neighbour], directions[direction]);
+            }
+        }
+        fprintf(file, "    e%d -> e%d [label=\"TAB\", style=dashed];\n", container->ids[i], container->ids[GetGuiElementTabNext(container, i)]);
+    }
+    fprintf(file, "}\n");
+
+    MemFree(reachable);
+    fclose(file);
+    return true;
+}
+
+/**
+ * Get the container nested in the given group element.
+ */
+GuiContainer* GetGuiGroupContainer(GuiContainer* container, int element) {
+    return container->states[element].container;
+}
+
+/**
+ * Get the element index of a nested container's group element in its parent.
+ */
+int GetGuiGroupElementIndex(GuiContainer* container) {
+    return GetGuiElementIndex(container->group->parent, container->group->element);
+}
+
+/**
+ * Get the screen position of a container's origin, as of the last time its groups were drawn.
+ */
+Vector2 GetGuiContainerOrigin(GuiContainer* container) {
+    Vector2 origin = { 0, 0 };
+    for (GuiGroup* group = container->group; group != NULL; group = group->parent->group) {
+        origin.x += group->view.x + group->scroll.x;
+        origin.y += group->view.y + group->scroll.y;
+    }
+    return origin;
+}
+
+/**
+ * Get the area inside a group's border and header, which its content is shown in.
+ */
+Rectangle GetGuiGroupView(GuiGroup* group, Rectangle bounds, const char* text) {
+    float header = (group->type == GUI_GROUP_WINDOW_BOX || text != NULL) ? (float)RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT : 0;
+    float border = (float)GetGuiContainerStyle(group->parent, DEFAULT, BORDER_WIDTH);
+    return (Rectangle){ bounds.x + border, bounds.y + header + border, bounds.width - 2 * border, bounds.height - header - 2 * border };
+}
+
+/**
+ * Check whether a container is on the path to the focused element, which the root container always is.
+ */
+bool IsGuiContainerFocused(GuiContainer* container) {
+    for (; container->group != NULL; container = container->group->parent) {
+        if (container->group->parent->activeElement != GetGuiGroupElementIndex(container)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Get the innermost container holding the focused element.
+ */
+GuiContainer* GetGuiFocusedContainer(GuiContainer* container) {
+    while (container->activeElement >= 0 && (container->flags[container->activeElement] & GUI_ELEMENT_GROUP)) {
+        GuiContainer* nested = GetGuiGroupContainer(container, container->activeElement);
+        if (nested->activeElement < 0) {
+            break;
+        }
+        container = nested;
+    }
+    return container;
+}
+
+/**
+ * Clear the focus inside a group element, once focus moves away from it.
+ */
+void ClearGuiGroupFocus(GuiContainer* container, int element) {
+    while (element >= 0 && (container->flags[element] & GUI_ELEMENT_GROUP)) {
+        container = GetGuiGroupContainer(container, element);
+        element = container->activeElement;
+        container->activeElement = -1;
+        container->focusLocked = false;
+    }
+}
+
+/**
+ * Give focus to an element, and to the group elements of the containers it's nested in.
+ */
+void FocusGuiElement(GuiContainer* container, int element) {
+    for (;;) {
+        if (container->activeElement != element) {
+            ClearGuiGroupFocus(container, container->activeElement);
+            container->activeElement = element;
+            container->focusLocked = false;
+        }
+
+        if (container->group == NULL) {
+            return;
+        }
+        element = GetGuiGroupElementIndex(container);
+        container = container->group->parent;
+    }
+}
+
+/**
+ * Scroll the scroll panels an element is nested in, so as much of the element as fits is in view.
+ */
+void ScrollGuiElementIntoView(GuiContainer* container, int element) {
+    Rectangle bounds = container->bounds[element];
+    for (GuiGroup* group = container->group; group != NULL; group = group->parent->group) {
+        if (group->type == GUI_GROUP_SCROLL_PANEL) {
+            // Show the far edge first, so the near edge wins when the element is larger than the view.
+            if (bounds.x + bounds.width + group->scroll.x > group->view.width) {
+                group->scroll.x = group->view.width - bounds.x - bounds.width;
+            }
+            if (bounds.x + group->scroll.x < 0) {
+                group->scroll.x = -bounds.x;
+            }
+            if (bounds.y + bounds.height + group->scroll.y > group->view.height) {
+                group->scroll.y = group->view.height - bounds.y - bounds.height;
+            }
+            if (bounds.y + group->scroll.y < 0) {
+                group->scroll.y = -bounds.y;
+            }
+        }
+
+        // Continue with the element's bounds in the parent.
+        bounds.x += group->view.x + group->scroll.x;
+        bounds.y += group->view.y + group->scroll.y;
+    }
+}
+
+/**
+ * Give focus to an element that was navigated to, scrolling it into view.
+ *
+ * @param direction The GuiDirection focus moved in, or -1, which picks the row a list view takes focus on.
+ */
+void NavigateToGuiElement(GuiContainer* container, int element, int direction) {
+    FocusGuiElement(container, element);
+    ScrollGuiElementIntoView(container, element);
+    if (container->types[element] == GUI_TYPE_LISTVIEW) {
+        EnterGuiList(container, container->states[element].list, container->bounds[element], direction);
+    }
+}
+
+/**
+ * Move focus into a group element's nested container, to its closest element in the given direction from the given
+ * screen bounds, or to its first element that can take focus.
+ *
+ * @param direction The GuiDirection, or -1 to go straight to the first element.
+ * @return False if there's nothing inside the group to focus on.
+ */
+bool EnterGuiGroup(GuiContainer* container, int element, Rectangle from, int direction) {
+    GuiContainer* nested = GetGuiGroupContainer(container, element);
+    if (nested->group->collapsed) {
+        return false;
+    }
+
+    if (direction >= 0) {
+        Vector2 origin = GetGuiContainerOrigin(nested);
+        int target = FindGuiElementFromBounds(nested, OffsetGuiRectangle(from, (Vector2){ -origin.x, -origin.y }), -1, direction);
+        if (target >= 0 && !(nested->flags[target] & GUI_ELEMENT_GROUP)) {
+            NavigateToGuiElement(nested, target, direction);
+            return true;
+        }
+        if (target >= 0 && EnterGuiGroup(nested, target, from, direction)) {
+            return true;
+        }
+    }
+
+    for (int i = 0; i < nested->count; i++) {
+        if (!(nested->flags[i] & GUI_ELEMENT_SELECTABLE)) {
+            continue;
+        }
+        if (!(nested->flags[i] & GUI_ELEMENT_GROUP)) {
+            NavigateToGuiElement(nested, i, direction);
+            return true;
+        }
+        if (EnterGuiGroup(nested, i, from, -1)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Move focus to the closest element in the desired direction.
+ *
+ * When a nested container has nothing further in that direction, the search continues from its group element in the
+ * parent. Landing on a group element moves focus into it.
+ */
+void SetNextActiveGuiElement(GuiContainer* container, int direction) {
+    container = GetGuiFocusedContainer(container);
+    int element = container->activeElement;
+    Rectangle from = OffsetGuiRectangle(container->bounds[element], GetGuiContainerOrigin(container));
+
+    for (;;) {
+        // Find the closest selectable element in the desired direction.
+        int target = GetGuiElementNeighbour(container, element, direction);
+
+        // Switch the active element to the new target.
+        if (target >= 0) {
+            if (!(container->flags[target] & GUI_ELEMENT_GROUP)) {
+                NavigateToGuiElement(container, target, direction);
+            }
+            else {
+                EnterGuiGroup(container, target, from, direction);
+            }
+            return;
+        }
+
+        if (container->group == NULL) {
+            return;
+        }
+        element = GetGuiGroupElementIndex(container);
+        container = container->group->parent;
+    }
+}
+
+/**
+ * Move focus to the next element in tab order, continuing into and out of nested containers, and wrapping around to
+ * the first element of the root container.
+ */
+void SetNextTabGuiElement(GuiContainer* container) {
+    container = GetGuiFocusedContainer(container);
+    int element = container->activeElement;
+    bool wrapped = false;
+
+    for (;;) {
+        // The next element wraps around to the first one once the end of the container is reached.
+        int next = GetGuiElementTabNext(container, element);
+        if (next <= element) {
+            if (container->group != NULL) {
+                element = GetGuiGroupElementIndex(container);
+                container = container->group->parent;
+                continue;
+            }
+
+            // Stop if nothing in the whole tree can take focus.
+            if (wrapped) {
+                return;
+            }
+            wrapped = true;
+        }
+
+        if (!(container->flags[next] & GUI_ELEMENT_GROUP)) {
+            NavigateToGuiElement(container, next, -1);
+            return;
+        }
+        if (EnterGuiGroup(container, next, (Rectangle){ 0 }, -1)) {
+            return;
+        }
+        element = next;
+    }
+}
+
+/**
+ * Find the element under the given screen position, looking inside the groups it's over.
+ *
+ * @param container The container to search, which is set to the container holding the element.
+ * @return The element index, or -1 if there is none.
+ */
+int FindGuiElementAtScreenPoint(GuiContainer** container, Vector2 point) {
+    GUI_PROFILE_BEGIN(start);
+#if defined(RAYGUI_CONTAINER_PROFILE)
+    int tested = 0;
+#endif
+    for (;;) {
+        GUI_PROFILE_COUNT(*container, elementsHitTested, (*container)->count);
+#if defined(RAYGUI_CONTAINER_PROFILE)
+        tested += (*container)->count;
+#endif
+        int hit = FindGuiElementAtPoint(*container, point);
+        if (hit < 0 || !((*container)->flags[hit] & GUI_ELEMENT_GROUP)) {
+            GUI_PROFILE_END(*container, GUI_PHASE_HIT_TEST, start, tested);
+            return hit;
+        }
+
+        // A group's content is only shown in its view, not under its header or scroll bars.
+        GuiContainer* nested = GetGuiGroupContainer(*container, hit);
+        GuiGroup* group = nested->group;
+        if (!CheckCollisionPointRec(point, group->view)) {
+            GUI_PROFILE_END(*container, GUI_PHASE_HIT_TEST, start, tested);
+            return -1;
+        }
+        point.x -= group->view.x + group->scroll.x;
+        point.y -= group->view.y + group->scroll.y;
+        *container = nested;
+    }
+}
+
+/**
+ * Get the handle of a nested container's group element in its parent, which moves or removes the whole group.
+ *
+ * @return The handle, with an index of -1 for the root container.
+ */
+GuiElement GetGuiContainerElement(GuiContainer* container) {
+    if (container->group == NULL) {
+        return (GuiElement){-1, 0};
+    }
+    return container->group->element;
+}
+
+/**
+ * Collapse a nested container, which hides it and skips it for drawing, hit-testing and navigation, or expand it.
+ */
+void SetGuiContainerCollapsed(GuiContainer* container, bool collapsed) {
+    GuiGroup* group = container->group;
+    if (group == NULL || group->collapsed == collapsed) {
+        return;
+    }
+
+    // A collapsed group can't take focus, so it's taken out of the navigation graph.
+    GuiContainer* parent = group->parent;
+    int element = GetGuiGroupElementIndex(container);
+    group->collapsed = collapsed;
+    InvalidateGuiNavigationTabOrder(parent, element);
+    if (collapsed) {
+        InvalidateGuiNavigationAround(parent, parent->bounds[element], -1, group->element.index);
+        parent->flags[element] &= ~GUI_ELEMENT_SELECTABLE;
+        if (parent->activeElement == element) {
+            ClearGuiGroupFocus(parent, element);
+        }
+    }
+    else {
+        parent->flags[element] |= GUI_ELEMENT_SELECTABLE;
+        InvalidateGuiNavigationAround(parent, parent->bounds[element], element, -1);
+    }
+}
+
+bool IsGuiContainerCollapsed(GuiContainer* container) {
+    return container->group != NULL && container->group->collapsed;
+}
+
+/**
+ * Set the scroll offset of a scroll panel's content, which is negative once scrolled down or right.
+ */
+void SetGuiContainerScroll(GuiContainer* container, Vector2 scroll) {
+    if (container->group != NULL) {
+        container->group->scroll = scroll;
+    }
+}
+
+Vector2 GetGuiContainerScroll(GuiContainer* container) {
+    if (container->group == NULL) {
+        return (Vector2){ 0, 0 };
+    }
+    return container->group->scroll;
+}
+
+/**
+ * Set the devices a container polls in UpdateGuiContainer(). Containers poll every device by default.
+ */
+void SetGuiContainerInputSource(GuiContainer* container, GuiInputSource source) {
+    container->input->source = source;
+}
+
+GuiInputSource GetGuiContainerInputSource(GuiContainer* container) {
+    return container->input->source;
+}
+
+/**
+ * Override a raygui style property while the container, and the containers nested in it, are drawn. As with
+ * GuiSetStyle(), a DEFAULT property applies to every control.
+ *
+ * @return False if the container already holds RAYGUI_CONTAINER_MAX_STYLES overrides.
+ */
+bool SetGuiContainerStyle(GuiContainer* container, int control, int property, int value) {
+    GuiContainerStyle* style = container->style;
+    int index = 0;
+    while (index < style->count && !(style->controls[index] == control && style->properties[index] == property)) {
+        index++;
+    }
+    if (index == RAYGUI_CONTAINER_MAX_STYLES) {
+        return false;
+    }
+
+    // A new override goes last, so it wins over the DEFAULT overrides before it.
+    if (index == style->count) {
+        style->count++;
+    }
+    style->controls[index] = control;
+    style->properties[index] = property;
+    style->values[index] = value;
+#if defined(RAYGUI_CONTAINER_RETAINED)
+    InvalidateGuiContainerDrawCache(container);
+#endif
+    return true;
+}
+
+void ClearGuiContainerStyles(GuiContainer* container) {
+    container->style->count = 0;
+#if defined(RAYGUI_CONTAINER_RETAINED)
+    InvalidateGuiContainerDrawCache(container);
+#endif
+}
+
+/**
+ * Lock a container, which ignores its input and is drawn with raygui locked, along with the containers nested in it.
+ */
+void SetGuiContainerLocked(GuiContainer* container, bool locked) {
+    container->style->locked = locked;
+}
+
+/**
+ * Set the alpha a container, and the containers nested in it, are drawn with, on top of raygui's GuiFade().
+ */
+void SetGuiContainerAlpha(GuiContainer* container, float alpha) {
+    container->style->alpha = alpha;
+}
+
+/**
+ * Adjust a slider, spinner or value box by the given number of steps, each its step, or 5% of its range without one.
+ *
+ * An element with a step snaps to it. The part of an adjustment too small to reach the next step is kept, so small,
+ * continuous adjustments add up.
+ */
+void AdjustGuiValueElement(GuiContainer* container, int element, float steps) {
+    GuiValueState* state = &container->states[element].value;
+    float value = state->value;
+    float step = state->step > 0 ? state->step : (state->max - state->min) * RAYGUI_CONTAINER_ADJUST_STEP;
+    float target = value + state->pending + step * steps;
+
+    // Keep the value in the min/max bounds.
+    if (target < state->min) {
+        target = state->min;
+    }
+    else if (target > state->max) {
+        target = state->max;
+    }
+
+    state->value = target;
+    if (state->step > 0) {
+        state->value = state->min + (float)(int)((target - state->min) / step + 0.5f) * step;
+        if (state->value > state->max) {
+            state->value -= step;
+        }
+    }
+    state->pending = target - state->value;
+
+    if (state->value != value) {
+        PushGuiEvent(container, element, GUI_EVENT_VALUE_CHANGED, value, state->value);
+    }
+}
+
+/**
+ * Move the choice of a toggle group, combo box or dropdown box by the given number of items.
+ */
+void AdjustGuiChoiceElement(GuiContainer* container, int element, float steps) {
+    GuiChoiceState* state = &container->states[element].choice;
+    int active = state->active + (int)steps;
+    if (active >= state->count) {
+        active = state->count - 1;
+    }
+    if (active < 0) {
+        active = 0;
+    }
+
+    if (active != state->active) {
+        PushGuiEvent(container, element, GUI_EVENT_VALUE_CHANGED, (float)state->active, (float)active);
+        state->active = active;
+    }
+}
+
+/**
+ * Turn the hue of a color picker by the given number of steps, each 5% of the way around the color wheel.
+ */
+void AdjustGuiColorPickerElement(GuiContainer* container, int element, float steps) {
+    GuiColorState* state = &container->states[element].color;
+    float hue = state->hue + steps * 360.0f * RAYGUI_CONTAINER_ADJUST_STEP;
+    hue -= 360.0f * (float)(int)(hue / 360.0f);
+    if (hue < 0) {
+        hue += 360.0f;
+    }
+
+    if (hue != state->hue) {
+        PushGuiEvent(container, element, GUI_EVENT_VALUE_CHANGED, state->hue, hue);
+        state->hue = hue;
+        state->color = SetGuiColorHue(state->color, hue);
+    }
+}
+
+/**
+ * Move a list view's focus by the given number of pages.
+ */
+void AdjustGuiListViewElement(GuiContainer* container, int element, float steps) {
+    Rectangle bounds = container->bounds[element];
+    MoveGuiListFocus(container, container->states[element].list, bounds, GetGuiListVisibleRows(container, bounds) * (int)steps);
+}
+
+/**
+ * Adjust the given element by the given number of steps, which means something different to each type of element.
+ */
+void AdjustGuiElement(GuiContainer* container, int element, float steps) {
+    const GuiElementClass* elementClass = GetGuiElementClass(container->types[element]);
+    if (elementClass->adjust != NULL) {
+        elementClass->adjust(container, element, steps);
+    }
+}
+
+void ActivateGuiButtonElement(GuiContainer* container, int element) {
+    container->states[element].pressed = true;
+    PushGuiEvent(container, element, GUI_EVENT_PRESSED, 0, 1);
+}
+
+void ActivateGuiCheckBoxElement(GuiContainer* container, int element) {
+    GuiElementState* state = container->states + element;
+    state->checked = !state->checked;
+    PushGuiEvent(container, element, GUI_EVENT_TOGGLED, state->checked ? 0.0f : 1.0f, state->checked ? 1.0f : 0.0f);
+}
+
+/**
+ * Lock or unlock focus on an element. Elements that are changed a bit at a time, or typed into, take the input that
+ * would otherwise move focus while they're focus locked.
+ */
+void ActivateGuiLockingElement(GuiContainer* container, int element) {
+    container->focusLocked = !container->focusLocked;
+    if (GetGuiElementClass(container->types[element])->flags & GUI_CLASS_VALUE) {
+        container->states[element].value.pending = 0;
+    }
+}
+
+/**
+ * Move a combo box on to its next item, going back to the first after the last.
+ */
+void ActivateGuiComboBoxElement(GuiContainer* container, int element) {
+    GuiChoiceState* state = &container->states[element].choice;
+    if (state->count > 1) {
+        int active = (state->active + 1) % state->count;
+        PushGuiEvent(container, element, GUI_EVENT_VALUE_CHANGED, (float)state->active, (float)active);
+        state->active = active;
+    }
+}
+
+/**
+ * Select the focused row of a list view.
+ */
+void ActivateGuiListViewElement(GuiContainer* container, int element) {
+    GuiList* list = container->states[element].list;
+    if (list->getCount(list->userData) > 0 && list->active != list->focus) {
+        PushGuiEvent(container, element, GUI_EVENT_VALUE_CHANGED, (float)list->active, (float)list->focus);
+        list->active = list->focus;
+    }
+}
+
+/**
+ * Press the given element.
+ */
+void ActivateGuiElement(GuiContainer* container, int element) {
+    const GuiElementClass* elementClass = GetGuiElementClass(container->types[element]);
+    if (elementClass->activate != NULL) {
+        elementClass->activate(container, element);
+    }
+}
+
+/**
+ * Adjust a focus locked element with left/right, which keeps focus from moving.
+ */
+bool NavigateGuiAdjustableElement(GuiContainer* container, int element, int direction) {
+    if (container->focusLocked && (direction == LEFT || direction == RIGHT)) {
+        AdjustGuiElement(container, element, direction == LEFT ? -1.0f : 1.0f);
+    }
+    return container->focusLocked;
+}
+
+/**
+ * Move through an open dropdown box's items with up/down, which keeps focus from moving.
+ */
+bool NavigateGuiDropdownBoxElement(GuiContainer* container, int element, int direction) {
+    if (container->focusLocked && (direction == UP || direction == DOWN)) {
+        AdjustGuiElement(container, element, direction == UP ? -1.0f : 1.0f);
+    }
+    return container->focusLocked;
+}
+
+/**
+ * Move a list view's focus between its rows, until there are no more rows in that direction.
+ */
+bool NavigateGuiListViewElement(GuiContainer* container, int element, int direction) {
+    if (direction != UP && direction != DOWN) {
+        return false;
+    }
+    return MoveGuiListFocus(container, container->states[element].list, container->bounds[element], direction == UP ? -1 : 1);
+}
+
+void ScrollGuiListViewElement(GuiContainer* container, int element, Rectangle bounds, Vector2 point, float amount) {
+    ScrollGuiList(container, container->states[element].list, bounds, point, (int)amount);
+}
+
+void DragGuiListViewElement(GuiContainer* container, int element, Rectangle bounds, Vector2 point) {
+    DragGuiListScrollBar(container, container->states[element].list, bounds, point);
+}
+
+/**
+ * Step a spinner when one of its buttons is clicked, or press it when the value between them is.
+ */
+void ClickGuiSpinnerElement(GuiContainer* container, int element, Rectangle bounds, Vector2 point) {
+    if (!CheckCollisionPointRec(point, bounds)) {
+        return;
+    }
+
+    float buttonWidth = (float)GetGuiContainerStyle(container, SPINNER, SPIN_BUTTON_WIDTH);
+    if (point.x < bounds.x + buttonWidth) {
+        AdjustGuiElement(container, element, -1.0f);
+    }
+    else if (point.x >= bounds.x + bounds.width - buttonWidth) {
+        AdjustGuiElement(container, element, 1.0f);
+    }
+    else {
+        ActivateGuiElement(container, element);
+    }
+}
+
+/**
+ * Choose the item of a toggle group that was clicked.
+ */
+void ClickGuiToggleGroupElement(GuiContainer* container, int element, Rectangle bounds, Vector2 point) {
+    GuiChoiceState* state = &container->states[element].choice;
+    for (int i = 0; i < state->count; i++) {
+        if (CheckCollisionPointRec(point, GetGuiToggleGroupItemBounds(container, element, bounds, i))) {
+            AdjustGuiElement(container, element, (float)(i - state->active));
+            return;
+        }
+    }
+}
+
+/**
+ * Open a dropdown box when it's clicked, and choose the item that was clicked and close it while it's open.
+ */
+void ClickGuiDropdownBoxElement(GuiContainer* container, int element, Rectangle bounds, Vector2 point) {
+    if (!container->focusLocked) {
+        if (CheckCollisionPointRec(point, bounds)) {
+            ActivateGuiElement(container, element);
+        }
+        return;
+    }
+
+    // The open items are listed below the box, as raygui draws them.
+    GuiChoiceState* state = &container->states[element].choice;
+    float spacing = (float)GetGuiContainerStyle(container, DROPDOWNBOX, DROPDOWN_ITEMS_SPACING);
+    for (int i = 0; i < state->count; i++) {
+        Rectangle item = { bounds.x, bounds.y + (float)(i + 1) * (bounds.height + spacing), bounds.width, bounds.height };
+        if (CheckCollisionPointRec(point, item)) {
+            AdjustGuiElement(container, element, (float)(i - state->active));
+            break;
+        }
+    }
+    container->focusLocked = false;
+}
+
+/**
+ * Pick the saturation and value of a color picker's color from where its panel was clicked, or its hue from where the
+ * hue bar right of the panel was clicked, as raygui picks them while the mouse is down.
+ */
+void ClickGuiColorPickerElement(GuiContainer* container, int element, Rectangle bounds, Vector2 point) {
+    GuiColorState* state = &container->states[element].color;
+    Rectangle hueBar = {
+        bounds.x + bounds.width + (float)GetGuiContainerStyle(container, COLORPICKER, HUEBAR_PADDING), bounds.y,
+        (float)GetGuiContainerStyle(container, COLORPICKER, HUEBAR_WIDTH), bounds.height
+    };
+
+    Color color = state->color;
+    float hue = state->hue;
+    if (CheckCollisionPointRec(point, bounds)) {
+        // Saturation runs left to right, and value bottom to top, so a gray with the same value and chroma takes the hue.
+        float value = 255.0f * (1.0f - (point.y - bounds.y) / bounds.height);
+        float min = value * (1.0f - (point.x - bounds.x) / bounds.width);
+        color = SetGuiColorHue((Color){ (unsigned char)(value + 0.5f), (unsigned char)(min + 0.5f), (unsigned char)(min + 0.5f), color.a }, hue);
+    }
+    else if (CheckCollisionPointRec(point, hueBar)) {
+        hue = (point.y - bounds.y) * 360.0f / bounds.height;
+        if (hue >= 359.0f) {
+            hue = 359.0f;
+        }
+        color = SetGuiColorHue(color, hue);
+    }
+
+    if (color.r != state->color.r || color.g != state->color.g || color.b != state->color.b || hue != state->hue) {
+        PushGuiEvent(container, element, GUI_EVENT_VALUE_CHANGED, state->hue, hue);
+        state->color = color;
+        state->hue = hue;
+    }
+}
+
+/**
+ * Type a codepoint at the end of a focus locked text box, if it fits.
+ */
+void InsertGuiTextBoxCodepoint(GuiContainer* container, int element, int codepoint) {
+    GuiTextBoxState* state = &container->states[element].textBox;
+    if (codepoint < 32 || codepoint > 0x10ffff) {
+        return;
+    }
+
+    // Encode the codepoint as UTF-8.
+    char utf8[4];
+    int codepointSize = codepoint < 0x80 ? 1 : codepoint < 0x800 ? 2 : codepoint < 0x10000 ? 3 : 4;
+    if (codepointSize == 1) {
+        utf8[0] = (char)codepoint;
+    }
+    else {
+        for (int i = codepointSize - 1; i > 0; i--) {
+            utf8[i] = (char)(0x80 | (codepoint & 0x3f));
+            codepoint >>= 6;
+        }
+        utf8[0] = (char)((0xf00 >> codepointSize) | codepoint);
+    }
+
+    int length = (int)strlen(state->buffer);
+    if (length + codepointSize >= state->size) {
+        return;
+    }
+    memcpy(state->buffer + length, utf8, codepointSize);
+    state->buffer[length + codepointSize] = '\0';
+    state->revision++;
+    PushGuiEvent(container, element, GUI_EVENT_TEXT_CHANGED, (float)length, (float)(length + codepointSize));
+}
+
+/**
+ * Delete the last codepoint of a focus locked text box.
+ */
+void DeleteGuiTextBoxCodepoint(GuiContainer* container, int element) {
+    GuiTextBoxState* state = &container->states[element].textBox;
+    int length = (int)strlen(state->buffer);
+    if (length == 0) {
+        return;
+    }
+
+    // Step back over the continuation bytes to the start of the last codepoint.
+    int last = length - 1;
+    while (last > 0 && ((unsigned char)state->buffer[last] & 0xc0) == 0x80) {
+        last--;
+    }
+    state->buffer[last] = '\0';
+    state->revision++;
+    PushGuiEvent(container, element, GUI_EVENT_TEXT_CHANGED, (float)length, (float)last);
+}
+
+void ProcessGuiContainerAction(GuiContainer* container, GuiAction action) {
+    // Actions apply to the focused element, which may be in a nested container.
+    GuiContainer* focused = GetGuiFocusedContainer(container);
+    int active = focused->activeElement;
+
+    // The elements of a locked nested container can take focus, but can't be pressed or changed.
+    if (IsGuiContainerLocked(focused) && (action.type == GUI_ACTION_ACTIVATE || action.type == GUI_ACTION_POINTER_RELEASE ||
+        action.type == GUI_ACTION_ADJUST || action.type == GUI_ACTION_TEXT || action.type == GUI_ACTION_DELETE ||
+        action.type == GUI_ACTION_SCROLL || action.type == GUI_ACTION_POINTER_DRAG)) {
+        return;
+    }
+
+    const GuiElementClass* elementClass = GetGuiElementClass(focused->types[active]);
+    switch (action.type) {
+        case GUI_ACTION_ACTIVATE:
+            ActivateGuiElement(focused, active);
+            break;
+        case GUI_ACTION_POINTER_RELEASE: {
+            // Clicking only presses the element that has focus.
+            Rectangle bounds = OffsetGuiRectangle(focused->bounds[active], GetGuiContainerOrigin(focused));
+            if (elementClass->click != NULL) {
+                elementClass->click(focused, active, bounds, action.position);
+            }
+            else if (CheckCollisionPointRec(action.position, bounds)) {
+                ActivateGuiElement(focused, active);
+            }
+            break;
+        }
+        case GUI_ACTION_SCROLL:
+            if (elementClass->scroll != NULL) {
+                elementClass->scroll(focused, active, OffsetGuiRectangle(focused->bounds[active], GetGuiContainerOrigin(focused)), action.position, action.amount);
+            }
+            break;
+        case GUI_ACTION_POINTER_DRAG:
+            if (elementClass->drag != NULL) {
+                elementClass->drag(focused, active, OffsetGuiRectangle(focused->bounds[active], GetGuiContainerOrigin(focused)), action.position);
+            }
+            break;
+        case GUI_ACTION_ADJUST:
+            AdjustGuiElement(focused, active, (float)action.value + action.amount);
+            break;
+        case GUI_ACTION_NAVIGATE: {
+            // The element gets the first go at a direction, then a focus locked element doesn't let focus switch.
+            bool handled = elementClass->navigate != NULL && elementClass->navigate(focused, active, action.value);
+            if (!handled && !focused->focusLocked) {
+                SetNextActiveGuiElement(container, action.value);
+            }
+            break;
+        }
+        case GUI_ACTION_TEXT:
+            if ((elementClass->flags & GUI_CLASS_TEXT_INPUT) && focused->focusLocked) {
+                InsertGuiTextBoxCodepoint(focused, active, action.value);
+            }
+            break;
+        case GUI_ACTION_DELETE:
+            if ((elementClass->flags & GUI_CLASS_TEXT_INPUT) && focused->focusLocked) {
+                DeleteGuiTextBoxCodepoint(focused, active);
+            }
+            break;
+        case GUI_ACTION_POINTER_MOVE:
+            // Switch the active element to the one under the mouse.
+            if (!focused->focusLocked) {
+                GuiContainer* hoveredContainer = container;
+                int hovered = FindGuiElementAtScreenPoint(&hoveredContainer, action.position);
+                if (hovered >= 0) {
+                    FocusGuiElement(hoveredContainer, hovered);
+
+                    // Focus the row under the mouse, which a click then selects.
+                    if (hoveredContainer->types[hovered] == GUI_TYPE_LISTVIEW) {
+                        GuiList* list = hoveredContainer->states[hovered].list;
+                        Rectangle bounds = OffsetGuiRectangle(hoveredContainer->bounds[hovered], GetGuiContainerOrigin(hoveredContainer));
+                        int row = FindGuiListRowAtPoint(hoveredContainer, list, bounds, action.position);
+                        if (row >= 0) {
+                            list->focus = row;
+                        }
+                    }
+                }
+            }
+            break;
+        case GUI_ACTION_TAB:
+            if (!focused->focusLocked) {
+                SetNextTabGuiElement(container);
+            }
+            break;
+    }
+}
+
+/**
+ * Ease a tween's progress from 0 to 1, starting fast and slowing into its end.
+ */
+float EaseGuiTween(float progress) {
+    float left = 1.0f - progress;
+    return 1.0f - left * left * left;
+}
+
+/**
+ * Find the tween animating the given values in a root container's pool. Fades are found through their element, as
+ * hundreds can be restarted at once. There's only ever a few of the other tweens.
+ *
+ * @return The tween's index in the pool, or -1.
+ */
+int FindGuiTween(GuiAnimation* animation, int type, GuiContainer* container, int slot) {
+    if (type == GUI_TWEEN_FADE) {
+        return container->animation->fades[slot];
+    }
+    for (int i = 0; i < animation->tweenCount; i++) {
+        GuiTween* tween = animation->tweens + i;
+        if (tween->type == type && tween->container == container && tween->slot == slot) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * Start animating values of an element, or of the focus highlight, in a root container's pool. A tween already
+ * animating the same values is restarted, rather than adding another.
+ */
+void StartGuiTween(GuiContainer* root, int type, GuiContainer* container, int slot, const float* from, const float* to, float duration) {
+    GuiAnimation* animation = GetGuiAnimation(root);
+    int index = FindGuiTween(animation, type, container, slot);
+    if (index < 0) {
+        if (animation->tweenCount == animation->tweenCapacity) {
+            animation->tweenCapacity = animation->tweenCapacity == 0 ? 16 : animation->tweenCapacity * 2;
+            animation->tweens = (GuiTween*)MemRealloc(animation->tweens, animation->tweenCapacity * sizeof(GuiTween));
+        }
+        index = animation->tweenCount++;
+        animation->tweens[index].type = type;
+        animation->tweens[index].container = container;
+        animation->tweens[index].slot = slot;
+        if (type == GUI_TWEEN_FADE) {
+            container->animation->fades[slot] = index;
+        }
+    }
+
+    GuiTween* tween = animation->tweens + index;
+
+    memcpy(tween->from, from, sizeof(tween->from));
+    memcpy(tween->to, to, sizeof(tween->to));
+    memcpy(tween->value, from, sizeof(tween->value));
+    tween->time = 0;
+    tween->duration = duration;
+}
+
+/**
+ * Take a tween out of the pool, moving the last tween into its place.
+ */
+void RemoveGuiTween(GuiAnimation* animation, int tween) {
+    GuiTween* removed = animation->tweens + tween;
+    if (removed->type == GUI_TWEEN_FADE) {
+        removed->container->animation->fades[removed->slot] = -1;
+    }
+
+    *removed = animation->tweens[--animation->tweenCount];
+    if (tween < animation->tweenCount && removed->type == GUI_TWEEN_FADE) {
+        removed->container->animation->fades[removed->slot] = tween;
+    }
+}
+
+/**
+ * Check whether a container is the given one, or nested in it.
+ */
+bool IsGuiContainerNestedIn(GuiContainer* container, GuiContainer* ancestor) {
+    for (; container != NULL; container = container->group != NULL ? container->group->parent : NULL) {
+        if (container == ancestor) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Stop the tweens of an element that's being removed, and those of the elements nested in it, and make its handle
+ * index opaque again for the next element to take it.
+ */
+void RemoveGuiElementTweens(GuiContainer* container, int element) {
+    int slot = container->ids[element];
+    if (container->animation != NULL && container->animation->alphas != NULL) {
+        container->animation->alphas[slot] = 1.0f;
+    }
+
+    GuiAnimation* animation = GetGuiRootContainer(container)->animation;
+    if (animation == NULL) {
+        return;
+    }
+    GuiContainer* nested = (container->flags[element] & GUI_ELEMENT_GROUP) ? GetGuiGroupContainer(container, element) : NULL;
+    for (int i = animation->tweenCount - 1; i >= 0; i--) {
+        GuiTween* tween = animation->tweens + i;
+        if ((tween->container == container && tween->slot == slot) || (nested != NULL && IsGuiContainerNestedIn(tween->container, nested))) {
+            RemoveGuiTween(animation, i);
+        }
+    }
+}
+
+/**
+ * Pulse the elements pressed or toggled in this update of a root container with animation enabled.
+ */
+void StartGuiPressPulses(GuiContainer* container) {
+    GuiAnimation* animation = container->animation;
+    if (animation == NULL || !animation->enabled) {
+        return;
+    }
+
+    GuiInput* input = container->input;
+    for (int i = 0; i < input->eventCount; i++) {
+        GuiEvent* event = input->events + i;
+        if (event->type == GUI_EVENT_PRESSED || event->type == GUI_EVENT_TOGGLED) {
+            float from[4] = { 0, 1, 0, 0 };
+            float to[4] = { RAYGUI_CONTAINER_PULSE_SIZE, 0, 0, 0 };
+            StartGuiTween(container, GUI_TWEEN_PULSE, event->container, event->element.index, from, to, RAYGUI_CONTAINER_PULSE_TIME);
+        }
+    }
+}
+
+/**
+ * Slide the focus highlight of a root container towards the focused element, once focus or the element moves.
+ */
+void UpdateGuiFocusHighlight(GuiContainer* container) {
+    GuiAnimation* animation = container->animation;
+    GuiContainer* focused = GetGuiFocusedContainer(container);
+    if (focused->activeElement < 0) {
+        animation->focusShown = false;
+        return;
+    }
+
+    // The highlight appears on the first element to take focus, and slides from there on.
+    Rectangle target = OffsetGuiRectangle(focused->bounds[focused->activeElement], GetGuiContainerOrigin(focused));
+    if (!animation->focusShown) {
+        animation->focusShown = true;
+        animation->focusBounds = target;
+        animation->focusTarget = target;
+        return;
+    }
+    if (target.x != animation->focusTarget.x || target.y != animation->focusTarget.y ||
+        target.width != animation->focusTarget.width || target.height != animation->focusTarget.height) {
+        Rectangle bounds = animation->focusBounds;
+        float from[4] = { bounds.x, bounds.y, bounds.width, bounds.height };
+        float to[4] = { target.x, target.y, target.width, target.height };
+        animation->focusTarget = target;
+        StartGuiTween(container, GUI_TWEEN_FOCUS, NULL, -1, from, to, RAYGUI_CONTAINER_FOCUS_TIME);
+    }
+}
+
+/**
+ * Advance every tween of a root container by the frame time, in a single pass over its pool, and apply what they
+ * animate. Finished tweens leave the pool, so the elements that stopped animating cost nothing.
+ */
+void AnimateGuiContainer(GuiContainer* container, float frameTime) {
+    GuiAnimation* animation = container->animation;
+    if (animation == NULL) {
+        return;
+    }
+    if (animation->enabled) {
+        UpdateGuiFocusHighlight(container);
+    }
+    if (animation->tweenCount == 0) {
+        return;
+    }
+
+    GUI_PROFILE_BEGIN(start);
+#if defined(RAYGUI_CONTAINER_PROFILE)
+    int advanced = animation->tweenCount;
+#endif
+    for (int i = 0; i < animation->tweenCount;) {
+        GuiTween* tween = animation->tweens + i;
+        tween->time += frameTime;
+        float progress = tween->time < tween->duration ? EaseGuiTween(tween->time / tween->duration) : 1.0f;
+        for (int value = 0; value < 4; value++) {
+            tween->value[value] = tween->from[value] + (tween->to[value] - tween->from[value]) * progress;
+        }
+
+        if (tween->type == GUI_TWEEN_FOCUS) {
+            animation->focusBounds = (Rectangle){ tween->value[0], tween->value[1], tween->value[2], tween->value[3] };
+        }
+        else if (tween->type == GUI_TWEEN_FADE) {
+            tween->container->animation->alphas[tween->slot] = tween->value[0];
+        }
+
+        if (progress >= 1.0f) {
+            RemoveGuiTween(animation, i);
+        }
+        else {
+            i++;
+        }
+    }
+    GUI_PROFILE_END(container, GUI_PHASE_ANIMATE, start, advanced);
+    GUI_PROFILE_COUNT(container, tweensAdvanced, advanced);
+}
+
+/**
+ * Draw the focus highlight and the press pulses. Pressing an element pulses it, whichever container it's in, and the
+ * focus highlight slides between the elements that take focus, rather than jumping.
+ */
+void EnableGuiContainerAnimation(GuiContainer* container) {
+    GetGuiAnimation(GetGuiRootContainer(container))->enabled = true;
+}
+
+/**
+ * Stop drawing the focus highlight and the press pulses. Elements that are fading carry on.
+ */
+void DisableGuiContainerAnimation(GuiContainer* container) {
+    GuiAnimation* animation = GetGuiRootContainer(container)->animation;
+    if (animation == NULL) {
+        return;
+    }
+
+    animation->enabled = false;
+    animation->focusShown = false;
+    for (int i = animation->tweenCount - 1; i >= 0; i--) {
+        if (animation->tweens[i].type != GUI_TWEEN_FADE) {
+            RemoveGuiTween(animation, i);
+        }
+    }
+}
+
+/**
+ * Check whether anything in the container is still animating, so a frame can't be skipped.
+ */
+bool IsGuiContainerAnimating(GuiContainer* container) {
+    GuiAnimation* animation = GetGuiRootContainer(container)->animation;
+    return animation != NULL && animation->tweenCount > 0;
+}
+
+/**
+ * Fade an element from its alpha to the given one over the given seconds, as the container is updated. The alpha
+ * multiplies the container's while the element is drawn, along with anything nested in it, and stays once the fade
+ * ends. A duration of 0 sets it straight away.
+ */
+void FadeGuiElement(GuiContainer* container, GuiElement element, float alpha, float duration) {
+    if (GetGuiElementIndex(container, element) < 0) {
+        return;
+    }
+
+    float* alphas = GetGuiFadedAnimation(container)->alphas;
+    float from[4] = { alphas[element.index], 0, 0, 0 };
+    float to[4] = { alpha < 0 ? 0 : alpha > 1 ? 1 : alpha, 0, 0, 0 };
+    if (duration <= 0) {
+        alphas[element.index] = to[0];
+    }
+    StartGuiTween(GetGuiRootContainer(container), GUI_TWEEN_FADE, container, element.index, from, to, duration);
+}
+
+float GetGuiElementAlpha(GuiContainer* container, GuiElement element) {
+    if (GetGuiElementIndex(container, element) < 0 || container->animation == NULL || container->animation->alphas == NULL) {
+        return 1.0f;
+    }
+    return container->animation->alphas[element.index];
+}
+
+/**
+ * Apply the queued actions to the container, in the order they were queued, and clear the queue.
+ */
+void ProcessGuiContainerActions(GuiContainer* container) {
+    GuiInput* input = container->input;
+    GuiInput* events = GetGuiRootContainer(container)->input;
+    events->eventCount = 0;
+
+    // There is nothing to focus on without any elements, and a locked container ignores its input.
+    if (container->activeElement < 0 || container->style->locked) {
+        input->actionCount = 0;
+        return;
+    }
+
+    // Buttons are only pressed for a single frame.
+    GuiContainer* focused = GetGuiFocusedContainer(container);
+    if (focused->types[focused->activeElement] == GUI_TYPE_BUTTON) {
+        focused->states[focused->activeElement].pressed = false;
+    }
+
+    for (int i = 0; i < input->actionCount; i++) {
+        int active = focused->activeElement;
+        ProcessGuiContainerAction(container, input->actions[i]);
+
+        // Element indices don't change while actions are processed, so the focused element is the same one if both the
+        // container and the index are.
+        GuiContainer* next = GetGuiFocusedContainer(container);
+        if (next != focused || next->activeElement != active) {
+            focused = next;
+            PushGuiEvent(focused, focused->activeElement, GUI_EVENT_FOCUS_CHANGED, 0, 0);
+        }
+    }
+    input->actionCount = 0;
+    StartGuiPressPulses(GetGuiRootContainer(container));
+
+    // Callbacks run once every action is processed, so they're free to change the container.
+    for (int i = 0; i < events->eventCount; i++) {
+        if (events->callbacks[i] != NULL) {
+            events->callbacks[i](events->events + i);
+        }
+    }
+}
+
+/**
+ * A layout, or an element placed by one. The children of a layout are kept in a doubly linked list.
+ */
+typedef struct GuiLayoutNode {
+    int type;                   // The GuiLayoutType of a layout
+    int element;                // The handle index of an element, or -1 for a layout
+    int parent;
+    int firstChild;
+    int lastChild;
+    int previous;
+    int next;                   // The next sibling, or the next free node
+    GuiLayoutSize size;
+    float padding;
+    float spacing;
+    int columns;
+    float length;               // The size given to the node in its parent's direction
+    Rectangle bounds;           // The area the node was last placed in
+    bool dirty;                 // Whether the layout's children have to be placed again
+} GuiLayoutNode;
+
+/**
+ * The layouts of a container.
+ *
+ * Changing a node marks the layout it's in as dirty, and adds the layout to a list. A layout pass places the root
+ * layout if its bounds changed, then each dirty layout that isn't inside another dirty one, so it only visits the
+ * dirty layouts and the nodes whose bounds change as a result. Changing one element doesn't lay out the whole tree.
+ */
+typedef struct GuiLayoutTree {
+    GuiLayoutNode* nodes;
+    int nodeCount;
+    int nodeCapacity;
+    int freeNode;               // The first free node, or -1
+    int root;                   // The root layout, or -1 before SetGuiContainerLayout()
+    Rectangle bounds;           // The area the root layout fills
+    int* elementNodes;          // For each handle index, the node placing the element, or -1
+    int fitCount;               // The number of nodes that fit their element's text
+    float textSize;             // The text size and spacing the text was fitted with
+    float textSpacing;
+    bool nestedDirty;           // Whether a container nested in this one has a layout pass to run
+    int* dirty;                 // The dirty layouts
+    int dirtyCount;
+    int dirtyCapacity;
+    int* moved;                 // The handle indices of the elements the current pass moved
+    int movedCount;
+    int movedCapacity;
+    int visited;                // The number of nodes visited by the last layout pass
+} GuiLayoutTree;
+
+/**
+ * Get the layouts of a container, creating them the first time.
+ */
+GuiLayoutTree* GetGuiLayoutTree(GuiContainer* container) {
+    if (container->layout == NULL) {
+        GuiLayoutTree* tree = (GuiLayoutTree*)MemAlloc(sizeof(GuiLayoutTree));
+        memset(tree, 0, sizeof(GuiLayoutTree));
+        tree->freeNode = -1;
+        tree->root = -1;
+        tree->elementNodes = (int*)MemAlloc(container->capacity * sizeof(int));
+        memset(tree->elementNodes, -1, container->capacity * sizeof(int));
+        container->layout = tree;
+    }
+    return container->layout;
+}
+
+void ResizeGuiLayoutTree(GuiContainer* container) {
+    container->layout->elementNodes = (int*)MemRealloc(container->layout->elementNodes, container->capacity * sizeof(int));
+}
+
+void UnloadGuiLayoutTree(GuiLayoutTree* tree) {
+    MemFree(tree->nodes);
+    MemFree(tree->elementNodes);
+    MemFree(tree->dirty);
+    MemFree(tree->moved);
+    MemFree(tree);
+}
+
+bool IsGuiLayoutValid(GuiContainer* container, GuiLayout layout) {
+    GuiLayoutTree* tree = container->layout;
+    return tree != NULL && layout.index >= 0 && layout.index < tree->nodeCount && tree->nodes[layout.index].element < 0;
+}
+
+/**
+ * Let the containers a container is nested in know it has a layout pass to run.
+ */
+void MarkGuiNestedLayoutDirty(GuiContainer* container) {
+    for (; container->group != NULL; container = container->group->parent) {
+        GuiLayoutTree* tree = GetGuiLayoutTree(container->group->parent);
+        if (tree->nestedDirty) {
+            break;
+        }
+        tree->nestedDirty = true;
+    }
+}
+
+/**
+ * Mark a layout's children to be placed again.
+ */
+void MarkGuiLayoutDirty(GuiContainer* container, int node) {
+    GuiLayoutTree* tree = container->layout;
+    if (!tree->nodes[node].dirty) {
+        if (tree->dirtyCount == tree->dirtyCapacity) {
+            tree->dirtyCapacity = tree->dirtyCapacity == 0 ? 16 : tree->dirtyCapacity * 2;
+            tree->dirty = (int*)MemRealloc(tree->dirty, tree->dirtyCapacity * sizeof(int));
+        }
+        tree->dirty[tree->dirtyCount++] = node;
+        tree->nodes[node].dirty = true;
+    }
+    MarkGuiNestedLayoutDirty(container);
+}
+
+/**
+ * Add a node as the last child of parent, or as the root if parent is -1.
+ */
+int AddGuiLayoutNode(GuiContainer* container, int parent, int element, GuiLayoutSize size) {
+    GuiLayoutTree* tree = GetGuiLayoutTree(container);
+    int index = tree->freeNode;
+    if (index >= 0) {
+        tree->freeNode = tree->nodes[index].next;
+    }
+    else {
+        if (tree->nodeCount == tree->nodeCapacity) {
+            tree->nodeCapacity = tree->nodeCapacity == 0 ? 16 : tree->nodeCapacity * 2;
+            tree->nodes = (GuiLayoutNode*)MemRealloc(tree->nodes, tree->nodeCapacity * sizeof(GuiLayoutNode));
+        }
+        index = tree->nodeCount++;
+    }
+
+    GuiLayoutNode* node = tree->nodes + index;
+    memset(node, 0, sizeof(GuiLayoutNode));
+    node->element = element;
+    node->parent = parent;
+    node->firstChild = -1;
+    node->lastChild = -1;
+    node->previous = parent >= 0 ? tree->nodes[parent].lastChild : -1;
+    node->next = -1;
+    node->size = size;
+    node->columns = 1;
+    node->bounds = (Rectangle){ 0, 0, -1, -1 };     // Never equal to the first bounds it's placed in
+    if (parent >= 0) {
+        if (node->previous >= 0) {
+            tree->nodes[node->previous].next = index;
+        }
+        else {
+            tree->nodes[parent].firstChild = index;
+        }
+        tree->nodes[parent].lastChild = index;
+    }
+    if (element >= 0) {
+        tree->elementNodes[element] = index;
+    }
+    if (size.fitText) {
+        tree->fitCount++;
+    }
+
+    MarkGuiLayoutDirty(container, parent >= 0 ? parent : index);
+    return index;
+}
+
+/**
+ * Unlink an element's node from its layout, and free it. The layout places its other children again.
+ */
+void RemoveGuiLayoutElement(GuiContainer* container, int element) {
+    GuiLayoutTree* tree = container->layout;
+    int index = tree->elementNodes[element];
+    if (index < 0) {
+        return;
+    }
+
+    GuiLayoutNode* node = tree->nodes + index;
+    GuiLayoutNode* parent = tree->nodes + node->parent;
+    if (node->previous >= 0) {
+        tree->nodes[node->previous].next = node->next;
+    }
+    else {
+        parent->firstChild = node->next;
+    }
+    if (node->next >= 0) {
+        tree->nodes[node->next].previous = node->previous;
+    }
+    else {
+        parent->lastChild = node->previous;
+    }
+    if (node->size.fitText) {
+        tree->fitCount--;
+    }
+    MarkGuiLayoutDirty(container, node->parent);
+
+    tree->elementNodes[element] = -1;
+    node->parent = -2;          // Free nodes are skipped when text is fitted again
+    node->next = tree->freeNode;
+    tree->freeNode = index;
+}
+
+/**
+ * Get the size of an element's text, plus its control's borders and padding: its width in a horizontal layout, or the
+ * text size in any other.
+ */
+float GetGuiLayoutTextSize(GuiContainer* container, GuiLayoutNode* node, bool horizontal) {
+    GuiLayoutTree* tree = container->layout;
+    int element = container->slots[node->element];
+    int control = GetGuiElementClass(container->types[element])->control;
+    float margin = 2.0f * (GetGuiContainerStyle(container, control, BORDER_WIDTH) + GetGuiContainerStyle(container, control, TEXT_PADDING));
+    if (!horizontal) {
+        return tree->textSize + margin;
+    }
+
+    const char* text = container->states[element].text;
+    if (text == NULL) {
+        return 0.0f;
+    }
+    return MeasureTextEx(GuiGetFont(), text, tree->textSize, tree->textSpacing).x + margin;
+}
+
+float GetGuiLayoutMinSize(GuiContainer* container, GuiLayoutNode* node, bool horizontal) {
+    float min = node->size.min;
+    if (node->size.fitText && node->element >= 0) {
+        float text = GetGuiLayoutTextSize(container, node, horizontal);
+        min = text > min ? text : min;
+    }
+    return node->size.max > 0 && min > node->size.max ? node->size.max : min;
+}
+
+void PlaceGuiLayoutNode(GuiContainer* container, int index, Rectangle bounds);
+
+/**
+ * Place the children of a vertical or horizontal layout: each at its min size, then sharing the space that's left by
+ * weight. Children that reach their max size drop out, and the rest share what they didn't take.
+ */
+void ArrangeGuiLayoutStack(GuiContainer* container, GuiLayoutNode* node, Rectangle inner) {
+    GuiLayoutTree* tree = container->layout;
+    bool horizontal = node->type == GUI_LAYOUT_HORIZONTAL;
+    float available = horizontal ? inner.width : inner.height;
+    for (int child = node->firstChild; child >= 0; child = tree->nodes[child].next) {
+        GuiLayoutNode* current = tree->nodes + child;
+        current->length = GetGuiLayoutMinSize(container, current, horizontal);
+        available -= current->length + (child != node->firstChild ? node->spacing : 0);
+    }
+
+    while (available > 0.01f) {
+        float weights = 0;
+        for (int child = node->firstChild; child >= 0; child = tree->nodes[child].next) {
+            GuiLayoutNode* current = tree->nodes + child;
+            if (current->size.weight > 0 && (current->size.max <= 0 || current->length < current->size.max)) {
+                weights += current->size.weight;
+            }
+        }
+        if (weights <= 0) {
+            break;
+        }
+
+        float shared = available;
+        bool capped = false;
+        for (int child = node->firstChild; child >= 0; child = tree->nodes[child].next) {
+            GuiLayoutNode* current = tree->nodes + child;
+            if (current->size.weight > 0 && (current->size.max <= 0 || current->length < current->size.max)) {
+                float share = shared * current->size.weight / weights;
+                if (current->size.max > 0 && current->length + share >= current->size.max) {
+                    share = current->size.max - current->length;
+                    capped = true;
+                }
+                current->length += share;
+                available -= share;
+            }
+        }
+        if (!capped) {
+            break;
+        }
+    }
+
+    float position = horizontal ? inner.x : inner.y;
+    for (int child = node->firstChild; child >= 0; child = tree->nodes[child].next) {
+        float length = tree->nodes[child].length;
+        PlaceGuiLayoutNode(container, child, horizontal ?
+            (Rectangle){ position, inner.y, length, inner.height } : (Rectangle){ inner.x, position, inner.width, length });
+        position += length + node->spacing;
+    }
+}
+
+/**
+ * Place the children of a grid layout, row by row. Each row is as tall as the largest min size in it, or as tall as
+ * the columns are wide if none of them has one.
+ */
+void ArrangeGuiLayoutGrid(GuiContainer* container, GuiLayoutNode* node, Rectangle inner) {
+    GuiLayoutTree* tree = container->layout;
+    int columns = node->columns > 0 ? node->columns : 1;
+    float width = (inner.width - node->spacing * (columns - 1)) / columns;
+    float y = inner.y;
+    int child = node->firstChild;
+    while (child >= 0) {
+        float height = 0;
+        int next = child;
+        for (int column = 0; column < columns && next >= 0; column++, next = tree->nodes[next].next) {
+            GuiLayoutNode* current = tree->nodes + next;
+            current->length = GetGuiLayoutMinSize(container, current, false);
+            height = current->length > height ? current->length : height;
+        }
+        if (height <= 0) {
+            height = width;
+        }
+
+        for (int column = 0; column < columns && child >= 0; column++, child = tree->nodes[child].next) {
+            PlaceGuiLayoutNode(container, child, (Rectangle){ inner.x + column * (width + node->spacing), y, width, height });
+        }
+        y += height + node->spacing;
+    }
+}
+
+/**
+ * Move the elements the layout pass placed somewhere new.
+ *
+ * Moving a few elements updates the navigation entries around each of them. When many elements move, as when the
+ * window is resized, that would cost more than finding their neighbours again, so the navigation graph is cleared.
+ * A group's nested layout is resized to fill the group's view.
+ */
+void MoveGuiLayoutElements(GuiContainer* container) {
+    GuiLayoutTree* tree = container->layout;
+    bool many = tree->movedCount * 8 > container->count;
+    for (int i = 0; i < tree->movedCount; i++) {
+        int slot = tree->moved[i];
+        int element = container->slots[slot];
+        Rectangle bounds = tree->nodes[tree->elementNodes[slot]].bounds;
+        if (many) {
+            RemoveGuiSpatialIndexElement(container->spatialIndex, slot);
+            container->bounds[element] = bounds;
+            AddGuiSpatialIndexElement(container->spatialIndex, slot, bounds);
+        }
+        else {
+            SetGuiElementBounds(container, (GuiElement){ slot, container->generations[slot] }, bounds);
+        }
+
+        if (container->flags[element] & GUI_ELEMENT_GROUP) {
+            GuiContainer* nested = container->states[element].container;
+            GuiGroup* group = nested->group;
+            group->view = GetGuiGroupView(group, bounds, container->states[element].text);
+            if (nested->layout != NULL && nested->layout->root >= 0) {
+                Rectangle area = group->type == GUI_GROUP_SCROLL_PANEL ? group->content : group->view;
+                nested->layout->bounds = (Rectangle){ 0, 0, area.width, area.height };
+                tree->nestedDirty = true;
+            }
+        }
+    }
+
+    if (many) {
+        GuiNavigationGraph* graph = container->navigation;
+        memset(graph->cached, 0, container->slotCount * sizeof(unsigned char));
+        memset(graph->openIndex, -1, container->slotCount * sizeof(int));
+        graph->openCount = 0;
+        graph->maxDistance = 0;
+    }
+    tree->movedCount = 0;
+}
+
+/**
+ * Place a node in the given bounds. Its children are placed again if it moved or is dirty. Otherwise, nothing below it
+ * changed, and it's skipped.
+ */
+void PlaceGuiLayoutNode(GuiContainer* container, int index, Rectangle bounds) {
+    GuiLayoutTree* tree = container->layout;
+    GuiLayoutNode* node = tree->nodes + index;
+    bool moved = node->bounds.x != bounds.x || node->bounds.y != bounds.y ||
+        node->bounds.width != bounds.width || node->bounds.height != bounds.height;
+    if (!moved && !node->dirty) {
+        return;
+    }
+
+    tree->visited++;
+    node->bounds = bounds;
+    node->dirty = false;
+    if (node->element >= 0) {
+        if (tree->movedCount == tree->movedCapacity) {
+            tree->movedCapacity = tree->movedCapacity == 0 ? 64 : tree->movedCapacity * 2;
+            tree->moved = (int*)MemRealloc(tree->moved, tree->movedCapacity * sizeof(int));
+        }
+        tree->moved[tree->movedCount++] = node->element;
+        return;
+    }
+
+    Rectangle inner = { bounds.x + node->padding, bounds.y + node->padding, bounds.width - 2 * node->padding, bounds.height - 2 * node->padding };
+    if (node->type == GUI_LAYOUT_GRID) {
+        ArrangeGuiLayoutGrid(container, node, inner);
+    }
+    else {
+        ArrangeGuiLayoutStack(container, node, inner);
+    }
+}
+
+/**
+ * Check whether a layout is inside a dirty layout, which places it along with its own children.
+ */
+bool IsGuiLayoutInDirtyLayout(GuiLayoutTree* tree, int node) {
+    for (int parent = tree->nodes[node].parent; parent >= 0; parent = tree->nodes[parent].parent) {
+        if (tree->nodes[parent].dirty) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Run a layout pass over the container, and the containers nested in it, moving the elements whose layouts changed.
+ *
+ * UpdateGuiContainer() calls this before handling input. Only the parts of the layout that changed are visited.
+ */
+void ApplyGuiContainerLayout(GuiContainer* container) {
+    GuiLayoutTree* tree = container->layout;
+    if (tree == NULL) {
+        return;
+    }
+
+    tree->visited = 0;
+    if (tree->root >= 0) {
+        // Text is fitted at the size it's drawn with, so changing the text size lays the text out again.
+        if (tree->fitCount > 0) {
+            float textSize = (float)GetGuiContainerStyle(container, DEFAULT, TEXT_SIZE);
+            float textSpacing = (float)GetGuiContainerStyle(container, DEFAULT, TEXT_SPACING);
+            if (textSize != tree->textSize || textSpacing != tree->textSpacing) {
+                tree->textSize = textSize;
+                tree->textSpacing = textSpacing;
+                for (int i = 0; i < tree->nodeCount; i++) {
+                    if (tree->nodes[i].parent >= 0 && tree->nodes[i].size.fitText) {
+                        MarkGuiLayoutDirty(container, tree->nodes[i].parent);
+                    }
+                }
+            }
+        }
+        PlaceGuiLayoutNode(container, tree->root, tree->bounds);
+        for (int i = 0; i < tree->dirtyCount; i++) {
+            int node = tree->dirty[i];
+            if (tree->nodes[node].dirty && !IsGuiLayoutInDirtyLayout(tree, node)) {
+                PlaceGuiLayoutNode(container, node, tree->nodes[node].bounds);
+            }
+        }
+        tree->dirtyCount = 0;
+        MoveGuiLayoutElements(container);
+    }
+
+    if (tree->nestedDirty) {
+        tree->nestedDirty = false;
+        for (int i = 0; i < container->count; i++) {
+            if (container->flags[i] & GUI_ELEMENT_GROUP) {
+                ApplyGuiContainerLayout(container->states[i].container);
+            }
+        }
+    }
+}
+
+/**
+ * Replace the container's layouts with a single layout filling the given bounds, which elements and other layouts can
+ * be added to. Elements keep their bounds until they're added to a layout.
+ */
+GuiLayout SetGuiContainerLayout(GuiContainer* container, GuiLayoutType type, Rectangle bounds) {
+    ClearGuiContainerLayout(container);
+    GuiLayoutTree* tree = GetGuiLayoutTree(container);
+    tree->root = AddGuiLayoutNode(container, -1, -1, (GuiLayoutSize){ 0 });
+    tree->nodes[tree->root].type = type;
+    tree->bounds = bounds;
+    return (GuiLayout){ tree->root };
+}
+
+/**
+ * Resize the container's layout, such as when the window is resized. Only the layouts whose bounds change as a result
+ * are visited by the next layout pass.
+ */
+void SetGuiContainerLayoutBounds(GuiContainer* container, Rectangle bounds) {
+    GuiLayoutTree* tree = GetGuiLayoutTree(container);
+    tree->bounds = bounds;
+    MarkGuiNestedLayoutDirty(container);
+}
+
+GuiLayout AddGuiLayout(GuiContainer* container, GuiLayout parent, GuiLayoutType type, GuiLayoutSize size) {
+    if (!IsGuiLayoutValid(container, parent)) {
+        return (GuiLayout){ -1 };
+    }
+
+    size.fitText = false;
+    int index = AddGuiLayoutNode(container, parent.index, -1, size);
+    container->layout->nodes[index].type = type;
+    return (GuiLayout){ index };
+}
+
+/**
+ * Let a layout place an element, moving it from the layout it was in, if any.
+ */
+void AddGuiLayoutElement(GuiContainer* container, GuiLayout parent, GuiElement element, GuiLayoutSize size) {
+    if (!IsGuiLayoutValid(container, parent) || GetGuiElementIndex(container, element) < 0) {
+        return;
+    }
+
+    RemoveGuiLayoutElement(container, element.index);
+    AddGuiLayoutNode(container, parent.index, element.index, size);
+}
+
+/**
+ * Change the size of a layout node, marking its parent to be placed again.
+ */
+void SetGuiLayoutNodeSize(GuiContainer* container, int index, GuiLayoutSize size) {
+    GuiLayoutTree* tree = container->layout;
+    GuiLayoutNode* node = tree->nodes + index;
+    tree->fitCount += (int)size.fitText - (int)node->size.fitText;
+    node->size = size;
+    MarkGuiLayoutDirty(container, node->parent >= 0 ? node->parent : index);
+}
+
+void SetGuiLayoutSize(GuiContainer* container, GuiLayout layout, GuiLayoutSize size) {
+    if (IsGuiLayoutValid(container, layout)) {
+        size.fitText = false;
+        SetGuiLayoutNodeSize(container, layout.index, size);
+    }
+}
+
+void SetGuiElementLayoutSize(GuiContainer* container, GuiElement element, GuiLayoutSize size) {
+    if (container->layout != NULL && GetGuiElementIndex(container, element) >= 0 && container->layout->elementNodes[element.index] >= 0) {
+        SetGuiLayoutNodeSize(container, container->layout->elementNodes[element.index], size);
+    }
+}
+
+/**
+ * Set the space between a layout's bounds and its children, and between one child and the next.
+ */
+void SetGuiLayoutSpacing(GuiContainer* container, GuiLayout layout, float padding, float spacing) {
+    if (IsGuiLayoutValid(container, layout)) {
+        container->layout->nodes[layout.index].padding = padding;
+        container->layout->nodes[layout.index].spacing = spacing;
+        MarkGuiLayoutDirty(container, layout.index);
+    }
+}
+
+void SetGuiLayoutColumns(GuiContainer* container, GuiLayout layout, int columns) {
+    if (IsGuiLayoutValid(container, layout)) {
+        container->layout->nodes[layout.index].columns = columns;
+        MarkGuiLayoutDirty(container, layout.index);
+    }
+}
+
+/**
+ * Remove every layout from the container. The elements stay where they were last placed.
+ */
+void ClearGuiContainerLayout(GuiContainer* container) {
+    GuiLayoutTree* tree = container->layout;
+    if (tree == NULL) {
+        return;
+    }
+
+    tree->nodeCount = 0;
+    tree->freeNode = -1;
+    tree->root = -1;
+    tree->fitCount = 0;
+    tree->dirtyCount = 0;
+    memset(tree->elementNodes, -1, container->capacity * sizeof(int));
+}
+
+/**
+ * Run a layout pass, poll the input devices, and apply the actions they map to.
+ */
+void UpdateGuiContainer(GuiContainer* container) {
+    GUI_PROFILE_BEGIN(start);
+    ApplyGuiContainerLayout(container);
+    GUI_PROFILE_END(container, GUI_PHASE_LAYOUT, start, container->layout != NULL ? container->layout->visited : 0);
+    GUI_PROFILE_COUNT(container, layoutNodes, container->layout != NULL ? container->layout->visited : 0);
+
+    GUI_PROFILE_BEGIN(inputStart);
+    PollGuiContainerInput(container);
+    GUI_PROFILE_END(container, GUI_PHASE_INPUT, inputStart, container->input->actionCount);
+
+    // Processing the actions clears them.
+#if defined(RAYGUI_CONTAINER_PROFILE)
+    int actionCount = container->input->actionCount;
+#endif
+    GUI_PROFILE_BEGIN(actionsStart);
+    ProcessGuiContainerActions(container);
+    GUI_PROFILE_END(container, GUI_PHASE_ACTIONS, actionsStart, actionCount);
+    GUI_PROFILE_COUNT(container, actions, actionCount);
+
+    // Tweens advance by the frame time that was polled, so a replay animates the same.
+    AnimateGuiContainer(container, container->input->frame.frameTime);
+
+    GUI_PROFILE_COUNT(container, updates, 1);
+    GUI_PROFILE_END(container, GUI_PHASE_UPDATE, start, 0);
+}
+
+/**
+ * Free a nested container, along with the containers nested in it.
+ */
+void UnloadGuiGroupContainer(GuiContainer* container) {
+    MemFree(container->group);
+    UnloadGuiContainer(*container);
+    MemFree(container);
+}
+
+void UnloadGuiGroupElement(GuiContainer* container, int element) {
+    UnloadGuiGroupContainer(container->states[element].container);
+}
+
+void UnloadGuiListViewElement(GuiContainer* container, int element) {
+    UnloadGuiList(container->states[element].list);
+}
+
+void UnloadGuiTextBoxElement(GuiContainer* container, int element) {
+    MemFree(container->states[element].textBox.buffer);
+}
+
+void UnloadGuiChoiceElement(GuiContainer* container, int element) {
+    UnloadGuiChoiceItems(&container->states[element].choice);
+}
+
+/**
+ * Free what an element owns: a group's nested container, a list view's state, a text box's buffer, or the split items
+ * of a choice.
+ */
+void UnloadGuiElementState(GuiContainer* container, int element) {
+    const GuiElementClass* elementClass = GetGuiElementClass(container->types[element]);
+    if (elementClass->unload != NULL) {
+        elementClass->unload(container, element);
+    }
+}
+
+void UnloadGuiContainer(GuiContainer container) {
+    for (int i = 0; i < container.count; i++) {
+        UnloadGuiElementState(&container, i);
+    }
+
+    StopGuiInputRecording(&container);
+    MemFree(container.input);
+    MemFree(container.style);
+    MemFree(container.profile);
+    UnloadGuiStringArena(container.strings);
+    if (container.layout != NULL) {
+        UnloadGuiLayoutTree(container.layout);
+    }
+    if (container.handlers != NULL) {
+        UnloadGuiElementHandlers(container.handlers);
+    }
+    if (container.animation != NULL) {
+        UnloadGuiAnimation(container.animation);
+    }
+#if defined(RAYGUI_CONTAINER_RETAINED)
+    if (container.drawCache != NULL) {
+        UnloadGuiDrawCache(container.drawCache);
+    }
+#endif
+
+    // A loaded container's arrays go along with its file.
+    if (container.file != NULL && container.file->shared) {
+        MemFree(container.spatialIndex->results);
+        MemFree(container.spatialIndex);
+        MemFree(container.navigation);
+    }
+    else {
+        UnloadGuiSpatialIndex(container.spatialIndex);
+        UnloadGuiNavigationGraph(container.navigation);
+        MemFree(container.bounds);
+        MemFree(container.flags);
+        MemFree(container.types);
+        MemFree(container.states);
+        MemFree(container.ids);
+        MemFree(container.slots);
+        MemFree(container.generations);
+    }
+    if (container.file != NULL) {
+        UnloadGuiContainerFile(container.file);
+    }
+}
+
+// The class of each GuiElementType. A group's nested container draws itself, so it has no draw hook.
+static const GuiElementClass guiElementClasses[GUI_TYPE_COUNT] = {
+    [GUI_TYPE_GROUP] = {
+        .control = DEFAULT, .flags = GUI_CLASS_SELECTABLE,
+        .unload = UnloadGuiGroupElement
+    },
+    [GUI_TYPE_BUTTON] = {
+        .control = BUTTON, .flags = GUI_CLASS_SELECTABLE, .letter = 'b',
+        .draw = DrawGuiButtonElement, .activate = ActivateGuiButtonElement
+    },
+    [GUI_TYPE_CHECKBOX] = {
+        .control = CHECKBOX, .flags = GUI_CLASS_SELECTABLE, .letter = 'c',
+        .draw = DrawGuiCheckBoxElement, .activate = ActivateGuiCheckBoxElement
+    },
+    [GUI_TYPE_TOGGLE] = {
+        .control = TOGGLE, .flags = GUI_CLASS_SELECTABLE, .letter = 't',
+        .draw = DrawGuiToggleElement, .activate = ActivateGuiCheckBoxElement
+    },
+    [GUI_TYPE_TOGGLEGROUP] = {
+        .control = TOGGLE, .flags = GUI_CLASS_SELECTABLE | GUI_CLASS_CHOICE, .letter = 'g',
+        .draw = DrawGuiToggleGroupElement, .activate = ActivateGuiLockingElement, .adjust = AdjustGuiChoiceElement,
+        .navigate = NavigateGuiAdjustableElement, .click = ClickGuiToggleGroupElement, .unload = UnloadGuiChoiceElement
+    },
+    [GUI_TYPE_SLIDER] = {
+        .control = SLIDER, .flags = GUI_CLASS_SELECTABLE | GUI_CLASS_ADJUSTABLE | GUI_CLASS_VALUE, .letter = 's',
+        .draw = DrawGuiSliderElement, .activate = ActivateGuiLockingElement, .adjust = AdjustGuiValueElement,
+        .navigate = NavigateGuiAdjustableElement
+    },
+    [GUI_TYPE_SLIDERBAR] = {
+        .control = SLIDER, .flags = GUI_CLASS_SELECTABLE | GUI_CLASS_ADJUSTABLE | GUI_CLASS_VALUE, .letter = 'r',
+        .draw = DrawGuiSliderBarElement, .activate = ActivateGuiLockingElement, .adjust = AdjustGuiValueElement,
+        .navigate = NavigateGuiAdjustableElement
+    },
+    [GUI_TYPE_PROGRESSBAR] = {
+        .control = PROGRESSBAR, .flags = GUI_CLASS_VALUE, .letter = 'p',
+        .draw = DrawGuiProgressBarElement
+    },
+    [GUI_TYPE_SPINNER] = {
+        .control = SPINNER, .flags = GUI_CLASS_SELECTABLE | GUI_CLASS_ADJUSTABLE | GUI_CLASS_VALUE, .letter = 'n',
+        .draw = DrawGuiSpinnerElement, .activate = ActivateGuiLockingElement, .adjust = AdjustGuiValueElement,
+        .navigate = NavigateGuiAdjustableElement, .click = ClickGuiSpinnerElement
+    },
+    [GUI_TYPE_VALUEBOX] = {
+        .control = VALUEBOX, .flags = GUI_CLASS_SELECTABLE | GUI_CLASS_ADJUSTABLE | GUI_CLASS_VALUE, .letter = 'v',
+        .draw = DrawGuiSpinnerElement, .activate = ActivateGuiLockingElement, .adjust = AdjustGuiValueElement,
+        .navigate = NavigateGuiAdjustableElement
+    },
+    [GUI_TYPE_COMBOBOX] = {
+        .control = COMBOBOX, .flags = GUI_CLASS_SELECTABLE | GUI_CLASS_CHOICE, .letter = 'o',
+        .draw = DrawGuiComboBoxElement, .activate = ActivateGuiComboBoxElement, .adjust = AdjustGuiChoiceElement,
+        .unload = UnloadGuiChoiceElement
+    },
+    [GUI_TYPE_DROPDOWNBOX] = {
+        .control = DROPDOWNBOX, .flags = GUI_CLASS_SELECTABLE | GUI_CLASS_CHOICE, .letter = 'd',
+        .draw = DrawGuiDropdownBoxElement, .activate = ActivateGuiLockingElement, .adjust = AdjustGuiChoiceElement,
+        .navigate = NavigateGuiDropdownBoxElement, .click = ClickGuiDropdownBoxElement, .unload = UnloadGuiChoiceElement
+    },
+    [GUI_TYPE_TEXTBOX] = {
+        .control = TEXTBOX, .flags = GUI_CLASS_SELECTABLE | GUI_CLASS_TEXT_INPUT,
+        .draw = DrawGuiTextBoxElement, .activate = ActivateGuiLockingElement, .unload = UnloadGuiTextBoxElement
+    },
+    [GUI_TYPE_COLORPICKER] = {
+        .control = COLORPICKER, .flags = GUI_CLASS_SELECTABLE | GUI_CLASS_ADJUSTABLE, .letter = 'k',
+        .draw = DrawGuiColorPickerElement, .activate = ActivateGuiLockingElement, .adjust = AdjustGuiColorPickerElement,
+        .navigate = NavigateGuiAdjustableElement, .click = ClickGuiColorPickerElement
+    },
+    [GUI_TYPE_LISTVIEW] = {
+        .control = LISTVIEW, .flags = GUI_CLASS_SELECTABLE | GUI_CLASS_LIVE,
+        .draw = DrawGuiListViewElement, .activate = ActivateGuiListViewElement, .adjust = AdjustGuiListViewElement,
+        .navigate = NavigateGuiListViewElement, .scroll = ScrollGuiListViewElement, .drag = DragGuiListViewElement,
+        .unload = UnloadGuiListViewElement
+    }
+};
+
+const GuiElementClass* GetGuiElementClass(int type) {
+    return guiElementClasses + type;
+}
+
+/**
+ * Count the items of a toggle group, combo box or dropdown box, which are separated by ';' or a new line.
+ */
+int GetGuiChoiceCount(const char* text) {
+    if (text == NULL) {
+        return 0;
+    }
+
+    int count = 1;
+    for (const char* c = text; *c != '\0'; c++) {
+        if (*c == ';' || *c == '\n') {
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * Keep the chosen item of a toggle group, combo box or dropdown box in its items.
+ */
+void ClampGuiChoiceState(GuiChoiceState* state) {
+    if (state->active >= state->count) {
+        state->active = state->count - 1;
+    }
+    if (state->active < 0) {
+        state->active = 0;
+    }
+}
+
+GuiElement AddElement(GuiContainer* container, int type, Rectangle bounds, GuiElementState state) {
+    if (container->count == container->capacity) {
+        GrowGuiContainer(container);
+    }
+
+    // Reuse a free handle index, or take a new one.
+    int slot = container->freeSlot;
+    if (slot >= 0) {
+        container->freeSlot = container->slots[slot];
+    }
+    else {
+        slot = container->slotCount++;
+        container->generations[slot] = 1;
+    }
+
+    // Append the element to the end of the live elements.
+    int index = container->count++;
+    container->bounds[index] = bounds;
+    container->flags[index] = (GetGuiElementClass(type)->flags & GUI_CLASS_SELECTABLE) ? GUI_ELEMENT_SELECTABLE : 0;
+    if (type == GUI_TYPE_GROUP) {
+        container->flags[index] |= GUI_ELEMENT_GROUP;
+    }
+    container->types[index] = (unsigned char)type;
+    container->states[index] = state;
+    container->states[index].text = InternGuiString(container->strings, state.text);
+    const char** textRight = GetGuiElementTextRight(container, index);
+    if (textRight != NULL) {
+        *textRight = InternGuiString(container->strings, *textRight);
+    }
+    container->ids[index] = slot;
+    container->slots[slot] = index;
+    AddGuiSpatialIndexElement(container->spatialIndex, slot, bounds);
+#if defined(RAYGUI_CONTAINER_RETAINED)
+    if (container->drawCache != NULL) {
+        container->drawCache->entries[slot].recorded = false;
+    }
+#endif
+
+    // Update the navigation entries the new element could be the neighbour of.
+    container->navigation->cached[slot] = 0;
+    container->navigation->openIndex[slot] = -1;
+    if (container->layout != NULL) {
+        container->layout->elementNodes[slot] = -1;
+    }
+    if (container->handlers != NULL) {
+        container->handlers->callbacks[slot] = NULL;
+        container->handlers->userData[slot] = NULL;
+    }
+    InvalidateGuiNavigationAround(container, bounds, index, -1);
+    InvalidateGuiNavigationTabOrder(container, index);
+
+    // Give focus to the first element, unless focus is in another container.
+    if (container->activeElement < 0 && IsGuiContainerFocused(container)) {
+        container->activeElement = index;
+    }
+
+    return (GuiElement){slot, container->generations[slot]};
+}
+
+/**
+ * Remove an element from the container.
+ *
+ * The last element is moved into its place, so removing an element is O(1), but changes the tab order.
+ */
+void RemoveGuiElement(GuiContainer* container, GuiElement element) {
+    int index = GetGuiElementIndex(container, element);
+    if (index < 0) {
+        return;
+    }
+
+    // Clear the navigation entries that pointed at the element, and the tab order around it and the last element.
+    int last = container->count - 1;
+    ClearGuiNavigationEntry(container->navigation, element.index);
+    InvalidateGuiNavigationAround(container, container->bounds[index], -1, element.index);
+    InvalidateGuiNavigationTabOrder(container, index);
+    InvalidateGuiNavigationTabOrder(container, last);
+    RemoveGuiSpatialIndexElement(container->spatialIndex, element.index);
+
+    // What the element owns goes along with it, and so do its tweens and its references to its text.
+    RemoveGuiElementTweens(container, index);
+    UnloadGuiElementState(container, index);
+    ReleaseGuiString(container->strings, container->states[index].text);
+    const char** textRight = GetGuiElementTextRight(container, index);
+    if (textRight != NULL) {
+        ReleaseGuiString(container->strings, *textRight);
+    }
+    if (container->layout != NULL) {
+        RemoveGuiLayoutElement(container, element.index);
+    }
+
+    // Move the last element into the removed element's place.
+    container->count--;
+    if (index != last) {
+        container->bounds[index] = container->bounds[last];
+        container->flags[index] = container->flags[last];
+        container->types[index] = container->types[last];
+        container->states[index] = container->states[last];
+        container->ids[index] = container->ids[last];
+        container->slots[container->ids[index]] = index;
+
+        // The moved element now wins ties it used to lose, as those go to the lowest element index.
+        container->navigation->cached[container->ids[index]] &= ~(1 << GUI_NAVIGATION_TAB);
+        InvalidateGuiNavigationAround(container, container->bounds[index], index, -1);
+    }
+
+    // Invalidate the handle, and push its index to the free list.
+    container->generations[element.index]++;
+    container->slots[element.index] = container->freeSlot;
+    container->freeSlot = element.index;
+
+    // Keep focus on the same element, or move it back to the first element if it was removed.
+    if (container->activeElement == index) {
+        container->activeElement = container->count > 0 ? 0 : -1;
+        container->focusLocked = false;
+    }
+    else if (container->activeElement == last) {
+        container->activeElement = index;
+    }
+
+    CompactGuiStringArena(container);
+}
+
+void SetGuiElementBounds(GuiContainer* container, GuiElement element, Rectangle bounds) {
+    int index = GetGuiElementIndex(container, element);
+    if (index < 0) {
+        return;
+    }
+
+    // Clear the navigation entries that pointed at the element, and those it's now closer to.
+    ClearGuiNavigationEntry(container->navigation, element.index);
+    InvalidateGuiNavigationAround(container, container->bounds[index], -1, element.index);
+    RemoveGuiSpatialIndexElement(container->spatialIndex, element.index);
+    container->bounds[index] = bounds;
+    AddGuiSpatialIndexElement(container->spatialIndex, element.index, bounds);
+    InvalidateGuiNavigationAround(container, bounds, index, -1);
+
+    // Move a group's view along with it, until it's drawn again.
+    if (container->flags[index] & GUI_ELEMENT_GROUP) {
+        GuiGroup* group = container->states[index].container->group;
+        group->view = GetGuiGroupView(group, bounds, container->states[index].text);
+    }
+}
+
+/**
+ * Replace one of an element's texts with a copy of the given text.
+ */
+void SetGuiElementStateText(GuiContainer* container, const char** field, const char* text) {
+    // Intern the new text first, so text that's already the element's isn't freed along the way.
+    const char* previous = *field;
+    *field = InternGuiString(container->strings, text);
+    ReleaseGuiString(container->strings, previous);
+}
+
+/**
+ * Change an element's text: the label of a button or check box, the left text of a slider, the items of a toggle
+ * group, combo box or dropdown box, or the title of a panel.
+ */
+void SetGuiElementText(GuiContainer* container, GuiElement element, const char* text) {
+    int index = GetGuiElementIndex(container, element);
+    if (index < 0) {
+        return;
+    }
+
+    SetGuiElementStateText(container, &container->states[index].text, text);
+    CompactGuiStringArena(container);
+
+    // The chosen item stays in the new items, which are split again when they're next drawn.
+    if (GetGuiElementClass(container->types[index])->flags & GUI_CLASS_CHOICE) {
+        GuiChoiceState* choice = &container->states[index].choice;
+        UnloadGuiChoiceItems(choice);
+        choice->count = GetGuiChoiceCount(container->states[index].text);
+        ClampGuiChoiceState(choice);
+    }
+
+    // An element sized to fit its text is laid out again.
+    GuiLayoutTree* tree = container->layout;
+    int node = tree != NULL ? tree->elementNodes[element.index] : -1;
+    if (node >= 0 && tree->nodes[node].size.fitText) {
+        MarkGuiLayoutDirty(container, tree->nodes[node].parent);
+    }
+}
+
+void SetGuiSliderText(GuiContainer* container, GuiElement element, const char* textLeft, const char* textRight) {
+    int index = GetGuiElementIndex(container, element);
+    if (index < 0) {
+        return;
+    }
+
+    const char** field = GetGuiElementTextRight(container, index);
+    if (field == NULL) {
+        return;
+    }
+
+    SetGuiElementStateText(container, &container->states[index].text, textLeft);
+    SetGuiElementStateText(container, field, textRight);
+    CompactGuiStringArena(container);
+}
+
+/**
+ * Get an element's text, as copied into the container. The copy stays valid until an element of the container is
+ * removed, or has its text changed.
+ */
+const char* GetGuiElementText(GuiContainer* container, GuiElement element) {
+    int index = GetGuiElementIndex(container, element);
+    if (index < 0) {
+        return NULL;
+    }
+
+    return container->states[index].text;
+}
+
+GuiElement AddGuiButton(GuiContainer* container, Rectangle bounds, const char* text) {
+    GuiElementState state = { 0 };
+    state.text = text;
+    state.pressed = false;
+    return AddElement(container, GUI_TYPE_BUTTON, bounds, state);
+}
+
+GuiElement AddCheckBox(GuiContainer* container, Rectangle bounds, const char* text, bool checked) {
+    GuiElementState state = { 0 };
+    state.text = text;
+    state.checked = checked;
+    return AddElement(container, GUI_TYPE_CHECKBOX, bounds, state);
+}
+
+/**
+ * Add a toggle, a button that stays down while it's active. Its state is read like a check box's.
+ */
+GuiElement AddGuiToggle(GuiContainer* container, Rectangle bounds, const char* text, bool active) {
+    GuiElementState state = { 0 };
+    state.text = text;
+    state.checked = active;
+    return AddElement(container, GUI_TYPE_TOGGLE, bounds, state);
+}
+
+/**
+ * Add an element that chooses one of the items in its text, separated by ';'.
+ */
+GuiElement AddGuiChoiceElement(GuiContainer* container, int type, Rectangle bounds, const char* text, int active) {
+    GuiElementState state = { 0 };
+    state.text = text;
+    state.choice.active = active;
+    state.choice.count = GetGuiChoiceCount(text);
+    ClampGuiChoiceState(&state.choice);
+    return AddElement(container, type, bounds, state);
+}
+
+/**
+ * Add a toggle group, a row of toggles that shares out its bounds, one per item in its text, of which one is active.
+ * While it's focus locked, left and right choose the item.
+ */
+GuiElement AddGuiToggleGroup(GuiContainer* container, Rectangle bounds, const char* text, int active) {
+    return AddGuiChoiceElement(container, GUI_TYPE_TOGGLEGROUP, bounds, text, active);
+}
+
+/**
+ * Add a combo box, which moves on to the next of the items in its text each time it's pressed.
+ */
+GuiElement AddGuiComboBox(GuiContainer* container, Rectangle bounds, const char* text, int active) {
+    return AddGuiChoiceElement(container, GUI_TYPE_COMBOBOX, bounds, text, active);
+}
+
+/**
+ * Add a dropdown box, which opens to list the items in its text when it's pressed. While it's open, up and down
+ * choose the item.
+ */
+GuiElement AddGuiDropdownBox(GuiContainer* container, Rectangle bounds, const char* text, int active) {
+    return AddGuiChoiceElement(container, GUI_TYPE_DROPDOWNBOX, bounds, text, active);
+}
+
+/**
+ * Add an element that holds a value between a min and a max.
+ */
+GuiElement AddGuiValueElement(GuiContainer* container, int type, Rectangle bounds, const char* textLeft, const char* textRight, float value, float minValue, float maxValue, float step) {
+    GuiElementState state = { 0 };
+    state.text = textLeft;
+    state.value.textRight = textRight;
+    state.value.value = value;
+    state.value.min = minValue;
+    state.value.max = maxValue;
+    state.value.step = step > 0 ? step : 0;
+    return AddElement(container, type, bounds, state);
+}
+
+GuiElement AddSlider(GuiContainer* container, Rectangle bounds, const char* textLeft, const char* textRight, float value, float minValue, float maxValue) {
+    return AddGuiValueElement(container, GUI_TYPE_SLIDER, bounds, textLeft, textRight, value, minValue, maxValue, 0);
+}
+
+/**
+ * Add a slider drawn as a bar filled up to its value.
+ */
+GuiElement AddGuiSliderBar(GuiContainer* container, Rectangle bounds, const char* textLeft, const char* textRight, float value, float minValue, float maxValue) {
+    return AddGuiValueElement(container, GUI_TYPE_SLIDERBAR, bounds, textLeft, textRight, value, minValue, maxValue, 0);
+}
+
+/**
+ * Add a progress bar, which shows a value between its min and max, but can't take focus. Its value is set with
+ * SetGuiSliderValue().
+ */
+GuiElement AddGuiProgressBar(GuiContainer* container, Rectangle bounds, const char* textLeft, const char* textRight, float value, float minValue, float maxValue) {
+    return AddGuiValueElement(container, GUI_TYPE_PROGRESSBAR, bounds, textLeft, textRight, value, minValue, maxValue, 0);
+}
+
+/**
+ * Add a spinner, which steps a whole number between its min and max with the arrows, or with its buttons.
+ */
+GuiElement AddGuiSpinner(GuiContainer* container, Rectangle bounds, const char* text, int value, int minValue, int maxValue) {
+    return AddGuiValueElement(container, GUI_TYPE_SPINNER, bounds, text, NULL, (float)value, (float)minValue, (float)maxValue, 1);
+}
+
+/**
+ * Add a value box, which shows a whole number between its min and max, adjusted like a spinner.
+ */
+GuiElement AddGuiValueBox(GuiContainer* container, Rectangle bounds, const char* text, int value, int minValue, int maxValue) {
+    return AddGuiValueElement(container, GUI_TYPE_VALUEBOX, bounds, text, NULL, (float)value, (float)minValue, (float)maxValue, 1);
+}
+
+/**
+ * Add a text box, which holds up to textSize - 1 bytes of the given text. While it's focus locked, it takes what's
+ * typed, and backspace deletes from its end.
+ */
+GuiElement AddGuiTextBox(GuiContainer* container, Rectangle bounds, const char* text, int textSize) {
+    GuiElementState state = { 0 };
+    state.textBox.size = textSize > 1 ? textSize : 1;
+    state.textBox.buffer = (char*)MemAlloc(state.textBox.size);
+    state.textBox.buffer[0] = '\0';
+    if (text != NULL) {
+        strncat(state.textBox.buffer, text, state.textBox.size - 1);
+    }
+    return AddElement(container, GUI_TYPE_TEXTBOX, bounds, state);
+}
+
+/**
+ * Add a color picker. The mouse picks a color from it, and while it's focus locked, left and right turn its hue.
+ */
+GuiElement AddGuiColorPicker(GuiContainer* container, Rectangle bounds, const char* text, Color color) {
+    GuiElementState state = { 0 };
+    state.text = text;
+    state.color.color = color;
+    state.color.hue = GetGuiColorHue(color, 0);
+    return AddElement(container, GUI_TYPE_COLORPICKER, bounds, state);
+}
+
+/**
+ * Add a list view, whose rows are supplied by the given callbacks. Only the rows in view are asked for, so the list
+ * can have any number of rows.
+ */
+GuiElement AddGuiListView(GuiContainer* container, Rectangle bounds, GuiListCountCallback getCount, GuiListTextCallback getText, void* userData) {
+    GuiElementState state = { 0 };
+    state.list = InitGuiList(getCount, getText, userData);
+    return AddElement(container, GUI_TYPE_LISTVIEW, bounds, state);
+}
+
+/**
+ * Add a group element, which holds a new nested container.
+ *
+ * @return The nested container, which is freed along with the group element.
+ */
+GuiContainer* AddGuiGroup(GuiContainer* container, int type, Rectangle bounds, const char* text, Rectangle content) {
+    GuiGroup* group = (GuiGroup*)MemAlloc(sizeof(GuiGroup));
+    group->parent = container;
+    group->type = type;
+    group->content = content;
+    group->scroll = (Vector2){ 0, 0 };
+    group->collapsed = false;
+    group->view = GetGuiGroupView(group, bounds, text);
+
+    GuiContainer* nested = (GuiContainer*)MemAlloc(sizeof(GuiContainer));
+    *nested = InitGuiContainer();
+    nested->group = group;
+
+    // Nested containers record into the root container's profile.
+    MemFree(nested->profile);
+    nested->profile = NULL;
+#if defined(RAYGUI_CONTAINER_RETAINED)
+    if (container->drawCache != NULL) {
+        EnableGuiContainerDrawCache(nested);
+    }
+#endif
+
+    GuiElementState state = { 0 };
+    state.text = text;
+    state.container = nested;
+    group->element = AddElement(container, GUI_TYPE_GROUP, bounds, state);
+    return nested;
+}
+
+/**
+ * Add a panel, with a header if text isn't NULL. Elements added to the returned container are positioned relative to
+ * the inside of the panel.
+ */
+GuiContainer* AddGuiPanel(GuiContainer* container, Rectangle bounds, const char* text) {
+    return AddGuiGroup(container, GUI_GROUP_PANEL, bounds, text, (Rectangle){ 0 });
+}
+
+/**
+ * Add a scroll panel, showing the part of the given content size that's scrolled into view. Elements added to the
+ * returned container are positioned relative to the top left of the content.
+ */
+GuiContainer* AddGuiScrollPanel(GuiContainer* container, Rectangle bounds, const char* text, Rectangle content) {
+    return AddGuiGroup(container, GUI_GROUP_SCROLL_PANEL, bounds, text, content);
+}
+
+/**
+ * Add a window box, which collapses when its close button is pressed. Elements added to the returned container are
+ * positioned relative to the inside of the window, below its title bar.
+ */
+GuiContainer* AddGuiWindowBox(GuiContainer* container, Rectangle bounds, const char* title) {
+    return AddGuiGroup(container, GUI_GROUP_WINDOW_BOX, bounds, title, (Rectangle){ 0 });
+}
+
+/**
+ * Draw the elements of a container that overlap the region's clip.
+ */
+void DrawGuiContainerRegion(GuiContainer* container, GuiDrawRegion region) {
+    GUI_PROFILE_BEGIN(start);
+    int count = FindGuiElementsInArea(container, OffsetGuiRectangle(region.clip, (Vector2){ -region.origin.x, -region.origin.y }));
+    const int* elements = container->spatialIndex->results;
+    if (count < 0) {
+        elements = NULL;
+        count = container->count;
+    }
+    GUI_PROFILE_END(container, GUI_PHASE_CULL, start, count);
+    GUI_PROFILE_COUNT(container, elementsVisible, count);
+
+    // raygui's text measurements are answered from the container's string arena while its elements are drawn.
+    GuiStringArena* textArena = guiTextArena;
+    CompactGuiStringArena(container);
+    guiTextArena = container->strings;
+    BeginGuiContainerStyle(container->style);
+#if defined(RAYGUI_CONTAINER_RETAINED)
+    if (container->drawCache != NULL) {
+        DrawGuiContainerRetained(container, region, elements, count);
+        EndGuiContainerStyle(container->style);
+        guiTextArena = textArena;
+        return;
+    }
+#endif
+
+    for (int visible = 0; visible < count; visible++) {
+        int i = elements != NULL ? elements[visible] : visible;
+        if (container->flags[i] & GUI_ELEMENT_GROUP) {
+            DrawGuiGroup(container, i, region);
+            continue;
+        }
+
+        SetGuiElementDrawState(container, i);
+        DrawGuiElement(container, i, OffsetGuiRectangle(container->bounds[i], region.origin));
+    }
+    EndGuiContainerStyle(container->style);
+    guiTextArena = textArena;
+}
+
+/**
+ * Draw a group element's control, then its nested container, clipped to the group's view.
+ *
+ * Collapsed groups are skipped. Groups outside of the region's clip are never visited, and neither is anything nested
+ * in them.
+ */
+void DrawGuiGroup(GuiContainer* container, int element, GuiDrawRegion region) {
+    GuiContainer* nested = GetGuiGroupContainer(container, element);
+    GuiGroup* group = nested->group;
+    if (group->collapsed) {
+        return;
+    }
+
+    // Focus is shown on the elements inside the group, rather than on the group itself.
+    Rectangle bounds = OffsetGuiRectangle(container->bounds[element], region.origin);
+    const char* text = container->states[element].text;
+    Rectangle view = { 0 };
+    guiState = STATE_NORMAL;
+    SetGuiElementDrawAlpha(container, element);
+    switch (group->type) {
+        case GUI_GROUP_PANEL:
+            GuiPanel(bounds, text);
+            view = GetGuiGroupView(group, bounds, text);
+            break;
+        case GUI_GROUP_SCROLL_PANEL:
+            view = GuiScrollPanel(bounds, text, group->content, &group->scroll);
+            break;
+        case GUI_GROUP_WINDOW_BOX:
+            if (GuiWindowBox(bounds, text)) {
+                SetGuiContainerCollapsed(nested, true);
+                return;
+            }
+            view = GetGuiGroupView(group, bounds, text);
+            break;
+    }
+    group->view = OffsetGuiRectangle(view, (Vector2){ -region.origin.x, -region.origin.y });
+
+    GuiDrawRegion nestedRegion;
+    nestedRegion.origin = (Vector2){ view.x + group->scroll.x, view.y + group->scroll.y };
+    nestedRegion.clip = GetGuiRectangleOverlap(view, region.clip);
+    nestedRegion.scissor = true;
+    if (nestedRegion.clip.width <= 0 || nestedRegion.clip.height <= 0) {
+        return;
+    }
+
+    Rectangle clip = nestedRegion.clip;
+    BeginScissorMode((int)clip.x, (int)clip.y, (int)clip.width, (int)clip.height);
+    DrawGuiContainerRegion(nested, nestedRegion);
+    EndScissorMode();
+
+    // raylib doesn't nest scissor modes, so the parent's clip is applied again.
+    if (region.scissor) {
+        BeginScissorMode((int)region.clip.x, (int)region.clip.y, (int)region.clip.width, (int)region.clip.height);
+    }
+}
+
+/**
+ * Draw an outline of the given width around the outside of the given bounds, grown by the given pixels.
+ */
+void DrawGuiOutline(Rectangle bounds, float grow, int width, Color color) {
+    int x = (int)(bounds.x - grow) - width;
+    int y = (int)(bounds.y - grow) - width;
+    int outerWidth = (int)(bounds.width + grow * 2) + width * 2;
+    int outerHeight = (int)(bounds.height + grow * 2) + width * 2;
+    DrawRectangle(x, y, outerWidth, width, color);
+    DrawRectangle(x, y + outerHeight - width, outerWidth, width, color);
+    DrawRectangle(x, y + width, width, outerHeight - width * 2, color);
+    DrawRectangle(x + outerWidth - width, y + width, width, outerHeight - width * 2, color);
+}
+
+/**
+ * Draw the press pulses and the focus highlight of a root container with animation enabled, over its elements.
+ */
+void DrawGuiContainerAnimation(GuiContainer* container) {
+    GuiAnimation* animation = container->animation;
+    if (animation == NULL || !animation->enabled) {
+        return;
+    }
+
+    float alpha = guiAlpha * container->style->alpha;
+    int width = GetGuiContainerStyle(container, DEFAULT, BORDER_WIDTH);
+    width = width < 1 ? 1 : width;
+    for (int i = 0; i < animation->tweenCount; i++) {
+        GuiTween* tween = animation->tweens + i;
+        if (tween->type == GUI_TWEEN_PULSE) {
+            GuiContainer* pulsed = tween->container;
+            Rectangle bounds = OffsetGuiRectangle(pulsed->bounds[pulsed->slots[tween->slot]], GetGuiContainerOrigin(pulsed));
+            Color color = GetColor(GetGuiContainerStyle(pulsed, DEFAULT, BORDER_COLOR_PRESSED));
+            DrawGuiOutline(bounds, tween->value[0], width, Fade(color, alpha * tween->value[1]));
+        }
+    }
+
+    if (animation->focusShown) {
+        GuiContainer* focused = GetGuiFocusedContainer(container);
+        Color color = GetColor(GetGuiContainerStyle(focused, DEFAULT, focused->focusLocked ? BORDER_COLOR_PRESSED : BORDER_COLOR_FOCUSED));
+        DrawGuiOutline(animation->focusBounds, 0, width, Fade(color, alpha));
+    }
+}
+
+/**
+ * Draw the container, and the containers nested in it. Only the elements on the screen are drawn.
+ *
+ * raygui's state and style are set for each element, and restored once the container is drawn, so containers can be
+ * drawn one after another with different styles. Drawing has to happen on a single thread. While the container's input
+ * is recorded or replayed, what's drawn is hashed into the recording.
+ */
+void DrawGuiContainer(GuiContainer container) {
+    GUI_PROFILE_BEGIN(start);
+    GuiState state = guiState;
+    GuiDrawRegion region;
+    region.origin = (Vector2){ 0, 0 };
+#if defined(RAYGUI_STANDALONE)
+    // Without raylib, the size of the screen isn't known.
+    region.clip = (Rectangle){ -1e9f, -1e9f, 2e9f, 2e9f };
+#else
+    region.clip = (Rectangle){ 0, 0, (float)GetScreenWidth(), (float)GetScreenHeight() };
+#endif
+    region.scissor = false;
+    BeginGuiDrawHash(&container);
+    DrawGuiContainerRegion(&container, region);
+    DrawGuiContainerAnimation(&container);
+    EndGuiDrawHash(&container);
+    guiState = state;
+    GUI_PROFILE_COUNT(&container, draws, 1);
+    GUI_PROFILE_END(&container, GUI_PHASE_DRAW, start, 0);
+}
+
+bool IsGuiButtonPressed(GuiContainer* container, GuiElement element) {
+    int index = GetGuiElementIndex(container, element);
+    return index >= 0 && container->types[index] == GUI_TYPE_BUTTON && container->states[index].pressed;
+}
+
+/**
+ * Check whether a check box is checked, or a toggle is active.
+ */
+bool IsGuiCheckBoxChecked(GuiContainer* container, GuiElement element) {
+    int index = GetGuiElementIndex(container, element);
+    if (index < 0 || (container->types[index] != GUI_TYPE_CHECKBOX && container->types[index] != GUI_TYPE_TOGGLE)) {
+        return false;
+    }
+
+    return container->states[index].checked;
+}
+
+/**
+ * Get the value of a slider, slider bar, progress bar, spinner or value box.
+ */
+float GetGuiSliderValue(GuiContainer* container, GuiElement element) {
+    int index = GetGuiElementIndex(container, element);
+    if (index < 0 || !(GetGuiElementClass(container->types[index])->flags & GUI_CLASS_VALUE)) {
+        return 0.0f;
+    }
+
+    return container->states[index].value.value;
+}
+
+/**
+ * Set the value of a slider, slider bar, progress bar, spinner or value box, kept in its min/max bounds.
+ */
+void SetGuiSliderValue(GuiContainer* container, GuiElement element, float value) {
+    int index = GetGuiElementIndex(container, element);
+    if (index < 0 || !(GetGuiElementClass(container->types[index])->flags & GUI_CLASS_VALUE)) {
+        return;
+    }
+
+    GuiValueState* state = &container->states[index].value;
+    state->value = value < state->min ? state->min : value > state->max ? state->max : value;
+    state->pending = 0;
+}
+
+/**
+ * Get the whole number value of a spinner or value box.
+ */
+int GetGuiSpinnerValue(GuiContainer* container, GuiElement element) {
+    return (int)GetGuiSliderValue(container, element);
+}
+
+/**
+ * Set the increment a slider, spinner or value box snaps to when adjusted, or 0 to adjust it freely.
+ */
+void SetGuiElementStep(GuiContainer* container, GuiElement element, float step) {
+    int index = GetGuiElementIndex(container, element);
+    if (index < 0 || !(GetGuiElementClass(container->types[index])->flags & GUI_CLASS_VALUE)) {
+        return;
+    }
+
+    container->states[index].value.step = step > 0 ? step : 0;
+    container->states[index].value.pending = 0;
+}
+
+/**
+ * Get the chosen item of a toggle group, combo box or dropdown box.
+ *
+ * @return The item's index, or -1 if the element doesn't choose an item.
+ */
+int GetGuiElementActive(GuiContainer* container, GuiElement element) {
+    int index = GetGuiElementIndex(container, element);
+    if (index < 0 || !(GetGuiElementClass(container->types[index])->flags & GUI_CLASS_CHOICE)) {
+        return -1;
+    }
+
+    return container->states[index].choice.active;
+}
+
+/**
+ * Choose an item of a toggle group, combo box or dropdown box, kept in its items.
+ */
+void SetGuiElementActive(GuiContainer* container, GuiElement element, int active) {
+    int index = GetGuiElementIndex(container, element);
+    if (index < 0 || !(GetGuiElementClass(container->types[index])->flags & GUI_CLASS_CHOICE)) {
+        return;
+    }
+
+    GuiChoiceState* state = &container->states[index].choice;
+    state->active = active;
+    ClampGuiChoiceState(state);
+}
+
+/**
+ * Get the text in a text box. It changes as the text box is typed into.
+ */
+const char* GetGuiTextBoxText(GuiContainer* container, GuiElement element) {
+    int index = GetGuiElementIndex(container, element);
+    if (index < 0 || container->types[index] != GUI_TYPE_TEXTBOX) {
+        return NULL;
+    }
+
+    return container->states[index].textBox.buffer;
+}
+
+/**
+ * Replace the text in a text box, cut short to fit in its size.
+ */
+void SetGuiTextBoxText(GuiContainer* container, GuiElement element, const char* text) {
+    int index = GetGuiElementIndex(container, element);
+    if (index < 0 || container->types[index] != GUI_TYPE_TEXTBOX) {
+        return;
+    }
+
+    GuiTextBoxState* state = &container->states[index].textBox;
+    state->buffer[0] = '\0';
+    if (text != NULL) {
+        strncat(state->buffer, text, state->size - 1);
+    }
+    state->revision++;
+}
+
+Color GetGuiColorPickerColor(GuiContainer* container, GuiElement element) {
+    int index = GetGuiElementIndex(container, element);
+    if (index < 0 || container->types[index] != GUI_TYPE_COLORPICKER) {
+        return (Color){ 0, 0, 0, 0 };
+    }
+
+    return container->states[index].color.color;
+}
+
+void SetGuiColorPickerColor(GuiContainer* container, GuiElement element, Color color) {
+    int index = GetGuiElementIndex(container, element);
+    if (index < 0 || container->types[index] != GUI_TYPE_COLORPICKER) {
+        return;
+    }
+
+    GuiColorState* state = &container->states[index].color;
+    state->color = color;
+    state->hue = GetGuiColorHue(color, state->hue);
+}
+
+/**
+ * Get the type of an element.
+ *
+ * @return The type, or GUI_TYPE_COUNT for an invalid handle.
+ */
+GuiElementType GetGuiElementType(GuiContainer* container, GuiElement element) {
+    int index = GetGuiElementIndex(container, element);
+    if (index < 0) {
+        return GUI_TYPE_COUNT;
+    }
+
+    return (GuiElementType)container->types[index];
+}
+
+/**
+ * Get the selected row of a list view.
+ *
+ * @return The row, or -1 if no row is selected.
+ */
+int GetGuiListViewActive(GuiContainer* container, GuiElement element) {
+    int index = GetGuiElementIndex(container, element);
+    if (index < 0 || container->types[index] != GUI_TYPE_LISTVIEW) {
+        return -1;
+    }
+
+    return container->states[index].list->active;
+}
+
+/**
+ * Select a row of a list view, or clear the selection with -1. The row takes the list's focus, and is scrolled into
+ * view.
+ */
+void SetGuiListViewActive(GuiContainer* container, GuiElement element, int row) {
+    int index = GetGuiElementIndex(container, element);
+    if (index < 0 || container->types[index] != GUI_TYPE_LISTVIEW) {
+        return;
+    }
+
+    GuiList* list = container->states[index].list;
+    list->active = row;
+    if (row >= 0) {
+        int visibleRows = GetGuiListVisibleRows(container, container->bounds[index]);
+        list->focus = row;
+        ClampGuiList(list, visibleRows);
+        ScrollGuiListToFocus(list, visibleRows);
+    }
+}
+
+/**
+ * Get the element at the given element index, which is its position in tab order. Elements loaded from a file keep
+ * the order they were saved in.
+ *
+ * @return The element's handle, or an invalid handle if there's no element at that index.
+ */
+GuiElement GetGuiElementAt(GuiContainer* container, int index) {
+    if (index < 0 || index >= container->count) {
+        return (GuiElement){-1, 0};
+    }
+
+    return GetGuiElementHandle(container, index);
+}
+
+#define GUI_CONTAINER_FILE_VERSION 3
+#define GUI_CONTAINER_FILE_BYTE_ORDER 0x01020304u
+
+// Each section starts on a 16 byte boundary, so the arrays can be used in place.
+#define GUI_CONTAINER_FILE_ALIGNMENT 16
+
+/**
+ * The arrays stored in a container file, in the order they're written.
+ */
+enum GuiContainerFileSection {
+    GUI_FILE_BOUNDS = 0,
+    GUI_FILE_FLAGS,
+    GUI_FILE_TYPES,
+    GUI_FILE_STATES,            // With each text replaced by its offset in GUI_FILE_TEXT, plus one
+    GUI_FILE_IDS,
+    GUI_FILE_SLOTS,
+    GUI_FILE_GENERATIONS,
+    GUI_FILE_BUCKETS,
+    GUI_FILE_NEXT,
+    GUI_FILE_PREV,
+    GUI_FILE_CELL_X,
+    GUI_FILE_CELL_Y,
+    GUI_FILE_NEIGHBOURS,
+    GUI_FILE_DISTANCES,
+    GUI_FILE_CACHED,
+    GUI_FILE_TAB_NEXT,
+    GUI_FILE_OPEN_INDEX,
+    GUI_FILE_OPEN,
+    GUI_FILE_STRINGS,           // With each text replaced by its offset in GUI_FILE_TEXT
+    GUI_FILE_TABLE,
+    GUI_FILE_TEXT,
+    GUI_FILE_SECTION_COUNT
+};
+
+/**
+ * The start of a container file, followed by its sections.
+ *
+ * The file holds the container's arrays as they are in memory, so it's only read by builds with the same byte order
+ * and pointer size, which the header records. The arrays indexed by element index and by handle index all have
+ * capacity entries.
+ */
+typedef struct GuiContainerFileHeader {
+    char magic[4];                      // "rGCF"
+    unsigned int byteOrder;             // GUI_CONTAINER_FILE_BYTE_ORDER, as written by the machine that saved the file
+    int version;
+    int headerSize;
+    int stateSize;                      // sizeof(GuiElementState), which depends on the size of a pointer
+    int stringSize;                     // sizeof(GuiString)
+    int capacity;                       // The number of handle indices used, which is at least the element count
+    int count;
+    int freeSlot;
+    int activeElement;
+    float cellSize;                     // The RAYGUI_CONTAINER_GRID_CELL_SIZE the spatial index was built with
+    GuiSpatialIndex spatialIndex;       // The spatial index, without its arrays
+    GuiNavigationGraph navigation;      // The navigation graph, without its arrays
+    int stringCount;
+    int tableCapacity;
+    int textSize;
+    unsigned int sections[GUI_FILE_SECTION_COUNT];      // The offset of each section from the start of the file
+} GuiContainerFileHeader;
+
+/**
+ * Get the size of a section of a container file.
+ */
+size_t GetGuiContainerFileSectionSize(const GuiContainerFileHeader* header, int section) {
+    size_t capacity = (size_t)header->capacity;
+    switch (section) {
+        case GUI_FILE_BOUNDS: return capacity * sizeof(Rectangle);
+        case GUI_FILE_FLAGS: return capacity * sizeof(unsigned char);
+        case GUI_FILE_TYPES: return capacity * sizeof(unsigned char);
+        case GUI_FILE_STATES: return capacity * sizeof(GuiElementState);
+        case GUI_FILE_BUCKETS: return (size_t)(header->spatialIndex.bucketMask + 1) * sizeof(int);
+        case GUI_FILE_NEIGHBOURS: return capacity * 4 * sizeof(int);
+        case GUI_FILE_DISTANCES: return capacity * 4 * sizeof(float);
+        case GUI_FILE_CACHED: return capacity * sizeof(unsigned char);
+        case GUI_FILE_STRINGS: return (size_t)header->stringCount * sizeof(GuiString);
+        case GUI_FILE_TABLE: return (size_t)header->tableCapacity * sizeof(int);
+        case GUI_FILE_TEXT: return (size_t)header->textSize;
+        default: return capacity * sizeof(int);
+    }
+}
+
+/**
+ * Check that a file is a container file this build can use in place, and that its sections fit in it. The element
+ * data is checked as it's loaded.
+ */
+bool IsGuiContainerFileValid(GuiContainerFile* file) {
+    GuiContainerFileHeader* header = (GuiContainerFileHeader*)file->data;
+    if (file->size < sizeof(GuiContainerFileHeader) || memcmp(header->magic, "rGCF", 4) != 0 ||
+        header->byteOrder != GUI_CONTAINER_FILE_BYTE_ORDER || header->version != GUI_CONTAINER_FILE_VERSION ||
+        header->headerSize != (int)sizeof(GuiContainerFileHeader) || header->stateSize != (int)sizeof(GuiElementState) ||
+        header->stringSize != (int)sizeof(GuiString) || header->cellSize != RAYGUI_CONTAINER_GRID_CELL_SIZE) {
+        return false;
+    }
+    if (header->capacity < 0 || header->count < 0 || header->count > header->capacity ||
+        header->activeElement < -1 || header->activeElement >= header->count || header->freeSlot < -1 ||
+        header->freeSlot >= header->capacity || header->stringCount < 0 ||
+        header->textSize < 0 || header->tableCapacity < header->stringCount ||
+        (header->tableCapacity & (header->tableCapacity - 1)) != 0 || header->spatialIndex.bucketMask < 0 ||
+        (header->spatialIndex.bucketMask & (header->spatialIndex.bucketMask + 1)) != 0 ||
+        header->spatialIndex.count != header->count || header->navigation.openCount < 0 ||
+        header->navigation.openCount > header->capacity) {
+        return false;
+    }
+
+    for (int section = 0; section < GUI_FILE_SECTION_COUNT; section++) {
+        size_t offset = header->sections[section];
+        if (offset % GUI_CONTAINER_FILE_ALIGNMENT != 0 || offset > file->size ||
+            GetGuiContainerFileSectionSize(header, section) > file->size - offset) {
+            return false;
+        }
+    }
+
+    // The text ends with the terminator of its last string, so none of them runs off the end of the file.
+    return header->textSize == 0 || file->data[header->sections[GUI_FILE_TEXT] + header->textSize - 1] == '\0';
+}
+
+/**
+ * Turn the offset of a text in a container file, plus one, back into a pointer into the file's text.
+ *
+ * @return false if the offset is outside of the text.
+ */
+bool LoadGuiContainerFileText(const char** text, char* fileText, int textSize) {
+    uintptr_t offset = (uintptr_t)*text;
+    if (offset == 0) {
+        *text = NULL;
+        return true;
+    }
+    if (offset > (uintptr_t)textSize) {
+        return false;
+    }
+    *text = fileText + offset - 1;
+    return true;
+}
+
+/**
+ * Check that a handle index read from a container file holds one of its elements, before following it.
+ */
+bool IsGuiContainerFileHandle(GuiContainer* container, int handle) {
+    return handle >= 0 && handle < container->capacity && container->slots[handle] >= 0 &&
+        container->slots[handle] < container->count && container->ids[container->slots[handle]] == handle;
+}
+
+/**
+ * Check that the cached navigation of an element in a container file only leads to elements, and that the open list
+ * agrees with its position in it.
+ */
+bool IsGuiContainerFileNavigationValid(GuiContainer* container, int slot) {
+    GuiNavigationGraph* graph = container->navigation;
+    for (int direction = UP; direction <= LEFT; direction++) {
+        int neighbour = graph->neighbours[slot * 4 + direction];
+        if ((graph->cached[slot] & (1 << direction)) && neighbour != -1 && !IsGuiContainerFileHandle(container, neighbour)) {
+            return false;
+        }
+    }
+    int next = graph->tabNext[slot];
+    if ((graph->cached[slot] & (1 << GUI_NAVIGATION_TAB)) && next != -1 && !IsGuiContainerFileHandle(container, next)) {
+        return false;
+    }
+
+    int position = graph->openIndex[slot];
+    return position >= -1 && position < graph->openCount && (position == -1 || graph->open[position] == slot);
+}
+
+/**
+ * Map a file into memory, with private pages, so the loaded container can change without writing to the file.
+ *
+ * @return The file, or NULL if it couldn't be opened.
+ */
+GuiContainerFile* OpenGuiContainerFile(const char* fileName) {
+    unsigned char* data = NULL;
+    size_t size = 0;
+#if defined(RAYGUI_CONTAINER_MMAP)
+    int descriptor = open(fileName, O_RDONLY);
+    if (descriptor < 0) {
+        return NULL;
+    }
+
+    struct stat info;
+    if (fstat(descriptor, &info) == 0 && info.st_size > 0) {
+        size = (size_t)info.st_size;
+        data = (unsigned char*)mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, descriptor, 0);
+    }
+    close(descriptor);
+    if (data == NULL || data == (unsigned char*)MAP_FAILED) {
+        return NULL;
+    }
+#else
+    FILE* stream = fopen(fileName, "rb");
+    if (stream == NULL) {
+        return NULL;
+    }
+
+    fseek(stream, 0, SEEK_END);
+    long length = ftell(stream);
+    fseek(stream, 0, SEEK_SET);
+    if (length > 0) {
+        size = (size_t)length;
+        data = (unsigned char*)MemAlloc((unsigned int)size);
+        if (fread(data, 1, size, stream) != size) {
+            MemFree(data);
+            data = NULL;
+        }
+    }
+    fclose(stream);
+    if (data == NULL) {
+        return NULL;
+    }
+#endif
+
+    GuiContainerFile* file = (GuiContainerFile*)MemAlloc(sizeof(GuiContainerFile));
+    file->data = data;
+    file->size = size;
+    file->shared = true;
+    return file;
+}
+
+/**
+ * Load a container saved with ExportGuiContainer().
+ *
+ * The file is mapped into memory and the container's arrays point into it, along with the navigation that was
+ * computed when it was saved, so loading takes a handful of allocations however many elements there are. The only
+ * per-element work is turning the offsets of the element text back into pointers, and checking the indices along the
+ * way, along with those of the spatial index and the navigation, so a damaged file is rejected rather than read out of
+ * bounds.
+ *
+ * @return The loaded container, or an empty container if the file couldn't be loaded.
+ */
+GuiContainer LoadGuiContainer(const char* fileName) {
+    GuiContainerFile* file = OpenGuiContainerFile(fileName);
+    if (file == NULL) {
+        return InitGuiContainer();
+    }
+    GuiContainerFileHeader* header = (GuiContainerFileHeader*)file->data;
+    if (!IsGuiContainerFileValid(file) || header->capacity == 0) {
+        UnloadGuiContainerFile(file);
+        return InitGuiContainer();
+    }
+
+    GuiContainer container;
+    const unsigned int* sections = header->sections;
+    container.count = header->count;
+    container.capacity = header->capacity;
+    container.bounds = (Rectangle*)(file->data + sections[GUI_FILE_BOUNDS]);
+    container.flags = file->data + sections[GUI_FILE_FLAGS];
+    container.types = file->data + sections[GUI_FILE_TYPES];
+    container.states = (GuiElementState*)(file->data + sections[GUI_FILE_STATES]);
+    container.ids = (int*)(file->data + sections[GUI_FILE_IDS]);
+    container.slots = (int*)(file->data + sections[GUI_FILE_SLOTS]);
+    container.generations = (unsigned int*)(file->data + sections[GUI_FILE_GENERATIONS]);
+    container.slotCount = header->capacity;
+    container.freeSlot = header->freeSlot;
+
+    GuiSpatialIndex* index = (GuiSpatialIndex*)MemAlloc(sizeof(GuiSpatialIndex));
+    *index = header->spatialIndex;
+    index->buckets = (int*)(file->data + sections[GUI_FILE_BUCKETS]);
+    index->next = (int*)(file->data + sections[GUI_FILE_NEXT]);
+    index->prev = (int*)(file->data + sections[GUI_FILE_PREV]);
+    index->cellX = (int*)(file->data + sections[GUI_FILE_CELL_X]);
+    index->cellY = (int*)(file->data + sections[GUI_FILE_CELL_Y]);
+    index->results = (int*)MemAlloc(container.capacity * sizeof(int));
+    container.spatialIndex = index;
+
+    GuiNavigationGraph* graph = (GuiNavigationGraph*)MemAlloc(sizeof(GuiNavigationGraph));
+    *graph = header->navigation;
+    graph->neighbours = (int*)(file->data + sections[GUI_FILE_NEIGHBOURS]);
+    graph->distances = (float*)(file->data + sections[GUI_FILE_DISTANCES]);
+    graph->cached = file->data + sections[GUI_FILE_CACHED];
+    graph->tabNext = (int*)(file->data + sections[GUI_FILE_TAB_NEXT]);
+    graph->openIndex = (int*)(file->data + sections[GUI_FILE_OPEN_INDEX]);
+    graph->open = (int*)(file->data + sections[GUI_FILE_OPEN]);
+    container.navigation = graph;
+
+    InitGuiContainerSettings(&container);
+    container.activeElement = header->activeElement;
+    container.file = file;
+
+    // The strings are used in place, with their text still in the file.
+    GuiStringArena* arena = container.strings;
+    char* text = (char*)(file->data + sections[GUI_FILE_TEXT]);
+    arena->strings = (GuiString*)(file->data + sections[GUI_FILE_STRINGS]);
+    arena->stringCount = header->stringCount;
+    arena->stringCapacity = header->stringCount;
+    arena->table = (int*)(file->data + sections[GUI_FILE_TABLE]);
+    arena->tableMask = header->tableCapacity - 1;
+    arena->usedBytes = header->textSize;
+    arena->liveBytes = header->textSize;
+    arena->mapped = true;
+    bool valid = true;
+    for (int i = 0; i < arena->stringCount && valid; i++) {
+        GuiString* string = arena->strings + i;
+        uintptr_t offset = (uintptr_t)string->text;
+        valid = string->length >= 0 && offset < (uintptr_t)header->textSize &&
+            (uintptr_t)string->length < (uintptr_t)header->textSize - offset && text[offset + string->length] == '\0';
+        string->text = text + offset;
+    }
+    for (int i = 0; i < header->tableCapacity && valid; i++) {
+        valid = arena->table[i] >= -1 && arena->table[i] < arena->stringCount;
+    }
+
+    // Handle indices either hold an element or link the free list, and only elements that can be saved are loaded.
+    for (int i = 0; i < container.capacity && valid; i++) {
+        valid = container.slots[i] >= -1 && container.slots[i] < container.capacity &&
+            (i >= graph->openCount || (IsGuiContainerFileHandle(&container, graph->open[i]) && graph->openIndex[graph->open[i]] == i));
+        if (!valid || i >= container.count) {
+            continue;
+        }
+
+        valid = container.ids[i] >= 0 && container.ids[i] < container.capacity && container.slots[container.ids[i]] == i &&
+            container.types[i] < GUI_TYPE_COUNT && GetGuiElementClass(container.types[i])->letter != 0 &&
+            !(container.flags[i] & GUI_ELEMENT_GROUP) && IsGuiContainerFileNavigationValid(&container, container.ids[i]) &&
+            LoadGuiContainerFileText(&container.states[i].text, text, header->textSize);
+        const char** textRight = valid ? GetGuiElementTextRight(&container, i) : NULL;
+        if (textRight != NULL) {
+            valid = LoadGuiContainerFileText(textRight, text, header->textSize);
+        }
+        if (valid && (GetGuiElementClass(container.types[i])->flags & GUI_CLASS_CHOICE)) {
+            container.states[i].choice.items = NULL;
+        }
+    }
+
+    // Each element is linked once, into the bucket of its cell, after the element before it, so walking a bucket ends.
+    int linked = 0;
+    for (int i = 0; i <= index->bucketMask && valid; i++) {
+        int prev = -1;
+        int current = index->buckets[i];
+        while (current != -1 && valid) {
+            valid = linked++ < container.count && IsGuiContainerFileHandle(&container, current) &&
+                index->prev[current] == prev && GetGuiSpatialIndexBucket(index, index->cellX[current], index->cellY[current]) == i;
+            prev = current;
+            current = valid ? index->next[current] : -1;
+        }
+    }
+    valid = valid && linked == container.count;
+
+    // The free list only holds handle indices without an element, so it can't hand one out twice, and it ends.
+    int freeSlots = 0;
+    for (int slot = container.freeSlot; slot != -1 && valid; slot = valid ? container.slots[slot] : -1) {
+        valid = freeSlots++ < container.capacity - container.count && !IsGuiContainerFileHandle(&container, slot);
+    }
+
+    if (!valid) {
+        // Leave the elements out, as they're what couldn't be trusted, and the rest goes with the file.
+        container.count = 0;
+        UnloadGuiContainer(container);
+        return InitGuiContainer();
+    }
+
+    return container;
+}
+
+/**
+ * Check that every element of a container can be saved. Nested containers, list views and text boxes can't, as list
+ * views get their rows from callbacks, and text boxes own their text.
+ */
+bool IsGuiContainerSavable(GuiContainer* container) {
+    for (int i = 0; i < container->count; i++) {
+        if ((container->flags[i] & GUI_ELEMENT_GROUP) || GetGuiElementClass(container->types[i])->letter == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Get the offset of a string's text in the GUI_FILE_TEXT section of the file being saved, plus one, or 0 for NULL.
+ */
+uintptr_t GetGuiContainerFileTextOffset(GuiStringArena* strings, const int* offsets, const char* text) {
+    if (text == NULL) {
+        return 0;
+    }
+
+    int length;
+    unsigned int hash = HashGuiString(text, &length);
+    return (uintptr_t)offsets[FindGuiString(strings, text, length, hash)] + 1;
+}
+
+/**
+ * Save a container in the binary format read by LoadGuiContainer(), which loads it without building it element by
+ * element. The navigation between the elements is computed first, so it's saved along with them.
+ *
+ * The file can only be loaded by builds with the same byte order and pointer size. Save a text file with
+ * ExportGuiContainerText() to keep a screen in a portable form.
+ *
+ * @return false if the file couldn't be written, or the container holds nested containers, list views or text boxes.
+ */
+bool ExportGuiContainer(GuiContainer* container, const char* fileName) {
+    if (!IsGuiContainerSavable(container)) {
+        return false;
+    }
+
+    for (int i = 0; i < container->count; i++) {
+        if (container->flags[i] & GUI_ELEMENT_SELECTABLE) {
+            for (int direction = UP; direction <= LEFT; direction++) {
+                GetGuiElementNeighbour(container, i, direction);
+            }
+            GetGuiElementTabNext(container, i);
+        }
+    }
+
+    // Intern the element text in an arena of its own, leaving out the strings only kept for their size, and lay it
+    // out in the order it was interned.
+    GuiStringArena* strings = InitGuiStringArena();
+    for (int i = 0; i < container->count; i++) {
+        InternGuiString(strings, container->states[i].text);
+        const char** textRight = GetGuiElementTextRight(container, i);
+        if (textRight != NULL) {
+            InternGuiString(strings, *textRight);
+        }
+    }
+    int* offsets = (int*)MemAlloc((strings->stringCount > 0 ? strings->stringCount : 1) * sizeof(int));
+    GuiString* fileStrings = (GuiString*)MemAlloc((strings->stringCount > 0 ? strings->stringCount : 1) * sizeof(GuiString));
+    int textSize = 0;
+    for (int i = 0; i < strings->stringCount; i++) {
+        offsets[i] = textSize;
+        fileStrings[i] = strings->strings[i];
+        fileStrings[i].text = (char*)(uintptr_t)textSize;
+        fileStrings[i].size = (Vector2){ 0, 0 };
+        fileStrings[i].measured = 0;
+        textSize += strings->strings[i].length + 1;
+    }
+
+    // Replace the text of each element with its offset, and leave out the items split from it.
+    int capacity = container->slotCount;
+    GuiElementState* states = (GuiElementState*)MemAlloc((capacity > 0 ? capacity : 1) * sizeof(GuiElementState));
+    memset(states, 0, (capacity > 0 ? capacity : 1) * sizeof(GuiElementState));
+    for (int i = 0; i < container->count; i++) {
+        memcpy(states + i, container->states + i, sizeof(GuiElementState));
+        states[i].text = (const char*)GetGuiContainerFileTextOffset(strings, offsets, container->states[i].text);
+        const char** textRight = GetGuiElementTextRight(container, i);
+        if (textRight != NULL) {
+            states[i].value.textRight = (const char*)GetGuiContainerFileTextOffset(strings, offsets, *textRight);
+        }
+        if (GetGuiElementClass(container->types[i])->flags & GUI_CLASS_CHOICE) {
+            states[i].choice.items = NULL;
+        }
+    }
+
+    GuiContainerFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, "rGCF", 4);
+    header.byteOrder = GUI_CONTAINER_FILE_BYTE_ORDER;
+    header.version = GUI_CONTAINER_FILE_VERSION;
+    header.headerSize = (int)sizeof(GuiContainerFileHeader);
+    header.stateSize = (int)sizeof(GuiElementState);
+    header.stringSize = (int)sizeof(GuiString);
+    header.capacity = capacity;
+    header.count = container->count;
+    header.freeSlot = container->freeSlot;
+    header.activeElement = container->activeElement;
+    header.cellSize = RAYGUI_CONTAINER_GRID_CELL_SIZE;
+    header.stringCount = strings->stringCount;
+    header.tableCapacity = strings->table != NULL ? strings->tableMask + 1 : 0;
+    header.textSize = textSize;
+
+    // Leave the pointers out, as they mean nothing once loaded, so saving the same container gives the same file.
+    GuiSpatialIndex* index = container->spatialIndex;
+    GuiNavigationGraph* graph = container->navigation;
+    header.spatialIndex.bucketMask = index->bucketMask;
+    header.spatialIndex.count = index->count;
+    header.spatialIndex.minCellX = index->minCellX;
+    header.spatialIndex.minCellY = index->minCellY;
+    header.spatialIndex.maxCellX = index->maxCellX;
+    header.spatialIndex.maxCellY = index->maxCellY;
+    header.spatialIndex.minWidth = index->minWidth;
+    header.spatialIndex.minHeight = index->minHeight;
+    header.spatialIndex.maxWidth = index->maxWidth;
+    header.spatialIndex.maxHeight = index->maxHeight;
+    header.navigation.openCount = graph->openCount;
+    header.navigation.maxDistance = graph->maxDistance;
+
+    const void* data[GUI_FILE_SECTION_COUNT] = {
+        container->bounds, container->flags, container->types, states, container->ids, container->slots,
+        container->generations, index->buckets, index->next, index->prev, index->cellX, index->cellY,
+        graph->neighbours, graph->distances, graph->cached, graph->tabNext, graph->openIndex, graph->open,
+        fileStrings, strings->table, NULL
+    };
+    size_t offset = (sizeof(GuiContainerFileHeader) + GUI_CONTAINER_FILE_ALIGNMENT - 1) / GUI_CONTAINER_FILE_ALIGNMENT * GUI_CONTAINER_FILE_ALIGNMENT;
+    for (int section = 0; section < GUI_FILE_SECTION_COUNT; section++) {
+        header.sections[section] = (unsigned int)offset;
+        offset += GetGuiContainerFileSectionSize(&header, section);
+        offset = (offset + GUI_CONTAINER_FILE_ALIGNMENT - 1) / GUI_CONTAINER_FILE_ALIGNMENT * GUI_CONTAINER_FILE_ALIGNMENT;
+    }
+
+    FILE* file = fopen(fileName, "wb");
+    bool written = file != NULL;
+    if (written) {
+        static const unsigned char padding[GUI_CONTAINER_FILE_ALIGNMENT] = { 0 };
+        written = fwrite(&header, sizeof(header), 1, file) == 1;
+        size_t position = sizeof(header);
+        for (int section = 0; section < GUI_FILE_SECTION_COUNT && written; section++) {
+            written = fwrite(padding, 1, header.sections[section] - position, file) == header.sections[section] - position;
+            size_t size = GetGuiContainerFileSectionSize(&header, section);
+            if (section == GUI_FILE_TEXT) {
+                for (int i = 0; i < strings->stringCount && written; i++) {
+                    written = fwrite(strings->strings[i].text, 1, strings->strings[i].length + 1, file) == (size_t)strings->strings[i].length + 1;
+                }
+            }
+            else if (size > 0) {
+                written = written && fwrite(data[section], 1, size, file) == size;
+            }
+            position = header.sections[section] + size;
+        }
+        written = fclose(file) == 0 && written;
+    }
+
+    MemFree(states);
+    MemFree(fileStrings);
+    MemFree(offsets);
+    UnloadGuiStringArena(strings);
+    return written;
+}
+
+/**
+ * Skip the spaces and tabs between the fields of a line of a text container file.
+ */
+char* SkipGuiTextSpaces(char* cursor) {
+    while (*cursor == ' ' || *cursor == '\t') {
+        cursor++;
+    }
+    return cursor;
+}
+
+/**
+ * Read a string from a text container file: a quoted string, with \", \\ and \n escapes, or - for no text. The string
+ * is unescaped in place.
+ *
+ * @return false if there's no string at the cursor.
+ */
+bool ReadGuiTextString(char** cursor, const char** text) {
+    char* read = SkipGuiTextSpaces(*cursor);
+    if (*read == '-') {
+        *text = NULL;
+        *cursor = read + 1;
+        return true;
+    }
+    if (*read != '"') {
+        return false;
+    }
+
+    char* write = ++read;
+    *text = write;
+    for (; *read != '"'; read++) {
+        if (*read == '\0' || *read == '\n') {
+            return false;
+        }
+        if (*read == '\\' && (read[1] == '"' || read[1] == '\\' || read[1] == 'n')) {
+            read++;
+            *write++ = *read == 'n' ? '\n' : *read;
+        }
+        else {
+            *write++ = *read;
+        }
+    }
+    *write = '\0';
+    *cursor = read + 1;
+    return true;
+}
+
+/**
+ * Check whether a number, rather than a string, comes next in a line of a text container file.
+ */
+bool IsGuiTextNumber(char* cursor) {
+    cursor = SkipGuiTextSpaces(cursor);
+    if (*cursor == '+' || *cursor == '-') {
+        cursor++;
+    }
+    if (*cursor == '.') {
+        cursor++;
+    }
+    return *cursor >= '0' && *cursor <= '9';
+}
+
+/**
+ * Load a container from the text format written by ExportGuiContainerText(), adding its elements one at a time.
+ *
+ * Each line holds an element, as its type followed by its bounds and state:
+ *
+ *     b x y width height "text"                            A button
+ *     c x y width height checked "text"                    A check box, checked if checked isn't 0
+ *     t x y width height active "text"                     A toggle, active if active isn't 0
+ *     g x y width height active "items"                    A toggle group, with the given item active
+ *     o x y width height active "items"                    A combo box
+ *     d x y width height active "items"                    A dropdown box
+ *     s x y width height value min max "left" "right"      A slider
+ *     r x y width height value min max "left" "right"      A slider bar
+ *     p x y width height value min max "left" "right"      A progress bar
+ *     n x y width height value min max "text"              A spinner
+ *     v x y width height value min max "text"              A value box
+ *     k x y width height r g b a "text"                    A color picker
+ *
+ * A step can follow the max of a slider, slider bar, spinner or value box, which then snaps to it.
+ *
+ * Lines starting with # are comments, and lines that can't be read are skipped.
+ *
+ * @return The loaded container, which is empty if the file couldn't be read.
+ */
+GuiContainer LoadGuiContainerText(const char* fileName) {
+    GuiContainer container = InitGuiContainer();
+    FILE* file = fopen(fileName, "rb");
+    if (file == NULL) {
+        return container;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char* data = (char*)MemAlloc((unsigned int)(size > 0 ? size : 0) + 1);
+    size_t length = size > 0 ? fread(data, 1, (size_t)size, file) : 0;
+    data[length] = '\0';
+    fclose(file);
+
+    char* line = data;
+    while (*line != '\0') {
+        char* end = line;
+        while (*end != '\0' && *end != '\n') {
+            end++;
+        }
+        char* next = *end == '\0' ? end : end + 1;
+        *end = '\0';
+
+        // Find the element type with the line's letter.
+        char* cursor = SkipGuiTextSpaces(line);
+        int type = 0;
+        while (type < GUI_TYPE_COUNT && (*cursor == '\0' || GetGuiElementClass(type)->letter != *cursor)) {
+            type++;
+        }
+        cursor++;
+
+        // Read the numbers, then the strings.
+        float values[9] = { 0 };
+        int valueCount = 0;
+        while (type < GUI_TYPE_COUNT && valueCount < 9 && IsGuiTextNumber(cursor)) {
+            values[valueCount++] = strtof(cursor, &cursor);
+        }
+        const char* text[2] = { NULL, NULL };
+        int textCount = 0;
+        while (type < GUI_TYPE_COUNT && textCount < 2 && ReadGuiTextString(&cursor, text + textCount)) {
+            textCount++;
+        }
+
+        Rectangle bounds = { values[0], values[1], values[2], values[3] };
+        switch (type) {
+            case GUI_TYPE_BUTTON:
+                if (valueCount == 4 && textCount == 1) {
+                    AddGuiButton(&container, bounds, text[0]);
+                }
+                break;
+            case GUI_TYPE_CHECKBOX:
+                if (valueCount == 5 && textCount == 1) {
+                    AddCheckBox(&container, bounds, text[0], values[4] != 0);
+                }
+                break;
+            case GUI_TYPE_TOGGLE:
+                if (valueCount == 5 && textCount == 1) {
+                    AddGuiToggle(&container, bounds, text[0], values[4] != 0);
+                }
+                break;
+            case GUI_TYPE_TOGGLEGROUP:
+            case GUI_TYPE_COMBOBOX:
+            case GUI_TYPE_DROPDOWNBOX:
+                if (valueCount == 5 && textCount == 1) {
+                    AddGuiChoiceElement(&container, type, bounds, text[0], (int)values[4]);
+                }
+                break;
+            case GUI_TYPE_SLIDER:
+            case GUI_TYPE_SLIDERBAR:
+            case GUI_TYPE_PROGRESSBAR:
+                if ((valueCount == 7 || valueCount == 8) && textCount == 2) {
+                    AddGuiValueElement(&container, type, bounds, text[0], text[1], values[4], values[5], values[6], values[7]);
+                }
+                break;
+            case GUI_TYPE_SPINNER:
+            case GUI_TYPE_VALUEBOX:
+                if ((valueCount == 7 || valueCount == 8) && textCount == 1) {
+                    AddGuiValueElement(&container, type, bounds, text[0], NULL, (float)(int)values[4], (float)(int)values[5], (float)(int)values[6], valueCount == 8 ? values[7] : 1);
+                }
+                break;
+            case GUI_TYPE_COLORPICKER:
+                if (valueCount == 8 && textCount == 1) {
+                    Color color = { (unsigned char)values[4], (unsigned char)values[5], (unsigned char)values[6], (unsigned char)values[7] };
+                    AddGuiColorPicker(&container, bounds, text[0], color);
+                }
+                break;
+        }
+        line = next;
+    }
+
+    MemFree(data);
+    return container;
+}
+
+/**
+ * Write a string to a text container file, quoted and escaped, or - for no text.
+ */
+void WriteGuiTextString(FILE* file, const char* text) {
+    if (text == NULL) {
+        fputs(" -", file);
+        return;
+    }
+
+    fputs(" \"", file);
+    for (; *text != '\0'; text++) {
+        if (*text == '"' || *text == '\\') {
+            fputc('\\', file);
+            fputc(*text, file);
+        }
+        else if (*text == '\n') {
+            fputs("\\n", file);
+        }
+        else {
+            fputc(*text, file);
+        }
+    }
+    fputc('"', file);
+}
+
+/**
+ * Save a container in the text format read by LoadGuiContainerText(), for editing by hand or keeping under version
+ * control. Convert it to the binary format with ExportGuiContainer() to load it without building it.
+ *
+ * @return false if the file couldn't be written, or the container holds nested containers, list views or text boxes.
+ */
+bool ExportGuiContainerText(GuiContainer* container, const char* fileName) {
+    if (!IsGuiContainerSavable(container)) {
+        return false;
+    }
+    FILE* file = fopen(fileName, "w");
+    if (file == NULL) {
+        return false;
+    }
+
+    fprintf(file, "# raygui-container\n");
+    fprintf(file, "# b x y width height \"text\"\n");
+    fprintf(file, "# c|t x y width height checked \"text\"\n");
+    fprintf(file, "# g|o|d x y width height active \"items\"\n");
+    fprintf(file, "# s|r|p x y width height value min max [step] \"left\" \"right\"\n");
+    fprintf(file, "# n|v x y width height value min max [step] \"text\"\n");
+    fprintf(file, "# k x y width height r g b a \"text\"\n");
+    for (int i = 0; i < container->count; i++) {
+        Rectangle bounds = container->bounds[i];
+        GuiElementState* state = container->states + i;
+        fprintf(file, "%c %.9g %.9g %.9g %.9g", GetGuiElementClass(container->types[i])->letter, bounds.x, bounds.y, bounds.width, bounds.height);
+        switch (container->types[i]) {
+            case GUI_TYPE_CHECKBOX:
+            case GUI_TYPE_TOGGLE:
+                fprintf(file, " %d", state->checked ? 1 : 0);
+                break;
+            case GUI_TYPE_TOGGLEGROUP:
+            case GUI_TYPE_COMBOBOX:
+            case GUI_TYPE_DROPDOWNBOX:
+                fprintf(file, " %d", state->choice.active);
+                break;
+            case GUI_TYPE_SLIDER:
+            case GUI_TYPE_SLIDERBAR:
+            case GUI_TYPE_PROGRESSBAR:
+            case GUI_TYPE_SPINNER:
+            case GUI_TYPE_VALUEBOX:
+                fprintf(file, " %.9g %.9g %.9g", state->value.value, state->value.min, state->value.max);
+                if (state->value.step > 0) {
+                    fprintf(file, " %.9g", state->value.step);
+                }
+                break;
+            case GUI_TYPE_COLORPICKER:
+                fprintf(file, " %d %d %d %d", state->color.color.r, state->color.color.g, state->color.color.b, state->color.color.a);
+                break;
+        }
+        WriteGuiTextString(file, state->text);
+        const char** textRight = GetGuiElementTextRight(container, i);
+        if (textRight != NULL && container->types[i] != GUI_TYPE_SPINNER && container->types[i] != GUI_TYPE_VALUEBOX) {
+            WriteGuiTextString(file, *textRight);
+        }
+        fputc('\n', file);
+    }
+
+    return fclose(file) == 0;
+}
+
+#if defined(RAYGUI_CONTAINER_PROFILE)
+/**
+ * Get what the container, and the containers nested in it, did since the counters were last reset. A nested
+ * container gives the counters of its root container.
+ */
+GuiProfileCounters GetGuiContainerCounters(GuiContainer* container) {
+    return GetGuiProfile(container)->counters;
 }
 
+/**
+ * Reset the container's counters, and forget the phases it timed.
+ */
+void ResetGuiContainerCounters(GuiContainer* container) {
+    GuiProfile* profile = GetGuiProfile(container);
+    memset(&profile->counters, 0, sizeof(GuiProfileCounters));
+    profile->eventCount = 0;
+}
+
+/**
+ * Save the last RAYGUI_CONTAINER_PROFILE_EVENTS phases the container timed in the Chrome trace event format, which
+ * chrome://tracing and Perfetto open. The counters are saved along with them.
+ *
+ * @return False if the file couldn't be written.
+ */
+bool ExportGuiContainerTrace(GuiContainer* container, const char* fileName) {
+    static const char* phaseNames[GUI_PHASE_COUNT] = {
+        "UpdateGuiContainer", "ApplyGuiContainerLayout", "PollGuiContainerInput", "ProcessGuiContainerActions",
+        "FindGuiElementAtScreenPoint", "FindGuiElementFromBounds", "DrawGuiContainer", "FindGuiElementsInArea",
+        "AnimateGuiContainer"
+    };
+
+    GuiProfile* profile = GetGuiProfile(container);
+    FILE* file = fopen(fileName, "w");
+    if (file == NULL) {
+        return false;
+    }
+
+    // The oldest phases were overwritten once the ring buffer filled up.
+    long long first = profile->eventCount > RAYGUI_CONTAINER_PROFILE_EVENTS ? profile->eventCount - RAYGUI_CONTAINER_PROFILE_EVENTS : 0;
+    fprintf(file, "{\"traceEvents\":[");
+    for (long long i = first; i < profile->eventCount; i++) {
+        GuiProfileEvent* event = profile->events + i % RAYGUI_CONTAINER_PROFILE_EVENTS;
+        fprintf(file, "%s\n{\"name\":\"%s\",\"cat\":\"raygui-container\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,"
+            "\"pid\":1,\"tid\":1,\"args\":{\"count\":%d}}", i > first ? "," : "", phaseNames[event->phase],
+            event->start * 1e6, event->duration * 1e6, event->count);
+    }
+
+    GuiProfileCounters* counters = &profile->counters;
+    fprintf(file, "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{");
+    fprintf(file, "\"updates\":%d,\"draws\":%d,\"actions\":%lld,\"layoutNodes\":%lld,\"elementsHitTested\":%lld,",
+        counters->updates, counters->draws, counters->actions, counters->layoutNodes, counters->elementsHitTested);
+    fprintf(file, "\"navigationQueries\":%lld,\"navigationSearches\":%lld,\"elementsVisible\":%lld,",
+        counters->navigationQueries, counters->navigationSearches, counters->elementsVisible);
+    fprintf(file, "\"elementsDrawn\":%lld,\"commandsReplayed\":%lld}}\n", counters->elementsDrawn, counters->commandsReplayed);
+    return fclose(file) == 0;
+}
+#endif
+
 #if defined(__cplusplus)
 }            // Prevents name mangling of functions
 #endif
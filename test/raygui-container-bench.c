@@ -0,0 +1,575 @@
+/**
+ * raygui-container-bench
+ *
+ * Headless benchmarks for raygui-container. Each benchmark is run with 100, 1k, 10k and 100k elements, and reports
+ * the time and allocations per operation.
+ *
+ * Usage:
+ *   raygui-container-bench [--json <file>] [--max-elements <count>]
+ *
+ * The JSON results can be diffed between releases.
+ */
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L     // Required for: clock_gettime()
+#endif
+
+#include <time.h>
+
+#include "raygui-container-headless.h"
+
+#define BENCH_MAX_RESULTS 128
+
+typedef struct BenchResult {
+    const char* name;
+    int elements;
+    long operations;
+    double nsPerOp;
+    double allocationsPerOp;
+    double bytesPerOp;
+} BenchResult;
+
+static BenchResult benchResults[BENCH_MAX_RESULTS];
+static int benchResultCount = 0;
+
+// Deterministic random numbers, so every run uses the same layout and input script.
+static unsigned int benchSeed = 1;
+
+static int BenchRandom(int max) {
+    benchSeed ^= benchSeed << 13;
+    benchSeed ^= benchSeed >> 17;
+    benchSeed ^= benchSeed << 5;
+    return (int)(benchSeed % (unsigned int)max);
+}
+
+static double GetBenchTime(void) {
+    struct timespec time;
+#if defined(_WIN32)
+    timespec_get(&time, TIME_UTC);
+#else
+    clock_gettime(CLOCK_MONOTONIC, &time);
+#endif
+    return (double)time.tv_sec * 1e9 + (double)time.tv_nsec;
+}
+
+/**
+ * Start measuring a benchmark, resetting the allocation counters.
+ */
+static double BeginBench(void) {
+    ResetHeadlessCounters();
+    return GetBenchTime();
+}
+
+/**
+ * Stop measuring a benchmark, and record its result.
+ */
+static void EndBench(double start, const char* name, int elements, long operations) {
+    double elapsed = GetBenchTime() - start;
+    BenchResult* result = benchResults + benchResultCount++;
+    result->name = name;
+    result->elements = elements;
+    result->operations = operations;
+    result->nsPerOp = elapsed / (double)operations;
+    result->allocationsPerOp = (double)headless.allocations / (double)operations;
+    result->bytesPerOp = (double)headless.allocatedBytes / (double)operations;
+    printf("%-36s %8d %12.1f ns/op %10.4f allocs/op %12.1f B/op\n", name, elements, result->nsPerOp, result->allocationsPerOp, result->bytesPerOp);
+}
+
+/**
+ * Get the bounds of the given element in a grid layout, roughly square, with gaps between the elements.
+ */
+static Rectangle GetBenchBounds(int index, int elements) {
+    int columns = 1;
+    while (columns * columns < elements) {
+        columns++;
+    }
+    return (Rectangle){ (float)(index % columns) * 130, (float)(index / columns) * 40, 120, 30 };
+}
+
+/**
+ * Fill a container with a grid of buttons, with some check boxes and sliders mixed in.
+ */
+static GuiElement AddBenchElement(GuiContainer* container, int index, int elements) {
+    Rectangle bounds = GetBenchBounds(index, elements);
+    if (index % 11 == 10) {
+        return AddSlider(container, bounds, "Less", "More", 50, 0, 100);
+    }
+    if (index % 7 == 6) {
+        return AddCheckBox(container, bounds, "CheckBox", false);
+    }
+    return AddGuiButton(container, bounds, "Button");
+}
+
+static GuiContainer CreateBenchContainer(int elements) {
+    GuiContainer container = InitGuiContainer();
+    for (int i = 0; i < elements; i++) {
+        AddBenchElement(&container, i, elements);
+    }
+    return container;
+}
+
+/**
+ * The number of repetitions for an operation that visits every element, so each benchmark takes a similar time.
+ */
+static int GetBenchIterations(int elements) {
+    int iterations = 2000000 / elements;
+    return iterations < 5 ? 5 : iterations;
+}
+
+static void BenchAddElement(int elements) {
+    int rounds = GetBenchIterations(elements) / 100 + 1;
+    double start = BeginBench();
+    for (int round = 0; round < rounds; round++) {
+        GuiContainer container = InitGuiContainer();
+        for (int i = 0; i < elements; i++) {
+            AddBenchElement(&container, i, elements);
+        }
+        UnloadGuiContainer(container);
+    }
+    EndBench(start, "AddElement", elements, (long)rounds * elements);
+}
+
+static void BenchRemoveGuiElement(int elements) {
+    GuiContainer container = InitGuiContainer();
+    GuiElement* handles = (GuiElement*)malloc(elements * sizeof(GuiElement));
+    for (int i = 0; i < elements; i++) {
+        handles[i] = AddBenchElement(&container, i, elements);
+    }
+
+    // Remove in a random order.
+    for (int i = elements - 1; i > 0; i--) {
+        int j = BenchRandom(i + 1);
+        GuiElement swap = handles[i];
+        handles[i] = handles[j];
+        handles[j] = swap;
+    }
+
+    double start = BeginBench();
+    for (int i = 0; i < elements; i++) {
+        RemoveGuiElement(&container, handles[i]);
+    }
+    EndBench(start, "RemoveGuiElement", elements, elements);
+
+    free(handles);
+    UnloadGuiContainer(container);
+}
+
+static void BenchUpdateIdle(int elements) {
+    GuiContainer container = CreateBenchContainer(elements);
+    int iterations = GetBenchIterations(elements) * 10;
+
+    double start = BeginBench();
+    for (int i = 0; i < iterations; i++) {
+        BeginHeadlessFrame();
+        UpdateGuiContainer(&container);
+    }
+    EndBench(start, "UpdateGuiContainer/idle", elements, iterations);
+
+    UnloadGuiContainer(container);
+}
+
+static void BenchUpdateHover(int elements) {
+    GuiContainer container = CreateBenchContainer(elements);
+    int iterations = GetBenchIterations(elements);
+
+    // Move the mouse over random points of the layout, some of which miss every element.
+    Rectangle last = GetBenchBounds(elements - 1, elements);
+    Vector2* script = (Vector2*)malloc(iterations * sizeof(Vector2));
+    for (int i = 0; i < iterations; i++) {
+        script[i] = (Vector2){ (float)BenchRandom((int)(last.x + last.width) + 1), (float)BenchRandom((int)(last.y + last.height) + 1) };
+    }
+
+    double start = BeginBench();
+    for (int i = 0; i < iterations; i++) {
+        BeginHeadlessFrame();
+        SetHeadlessMousePosition(script[i]);
+        UpdateGuiContainer(&container);
+    }
+    EndBench(start, "UpdateGuiContainer/hover", elements, iterations);
+
+    free(script);
+    UnloadGuiContainer(container);
+}
+
+static void BenchUpdateNavigate(int elements) {
+    GuiContainer container = CreateBenchContainer(elements);
+    int iterations = GetBenchIterations(elements) * 10;
+
+    // Press random arrow keys. Sliders lock focus when entered, which never happens here.
+    int keys[] = { KEY_UP, KEY_RIGHT, KEY_DOWN, KEY_LEFT };
+    int* script = (int*)malloc(iterations * sizeof(int));
+    for (int i = 0; i < iterations; i++) {
+        script[i] = keys[BenchRandom(4)];
+    }
+
+    double start = BeginBench();
+    for (int i = 0; i < iterations; i++) {
+        BeginHeadlessFrame();
+        SetHeadlessKeyPressed(script[i]);
+        UpdateGuiContainer(&container);
+    }
+    EndBench(start, "UpdateGuiContainer/navigate", elements, iterations);
+
+    free(script);
+    UnloadGuiContainer(container);
+}
+
+static void BenchSetNextActiveGuiElement(int elements) {
+    GuiContainer container = CreateBenchContainer(elements);
+    int iterations = GetBenchIterations(elements) * 10;
+
+    double start = BeginBench();
+    for (int i = 0; i < iterations; i++) {
+        container.activeElement = BenchRandom(container.count);
+        SetNextActiveGuiElement(&container, BenchRandom(4));
+    }
+    EndBench(start, "SetNextActiveGuiElement", elements, iterations);
+
+    UnloadGuiContainer(container);
+}
+
+static void BenchDrawGuiContainer(int elements) {
+    GuiContainer container = CreateBenchContainer(elements);
+    int iterations = GetBenchIterations(elements) / 10 + 1;
+
+    double start = BeginBench();
+    for (int i = 0; i < iterations; i++) {
+        BeginHeadlessFrame();
+        DrawGuiContainer(container);
+    }
+    EndBench(start, "DrawGuiContainer", elements, iterations);
+
+    UnloadGuiContainer(container);
+}
+
+static void BenchDrawGuiContainerRetained(int elements) {
+    GuiContainer container = CreateBenchContainer(elements);
+    EnableGuiContainerDrawCache(&container);
+    int iterations = GetBenchIterations(elements) / 10 + 1;
+
+    // Keep the mouse away from the elements. Fill both of the cache's lists before measuring.
+    BeginHeadlessFrame();
+    SetHeadlessMousePosition((Vector2){ -100, -100 });
+    DrawGuiContainer(container);
+    DrawGuiContainer(container);
+
+    double start = BeginBench();
+    for (int i = 0; i < iterations; i++) {
+        BeginHeadlessFrame();
+        DrawGuiContainer(container);
+    }
+    EndBench(start, "DrawGuiContainer/retained", elements, iterations);
+
+    UnloadGuiContainer(container);
+}
+
+static void BenchDrawScrollPanel(int elements) {
+    // A settings screen: every element is a row of a single scroll panel, of which about seven are in view.
+    GuiContainer container = InitGuiContainer();
+    GuiContainer* panel = AddGuiScrollPanel(&container, (Rectangle){ 20, 20, 400, 300 }, "Settings", (Rectangle){ 0, 0, 380, (float)elements * 40 });
+    for (int i = 0; i < elements; i++) {
+        AddBenchElement(panel, i, 1);
+    }
+    SetGuiContainerScroll(panel, (Vector2){ 0, -(float)elements * 20 });
+    int iterations = GetBenchIterations(elements) / 10 + 1;
+
+    double start = BeginBench();
+    for (int i = 0; i < iterations; i++) {
+        BeginHeadlessFrame();
+        DrawGuiContainer(container);
+    }
+    EndBench(start, "DrawGuiContainer/scroll-panel", elements, iterations);
+
+    UnloadGuiContainer(container);
+}
+
+#define BENCH_MAX_TWEENS 500
+
+/**
+ * Fade every element of a spread of up to BENCH_MAX_TWEENS, in or out, over a second.
+ */
+static void FadeBenchElements(GuiContainer* container, int elements, float alpha) {
+    int tweens = elements < BENCH_MAX_TWEENS ? elements : BENCH_MAX_TWEENS;
+    for (int i = 0; i < tweens; i++) {
+        FadeGuiElement(container, GetGuiElementAt(container, i * (elements / tweens)), alpha, 1.0f);
+    }
+}
+
+static void BenchAnimation(int elements) {
+    // Hundreds of elements fade in and out at once, restarted every half a second, while focus moves and slides the
+    // focus highlight along with it.
+    GuiContainer container = CreateBenchContainer(elements);
+    EnableGuiContainerAnimation(&container);
+    int keys[] = { KEY_UP, KEY_RIGHT, KEY_DOWN, KEY_LEFT };
+    int iterations = GetBenchIterations(elements) * 10;
+
+    double start = BeginBench();
+    for (int i = 0; i < iterations; i++) {
+        if (i % 30 == 0) {
+            FadeBenchElements(&container, elements, (i / 30) % 2 == 0 ? 0.25f : 1.0f);
+        }
+        BeginHeadlessFrame();
+        if (i % 10 == 0) {
+            SetHeadlessKeyPressed(keys[BenchRandom(4)]);
+        }
+        UpdateGuiContainer(&container);
+    }
+    EndBench(start, "UpdateGuiContainer/tweens", elements, iterations);
+
+    // A whole frame, drawing the faded elements and the focus highlight.
+    iterations = GetBenchIterations(elements) / 10 + 1;
+    start = BeginBench();
+    for (int i = 0; i < iterations; i++) {
+        if (i % 30 == 0) {
+            FadeBenchElements(&container, elements, (i / 30) % 2 == 0 ? 1.0f : 0.25f);
+        }
+        BeginHeadlessFrame();
+        if (i % 10 == 0) {
+            SetHeadlessKeyPressed(keys[BenchRandom(4)]);
+        }
+        UpdateGuiContainer(&container);
+        DrawGuiContainer(container);
+    }
+    EndBench(start, "Frame/tweens", elements, iterations);
+
+    UnloadGuiContainer(container);
+}
+
+#if defined(RAYGUI_CONTAINER_TEST_THREADS)
+#include <pthread.h>
+
+#define BENCH_THREAD_CONTAINERS 8
+
+typedef struct BenchUpdateJob {
+    GuiContainer* containers;
+    int start;
+    int end;
+    int iterations;
+    const int* script;
+} BenchUpdateJob;
+
+static void* BenchUpdateContainers(void* data) {
+    BenchUpdateJob* job = (BenchUpdateJob*)data;
+    for (int i = 0; i < job->iterations; i++) {
+        for (int container = job->start; container < job->end; container++) {
+            PushGuiContainerAction(job->containers + container, (GuiAction){ GUI_ACTION_NAVIGATE, job->script[(i + container) % job->iterations], (Vector2){ 0, 0 }, 0 });
+            UpdateGuiContainer(job->containers + container);
+        }
+    }
+    return NULL;
+}
+
+static void BenchUpdateThreads(int elements, int threadCount, const char* name) {
+    // Split-screen: the elements are spread over a container per player, each navigated with its own input.
+    GuiContainer containers[BENCH_THREAD_CONTAINERS];
+    for (int i = 0; i < BENCH_THREAD_CONTAINERS; i++) {
+        containers[i] = CreateBenchContainer(elements / BENCH_THREAD_CONTAINERS);
+    }
+    int iterations = GetBenchIterations(elements) * 10 / BENCH_THREAD_CONTAINERS + 1;
+    int* script = (int*)malloc(iterations * sizeof(int));
+    for (int i = 0; i < iterations; i++) {
+        script[i] = BenchRandom(4);
+    }
+
+    pthread_t threads[BENCH_THREAD_CONTAINERS];
+    BenchUpdateJob jobs[BENCH_THREAD_CONTAINERS];
+    double start = BeginBench();
+    for (int thread = 0; thread < threadCount; thread++) {
+        jobs[thread] = (BenchUpdateJob){ containers, thread * BENCH_THREAD_CONTAINERS / threadCount, (thread + 1) * BENCH_THREAD_CONTAINERS / threadCount, iterations, script };
+        pthread_create(&threads[thread], NULL, BenchUpdateContainers, &jobs[thread]);
+    }
+    for (int thread = 0; thread < threadCount; thread++) {
+        pthread_join(threads[thread], NULL);
+    }
+    EndBench(start, name, elements, iterations);
+
+    free(script);
+    for (int i = 0; i < BENCH_THREAD_CONTAINERS; i++) {
+        UnloadGuiContainer(containers[i]);
+    }
+}
+#endif
+
+static int GetBenchRowCount(void* userData) {
+    return *(int*)userData;
+}
+
+static const char* GetBenchRowText(int row, void* userData) {
+    (void)row;
+    (void)userData;
+    return "Row";
+}
+
+static void BenchDrawListView(int elements) {
+    // A leaderboard: a single list view with a row per element, scrolled to the middle.
+    GuiContainer container = InitGuiContainer();
+    GuiElement list = AddGuiListView(&container, (Rectangle){ 20, 20, 400, 300 }, GetBenchRowCount, GetBenchRowText, &elements);
+    SetGuiListViewActive(&container, list, elements / 2);
+    int iterations = GetBenchIterations(elements) / 10 + 1;
+
+    double start = BeginBench();
+    for (int i = 0; i < iterations; i++) {
+        BeginHeadlessFrame();
+        DrawGuiContainer(container);
+    }
+    EndBench(start, "DrawGuiContainer/list-view", elements, iterations);
+
+    UnloadGuiContainer(container);
+}
+
+/**
+ * Lay the elements out in rows of ten, sharing each row's width by weight, in a vertical layout.
+ */
+static GuiContainer CreateBenchLayout(int elements, GuiElement* handles) {
+    GuiContainer container = InitGuiContainer();
+    GuiLayout root = SetGuiContainerLayout(&container, GUI_LAYOUT_VERTICAL, (Rectangle){ 0, 0, 1280, 720 });
+    SetGuiLayoutSpacing(&container, root, 10, 5);
+    GuiLayout row = { -1 };
+    for (int i = 0; i < elements; i++) {
+        if (i % 10 == 0) {
+            row = AddGuiLayout(&container, root, GUI_LAYOUT_HORIZONTAL, (GuiLayoutSize){ .min = 30 });
+            SetGuiLayoutSpacing(&container, row, 0, 5);
+        }
+        handles[i] = AddBenchElement(&container, i, elements);
+        AddGuiLayoutElement(&container, row, handles[i], (GuiLayoutSize){ .min = 40, .weight = (float)(1 + i % 3) });
+    }
+    ApplyGuiContainerLayout(&container);
+    return container;
+}
+
+static void BenchLayoutResize(int elements) {
+    GuiElement* handles = (GuiElement*)malloc(elements * sizeof(GuiElement));
+    GuiContainer container = CreateBenchLayout(elements, handles);
+    int iterations = GetBenchIterations(elements) / 10 + 1;
+
+    // Every element moves, as the window is resized each frame.
+    double start = BeginBench();
+    for (int i = 0; i < iterations; i++) {
+        SetGuiContainerLayoutBounds(&container, (Rectangle){ 0, 0, (float)(1280 + (i % 2)), 720 });
+        ApplyGuiContainerLayout(&container);
+    }
+    EndBench(start, "ApplyGuiContainerLayout/resize", elements, iterations);
+
+    UnloadGuiContainer(container);
+    free(handles);
+}
+
+static void BenchLayoutChange(int elements) {
+    GuiElement* handles = (GuiElement*)malloc(elements * sizeof(GuiElement));
+    GuiContainer container = CreateBenchLayout(elements, handles);
+    int iterations = GetBenchIterations(elements) * 10;
+
+    // A single element changes size each frame, so only its row is laid out again.
+    double start = BeginBench();
+    for (int i = 0; i < iterations; i++) {
+        SetGuiElementLayoutSize(&container, handles[BenchRandom(elements)], (GuiLayoutSize){ .min = (float)(40 + (i % 2)), .weight = 1 });
+        ApplyGuiContainerLayout(&container);
+    }
+    EndBench(start, "ApplyGuiContainerLayout/one-element", elements, iterations);
+
+    UnloadGuiContainer(container);
+    free(handles);
+}
+
+/**
+ * Switch to a screen, built element by element, and loaded from a file saved with ExportGuiContainer().
+ */
+static void BenchLoadScreen(int elements) {
+    int rounds = GetBenchIterations(elements) / 20 + 1;
+    double start = BeginBench();
+    for (int round = 0; round < rounds; round++) {
+        GuiContainer container = CreateBenchContainer(elements);
+        UnloadGuiContainer(container);
+    }
+    EndBench(start, "LoadScreen/procedural", elements, rounds);
+
+    GuiContainer container = CreateBenchContainer(elements);
+    ExportGuiContainer(&container, "raygui-container-bench.rgc");
+    UnloadGuiContainer(container);
+    start = BeginBench();
+    for (int round = 0; round < rounds; round++) {
+        GuiContainer loaded = LoadGuiContainer("raygui-container-bench.rgc");
+        UnloadGuiContainer(loaded);
+    }
+    EndBench(start, "LoadScreen/mapped", elements, rounds);
+    remove("raygui-container-bench.rgc");
+}
+
+static const char* GetBenchSimd(void) {
+#if defined(RAYGUI_CONTAINER_AVX2)
+    return "avx2";
+#elif defined(RAYGUI_CONTAINER_SSE2)
+    return "sse2";
+#elif defined(RAYGUI_CONTAINER_NEON)
+    return "neon";
+#else
+    return "none";
+#endif
+}
+
+static bool SaveBenchJson(const char* fileName) {
+    FILE* file = fopen(fileName, "w");
+    if (file == NULL) {
+        printf("Failed to open %s\n", fileName);
+        return false;
+    }
+
+    fprintf(file, "{\n");
+    fprintf(file, "  \"simd\": \"%s\",\n", GetBenchSimd());
+    fprintf(file, "  \"results\": [\n");
+    for (int i = 0; i < benchResultCount; i++) {
+        BenchResult* result = benchResults + i;
+        fprintf(file, "    { \"name\": \"%s\", \"elements\": %d, \"operations\": %ld, \"ns_per_op\": %.2f, \"allocations_per_op\": %.4f, \"bytes_per_op\": %.2f }%s\n",
+            result->name, result->elements, result->operations, result->nsPerOp, result->allocationsPerOp, result->bytesPerOp,
+            i < benchResultCount - 1 ? "," : "");
+    }
+    fprintf(file, "  ]\n");
+    fprintf(file, "}\n");
+    fclose(file);
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    const char* jsonFile = NULL;
+    int maxElements = 100000;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            jsonFile = argv[++i];
+        }
+        else if (strcmp(argv[i], "--max-elements") == 0 && i + 1 < argc) {
+            maxElements = atoi(argv[++i]);
+        }
+        else {
+            printf("Usage: %s [--json <file>] [--max-elements <count>]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    printf("raygui-container-bench (simd: %s)\n", GetBenchSimd());
+    for (int elements = 100; elements <= maxElements; elements *= 10) {
+        BenchAddElement(elements);
+        BenchRemoveGuiElement(elements);
+        BenchUpdateIdle(elements);
+        BenchUpdateHover(elements);
+        BenchUpdateNavigate(elements);
+        BenchSetNextActiveGuiElement(elements);
+        BenchLayoutResize(elements);
+        BenchLayoutChange(elements);
+        BenchLoadScreen(elements);
+#if defined(RAYGUI_CONTAINER_TEST_THREADS)
+        BenchUpdateThreads(elements, 1, "UpdateGuiContainer/8-players-1-thread");
+        BenchUpdateThreads(elements, 4, "UpdateGuiContainer/8-players-4-threads");
+#endif
+        BenchDrawGuiContainer(elements);
+        BenchDrawGuiContainerRetained(elements);
+        BenchDrawScrollPanel(elements);
+        BenchDrawListView(elements);
+        BenchAnimation(elements);
+    }
+
+    if (jsonFile != NULL && !SaveBenchJson(jsonFile)) {
+        return 1;
+    }
+
+    return 0;
+}
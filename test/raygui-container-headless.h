@@ -0,0 +1,377 @@
+/**
+ * raygui-container-headless
+ *
+ * Compiles raygui in RAYGUI_STANDALONE mode, along with raygui-container, against a stubbed input and drawing
+ * backend. Input is scripted through the SetHeadless*() functions, and the backend counts allocations and draw calls,
+ * so the container can be tested and benchmarked without a window. The draw calls are also hashed, so the output of
+ * two frames can be compared.
+ *
+ * Include this from a single source file, instead of raylib.h, raygui.h and raygui-container.h.
+ */
+
+#ifndef RAYGUI_CONTAINER_HEADLESS_H_
+#define RAYGUI_CONTAINER_HEADLESS_H_
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#define RAYGUI_STANDALONE
+
+// raygui 3.2 uses a few raylib definitions even in standalone mode.
+typedef struct Image {
+    void *data;
+    int width;
+    int height;
+    int mipmaps;
+    int format;
+} Image;
+#define BLANK (Color){ 0, 0, 0, 0 }
+#define KEY_LEFT_CONTROL 341
+#define KEY_RIGHT_SHIFT 344
+
+// GuiTextBoxMulti() reads raylib's Font.glyphs, which raygui's standalone Font names chars.
+#define glyphs chars
+
+#include "raygui.h"
+
+// raylib functions raygui calls without declaring them in standalone mode.
+static int GetGlyphIndex(Font font, int codepoint);
+static void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint);
+static void UnloadTexture(Texture2D texture);
+
+#define RAYGUI_IMPLEMENTATION
+#include "raygui.h"
+
+// Declare the retained drawing hooks and the text measurement hook, which the functions below call.
+#define RAYGUI_CONTAINER_RETAINED
+#define RAYGUI_CONTAINER_TEXT_CACHE
+#include "raygui-container.h"
+
+// raylib definitions used by raygui-container.
+#define KEY_TAB 258
+#define KEY_SPACE 32
+#define KEY_S 83
+#define KEY_LEFT_SHIFT 340
+#define MOUSE_BUTTON_LEFT 0
+#define GAMEPAD_BUTTON_LEFT_FACE_UP 1
+#define GAMEPAD_BUTTON_LEFT_FACE_RIGHT 2
+#define GAMEPAD_BUTTON_LEFT_FACE_DOWN 3
+#define GAMEPAD_BUTTON_LEFT_FACE_LEFT 4
+#define GAMEPAD_BUTTON_RIGHT_FACE_DOWN 7
+#define GAMEPAD_BUTTON_LEFT_TRIGGER_1 9
+#define GAMEPAD_BUTTON_LEFT_TRIGGER_2 10
+#define GAMEPAD_BUTTON_RIGHT_TRIGGER_1 11
+#define GAMEPAD_BUTTON_RIGHT_TRIGGER_2 12
+#define GAMEPAD_AXIS_LEFT_X 0
+#define GAMEPAD_AXIS_LEFT_Y 1
+#define GAMEPAD_AXIS_RIGHT_X 2
+#define GAMEPAD_AXIS_RIGHT_Y 3
+
+#define HEADLESS_MAX_KEYS 512
+#define HEADLESS_MAX_GAMEPADS 4
+#define HEADLESS_MAX_GAMEPAD_BUTTONS 32
+#define HEADLESS_MAX_GAMEPAD_AXES 8
+#define HEADLESS_MAX_MOUSE_BUTTONS 8
+#define HEADLESS_MAX_CHARS 32
+
+/**
+ * The input for the current frame, and counters for what the backend was asked to do.
+ */
+typedef struct HeadlessState {
+    bool keysPressed[HEADLESS_MAX_KEYS];
+    bool keysDown[HEADLESS_MAX_KEYS];
+    bool gamepadsAvailable[HEADLESS_MAX_GAMEPADS];
+    bool gamepadButtonsPressed[HEADLESS_MAX_GAMEPADS][HEADLESS_MAX_GAMEPAD_BUTTONS];
+    bool gamepadButtonsDown[HEADLESS_MAX_GAMEPADS][HEADLESS_MAX_GAMEPAD_BUTTONS];
+    float gamepadAxes[HEADLESS_MAX_GAMEPADS][HEADLESS_MAX_GAMEPAD_AXES];
+    bool mouseButtonsDown[HEADLESS_MAX_MOUSE_BUTTONS];
+    bool mouseButtonsPressed[HEADLESS_MAX_MOUSE_BUTTONS];
+    bool mouseButtonsReleased[HEADLESS_MAX_MOUSE_BUTTONS];
+    Vector2 mousePosition;
+    Vector2 mouseDelta;
+    float mouseWheel;
+    float frameTime;            // The seconds the last frame took, which is 1/60 unless set
+    int chars[HEADLESS_MAX_CHARS];  // The codepoints typed this frame, read in order by GetCharPressed()
+    int charCount;
+    int charsRead;
+
+    long allocations;
+    long allocatedBytes;
+    long liveBlocks;
+    long rectanglesDrawn;
+    long textsDrawn;
+    long textsMeasured;
+    long glyphLookups;          // The glyph table entries compared while measuring text
+    bool hashDraws;             // Whether to hash the draw calls, which is off for benchmarks
+    unsigned int drawHash;
+} HeadlessState;
+
+static HeadlessState headless = { .frameTime = 1.0f / 60.0f };
+
+/**
+ * Clear the input that only lasts a single frame: presses, releases, mouse movement and the mouse wheel.
+ */
+static inline void BeginHeadlessFrame(void) {
+    memset(headless.keysPressed, 0, sizeof(headless.keysPressed));
+    memset(headless.gamepadButtonsPressed, 0, sizeof(headless.gamepadButtonsPressed));
+    memset(headless.mouseButtonsPressed, 0, sizeof(headless.mouseButtonsPressed));
+    memset(headless.mouseButtonsReleased, 0, sizeof(headless.mouseButtonsReleased));
+    headless.mouseDelta = (Vector2){ 0, 0 };
+    headless.mouseWheel = 0;
+    headless.charCount = 0;
+    headless.charsRead = 0;
+}
+
+static inline void SetHeadlessKeyPressed(int key) {
+    headless.keysPressed[key] = true;
+}
+
+/**
+ * Hold a key down, or release it. A key that wasn't down is pressed as well.
+ */
+static inline void SetHeadlessKeyDown(int key, bool down) {
+    headless.keysPressed[key] = down && !headless.keysDown[key];
+    headless.keysDown[key] = down;
+}
+
+/**
+ * Type the given text, as UTF-8, which GetCharPressed() returns a codepoint at a time.
+ */
+static inline void SetHeadlessCharPressed(const char *text) {
+    while (*text != '\0' && headless.charCount < HEADLESS_MAX_CHARS) {
+        const unsigned char *bytes = (const unsigned char *)text;
+        int length = bytes[0] < 0x80 ? 1 : bytes[0] < 0xe0 ? 2 : bytes[0] < 0xf0 ? 3 : 4;
+        int codepoint = length == 1 ? bytes[0] : bytes[0] & (0x7f >> length);
+        for (int i = 1; i < length; i++) {
+            codepoint = (codepoint << 6) | (bytes[i] & 0x3f);
+        }
+        headless.chars[headless.charCount++] = codepoint;
+        text += length;
+    }
+}
+
+static inline void SetHeadlessFrameTime(float seconds) {
+    headless.frameTime = seconds;
+}
+
+/**
+ * Press a button on the given gamepad, which stays connected from then on.
+ */
+static inline void SetHeadlessGamepadButtonPressed(int gamepad, int button) {
+    headless.gamepadsAvailable[gamepad] = true;
+    headless.gamepadButtonsPressed[gamepad][button] = true;
+}
+
+/**
+ * Hold a button down on the given gamepad, or release it. A button that wasn't down is pressed as well.
+ */
+static inline void SetHeadlessGamepadButtonDown(int gamepad, int button, bool down) {
+    headless.gamepadsAvailable[gamepad] = true;
+    headless.gamepadButtonsPressed[gamepad][button] = down && !headless.gamepadButtonsDown[gamepad][button];
+    headless.gamepadButtonsDown[gamepad][button] = down;
+}
+
+/**
+ * Move an axis on the given gamepad, which stays where it's put until it's moved again.
+ */
+static inline void SetHeadlessGamepadAxis(int gamepad, int axis, float value) {
+    headless.gamepadsAvailable[gamepad] = true;
+    headless.gamepadAxes[gamepad][axis] = value;
+}
+
+static inline void SetHeadlessMouseWheel(float move) {
+    headless.mouseWheel = move;
+}
+
+static inline void SetHeadlessMousePosition(Vector2 position) {
+    headless.mouseDelta = (Vector2){ position.x - headless.mousePosition.x, position.y - headless.mousePosition.y };
+    headless.mousePosition = position;
+}
+
+static inline void SetHeadlessMouseButtonDown(int button) {
+    headless.mouseButtonsPressed[button] = !headless.mouseButtonsDown[button];
+    headless.mouseButtonsDown[button] = true;
+}
+
+static inline void SetHeadlessMouseButtonReleased(int button) {
+    headless.mouseButtonsDown[button] = false;
+    headless.mouseButtonsReleased[button] = true;
+}
+
+/**
+ * Put the mouse where a replayed frame had it, so raygui draws what it drew while the frame was recorded.
+ */
+static inline void SetHeadlessInputFrame(const GuiInputFrame *frame) {
+    headless.mousePosition = frame->mousePosition;
+    headless.mouseDelta = frame->mouseDelta;
+    headless.mouseWheel = frame->mouseWheel;
+    for (int button = 0; button < 3; button++) {
+        headless.mouseButtonsDown[button] = (frame->mouseButtons & (1u << button)) != 0;
+        headless.mouseButtonsPressed[button] = (frame->mouseButtons & (1u << (button + 3))) != 0;
+        headless.mouseButtonsReleased[button] = (frame->mouseButtons & (1u << (button + 6))) != 0;
+    }
+}
+
+static inline void ResetHeadlessCounters(void) {
+    headless.allocations = 0;
+    headless.allocatedBytes = 0;
+    headless.rectanglesDrawn = 0;
+    headless.textsDrawn = 0;
+    headless.textsMeasured = 0;
+    headless.drawHash = 2166136261u;
+}
+
+/**
+ * Add the given bytes to the FNV-1a hash of everything drawn since ResetHeadlessCounters(), and to the draw hash of a
+ * container being recorded or replayed.
+ */
+static void HashHeadlessDraw(const void *data, int size) {
+    if (!headless.hashDraws) {
+        return;
+    }
+
+    HashGuiDraw(data, size);
+    const unsigned char *bytes = (const unsigned char *)data;
+    for (int i = 0; i < size; i++) {
+        headless.drawHash = (headless.drawHash ^ bytes[i]) * 16777619u;
+    }
+}
+
+// Memory
+//-------------------------------------------------------------------------------
+static void *MemAlloc(unsigned int size) {
+    headless.allocations++;
+    headless.allocatedBytes += size;
+    headless.liveBlocks++;
+    return calloc(size, 1);
+}
+
+static void *MemRealloc(void *ptr, unsigned int size) {
+    headless.allocations++;
+    headless.allocatedBytes += size;
+    if (ptr == NULL) {
+        headless.liveBlocks++;
+    }
+    return realloc(ptr, size);
+}
+
+static void MemFree(void *ptr) {
+    if (ptr != NULL) {
+        headless.liveBlocks--;
+    }
+    free(ptr);
+}
+
+// Input
+//-------------------------------------------------------------------------------
+static Vector2 GetMousePosition(void) { return headless.mousePosition; }
+static Vector2 GetMouseDelta(void) { return headless.mouseDelta; }
+static float GetMouseWheelMove(void) { return headless.mouseWheel; }
+static bool IsMouseButtonDown(int button) { return headless.mouseButtonsDown[button]; }
+static bool IsMouseButtonPressed(int button) { return headless.mouseButtonsPressed[button]; }
+static bool IsMouseButtonReleased(int button) { return headless.mouseButtonsReleased[button]; }
+static bool IsKeyDown(int key) { return headless.keysDown[key]; }
+static bool IsKeyPressed(int key) { return headless.keysPressed[key]; }
+static bool IsGamepadAvailable(int gamepad) { return gamepad < HEADLESS_MAX_GAMEPADS && headless.gamepadsAvailable[gamepad]; }
+static bool IsGamepadButtonPressed(int gamepad, int button) { return headless.gamepadButtonsPressed[gamepad][button]; }
+static bool IsGamepadButtonDown(int gamepad, int button) { return headless.gamepadButtonsDown[gamepad][button]; }
+static float GetGamepadAxisMovement(int gamepad, int axis) { return headless.gamepadAxes[gamepad][axis]; }
+static float GetFrameTime(void) { return headless.frameTime; }
+static int GetCharPressed(void) { return headless.charsRead < headless.charCount ? headless.chars[headless.charsRead++] : 0; }
+
+// Drawing
+//-------------------------------------------------------------------------------
+static void DrawRectangle(int x, int y, int width, int height, Color color) {
+    if (RecordGuiDrawRectangle(x, y, width, height, color)) {
+        return;
+    }
+
+    int values[4] = { x, y, width, height };
+    HashHeadlessDraw(values, sizeof(values));
+    HashHeadlessDraw(&color, sizeof(color));
+    headless.rectanglesDrawn++;
+}
+
+static void DrawRectangleGradientEx(Rectangle rec, Color col1, Color col2, Color col3, Color col4) {
+    if (RecordGuiDrawRectangleGradient(rec, col1, col2, col3, col4)) {
+        return;
+    }
+
+    Color colors[4] = { col1, col2, col3, col4 };
+    HashHeadlessDraw(&rec, sizeof(rec));
+    HashHeadlessDraw(colors, sizeof(colors));
+    headless.rectanglesDrawn++;
+}
+
+static void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint) {
+    if (RecordGuiDrawText(font, text, position, fontSize, spacing, tint)) {
+        return;
+    }
+
+    float values[4] = { position.x, position.y, fontSize, spacing };
+    HashHeadlessDraw(text, headless.hashDraws ? (int)strlen(text) : 0);
+    HashHeadlessDraw(values, sizeof(values));
+    HashHeadlessDraw(&tint, sizeof(tint));
+    headless.textsDrawn++;
+}
+
+static void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint) {
+    if (RecordGuiDrawCodepoint(font, codepoint, position, fontSize, tint)) {
+        return;
+    }
+
+    float values[3] = { position.x, position.y, fontSize };
+    HashHeadlessDraw(&codepoint, sizeof(codepoint));
+    HashHeadlessDraw(values, sizeof(values));
+    HashHeadlessDraw(&tint, sizeof(tint));
+    headless.textsDrawn++;
+}
+
+static void BeginScissorMode(int x, int y, int width, int height) {
+    int values[4] = { x, y, width, height };
+    HashHeadlessDraw(values, sizeof(values));
+}
+
+static void EndScissorMode(void) {
+    HashHeadlessDraw("EndScissorMode", 14);
+}
+
+// Text
+//-------------------------------------------------------------------------------
+// Every glyph is treated as half as wide as it is tall. Each glyph is looked up in the font's glyph table, as raylib's
+// GetGlyphIndex() does, so measuring costs about what it does with raylib.
+static Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing) {
+    Vector2 size;
+    if (FindGuiTextSize(font, text, fontSize, spacing, &size)) {
+        return size;
+    }
+
+    static const char glyphTable[] = " !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstuvwxyz{|}~";
+    int length = 0;
+    for (; text[length] != '\0'; length++) {
+        int glyph = 0;
+        while (glyphTable[glyph] != '\0' && glyphTable[glyph] != text[length]) {
+            glyph++;
+        }
+        headless.glyphLookups += glyph + 1;
+    }
+    size = (Vector2){ length * fontSize / 2 + (length > 0 ? (length - 1) * spacing : 0), fontSize };
+    CacheGuiTextSize(font, text, fontSize, spacing, size);
+    headless.textsMeasured++;
+    return size;
+}
+
+static int GetGlyphIndex(Font font, int codepoint) { (void)font; (void)codepoint; return 0; }
+static Font GetFontDefault(void) { Font font = { 0 }; font.baseSize = 10; return font; }
+static Font LoadFontEx(const char *fileName, int fontSize, int *fontChars, int glyphCount) { (void)fileName; (void)fontSize; (void)fontChars; (void)glyphCount; return GetFontDefault(); }
+static inline Texture2D LoadTextureFromImage(Image image) { (void)image; Texture2D texture = { 0 }; return texture; }
+static void UnloadTexture(Texture2D texture) { (void)texture; }
+static inline void SetShapesTexture(Texture2D texture, Rectangle source) { (void)texture; (void)source; }
+static char *LoadFileText(const char *fileName) { (void)fileName; return NULL; }
+static const char *GetDirectoryPath(const char *filePath) { (void)filePath; return ""; }
+
+#define RAYGUI_CONTAINER_IMPLEMENTATION
+#include "raygui-container.h"
+
+#endif  // RAYGUI_CONTAINER_HEADLESS_H_
@@ -0,0 +1,2227 @@
+/**
+ * raygui-container-test
+ *
+ * Headless regression tests for raygui-container, run through ctest.
+ */
+
+// Record timings and counters, which the benchmark leaves out.
+#define RAYGUI_CONTAINER_PROFILE
+#include "raygui-container-headless.h"
+
+#include <stddef.h>
+
+static int testFailures = 0;
+
+#define EXPECT(condition) do { \
+        if (!(condition)) { \
+            testFailures++; \
+            printf("%s:%d: EXPECT(%s) failed\n", __FILE__, __LINE__, #condition); \
+        } \
+    } while (0)
+
+// Deterministic random numbers, so failures can be reproduced on every platform.
+static unsigned int testSeed = 1;
+
+static int TestRandom(int max) {
+    testSeed ^= testSeed << 13;
+    testSeed ^= testSeed >> 17;
+    testSeed ^= testSeed << 5;
+    return (int)(testSeed % (unsigned int)max);
+}
+
+static Rectangle TestRandomRectangle(int area, int maxSize) {
+    return (Rectangle){ (float)TestRandom(area), (float)TestRandom(area), (float)TestRandom(maxSize), (float)TestRandom(maxSize) };
+}
+
+/**
+ * Run a frame of UpdateGuiContainer() with a single key pressed.
+ */
+static void TestPressKey(GuiContainer* container, int key) {
+    BeginHeadlessFrame();
+    SetHeadlessKeyPressed(key);
+    UpdateGuiContainer(container);
+}
+
+static void TestSpatialIndexMatchesLinear(void) {
+    // Dense layouts use the spatial index, sparse ones fall back to the linear scan.
+    int areas[] = { 300, 1000, 5000 };
+    for (int trial = 0; trial < 30; trial++) {
+        GuiContainer container = InitGuiContainer();
+        int count = 200 + TestRandom(800);
+        int area = areas[trial % 3];
+        GuiElement* elements = (GuiElement*)malloc(count * sizeof(GuiElement));
+
+        for (int i = 0; i < count; i++) {
+            Rectangle bounds = TestRandomRectangle(area, 80);
+            elements[i] = TestRandom(3) == 0 ? AddCheckBox(&container, bounds, "CheckBox", false) : AddGuiButton(&container, bounds, "Button");
+        }
+
+        // Remove and move some of the elements, so the index is updated incrementally.
+        for (int i = 0; i < count / 4; i++) {
+            RemoveGuiElement(&container, elements[TestRandom(count)]);
+        }
+        for (int i = 0; i < count / 4; i++) {
+            SetGuiElementBounds(&container, elements[TestRandom(count)], TestRandomRectangle(area, 80));
+        }
+
+        for (int i = 0; i < container.count; i++) {
+            for (int direction = UP; direction <= LEFT; direction++) {
+                EXPECT(FindGuiElementInDirectionIndexed(&container, i, direction) == FindGuiElementInDirectionLinear(&container, i, direction));
+            }
+        }
+
+        free(elements);
+        UnloadGuiContainer(container);
+    }
+}
+
+/**
+ * Check every cached neighbour and tab order entry against a fresh search.
+ */
+static void TestCheckNavigationGraph(GuiContainer* container) {
+    GuiNavigationGraph* graph = container->navigation;
+    for (int i = 0; i < container->count; i++) {
+        int slot = container->ids[i];
+        for (int direction = UP; direction <= LEFT; direction++) {
+            if (graph->cached[slot] & (1 << direction)) {
+                int neighbour = graph->neighbours[slot * 4 + direction];
+                EXPECT((neighbour >= 0 ? container->slots[neighbour] : -1) == FindGuiElementInDirectionLinear(container, i, direction));
+            }
+        }
+
+        if (graph->cached[slot] & (1 << GUI_NAVIGATION_TAB)) {
+            int next = i + 1;
+            while (next < container->count && !(container->flags[next] & GUI_ELEMENT_SELECTABLE)) {
+                next++;
+            }
+            EXPECT(GetGuiElementTabNext(container, i) == (next < container->count ? next : 0));
+        }
+    }
+}
+
+static void TestNavigationGraph(void) {
+    for (int trial = 0; trial < 10; trial++) {
+        GuiContainer container = InitGuiContainer();
+        GuiElement elements[400];
+        int count = 0;
+        int area = trial % 2 == 0 ? 400 : 2000;
+
+        for (int step = 0; step < 2000; step++) {
+            int operation = TestRandom(10);
+            if (operation < 3 && count < 400) {
+                Rectangle bounds = TestRandomRectangle(area, 60);
+                elements[count++] = TestRandom(4) == 0 ? AddGuiButton(&container, bounds, "Button") : AddCheckBox(&container, bounds, "CheckBox", false);
+                if (TestRandom(5) == 0) {
+                    container.flags[container.count - 1] = 0;
+                }
+            }
+            else if (operation < 4 && count > 0) {
+                int removed = TestRandom(count);
+                RemoveGuiElement(&container, elements[removed]);
+                elements[removed] = elements[--count];
+            }
+            else if (operation < 5 && count > 0) {
+                SetGuiElementBounds(&container, elements[TestRandom(count)], TestRandomRectangle(area, 60));
+            }
+            else if (container.count > 0) {
+                // Fill in some of the graph.
+                int element = TestRandom(container.count);
+                GetGuiElementNeighbour(&container, element, TestRandom(4));
+                GetGuiElementTabNext(&container, element);
+            }
+
+            if (step % 100 == 99) {
+                TestCheckNavigationGraph(&container);
+            }
+        }
+
+        UnloadGuiContainer(container);
+    }
+}
+
+/**
+ * Get the bounds of a random cell in a grid, where many distances are equal, or sometimes far outside of it.
+ */
+static Rectangle TestRandomGridRectangle(void) {
+    if (TestRandom(20) == 0) {
+        return (Rectangle){ (float)TestRandom(20000) - 10000, (float)TestRandom(20000) - 10000, 100, 30 };
+    }
+    return (Rectangle){ (float)TestRandom(30) * 110, (float)TestRandom(30) * 40, 100, 30 };
+}
+
+static void TestNavigationGraphGrid(void) {
+    // A dense grid, so the invalidation goes through the spatial index rather than visiting every element.
+    GuiContainer container = InitGuiContainer();
+    GuiElement elements[900];
+    int count = 0;
+    for (int i = 0; i < 900; i++) {
+        elements[count++] = AddGuiButton(&container, (Rectangle){ (float)(i % 30) * 110, (float)(i / 30) * 40, 100, 30 }, "Button");
+    }
+
+    // Elements on the edge have no neighbour past it, until one is added far away.
+    for (int i = 0; i < container.count; i++) {
+        GetGuiElementNeighbour(&container, i, UP);
+        GetGuiElementNeighbour(&container, i, LEFT);
+    }
+    GuiElement above = AddGuiButton(&container, (Rectangle){ 500, -5000, 100, 30 }, "Above");
+    GuiElement left = AddGuiButton(&container, (Rectangle){ -5000, 500, 100, 30 }, "Left");
+    TestCheckNavigationGraph(&container);
+    RemoveGuiElement(&container, above);
+    RemoveGuiElement(&container, left);
+
+    for (int step = 0; step < 4000; step++) {
+        int operation = TestRandom(10);
+        if (operation == 0 && count < 900) {
+            elements[count++] = AddGuiButton(&container, TestRandomGridRectangle(), "Button");
+        }
+        else if (operation == 1 && count > 0) {
+            int removed = TestRandom(count);
+            RemoveGuiElement(&container, elements[removed]);
+            elements[removed] = elements[--count];
+        }
+        else if (operation == 2 && count > 0) {
+            SetGuiElementBounds(&container, elements[TestRandom(count)], TestRandomGridRectangle());
+        }
+        else if (container.count > 0) {
+            for (int i = 0; i < 20; i++) {
+                GetGuiElementNeighbour(&container, TestRandom(container.count), TestRandom(4));
+            }
+        }
+
+        if (step % 200 == 199) {
+            TestCheckNavigationGraph(&container);
+        }
+    }
+
+    UnloadGuiContainer(container);
+}
+
+static void TestNavigationDump(void) {
+    GuiContainer container = InitGuiContainer();
+    GuiElement first = AddGuiButton(&container, (Rectangle){ 0, 0, 100, 20 }, "First");
+    GuiElement second = AddGuiButton(&container, (Rectangle){ 0, 40, 100, 20 }, "Second");
+
+    // Hidden at the same position as the first button, so no direction leads to it.
+    GuiElement hidden = AddGuiButton(&container, (Rectangle){ 0, 0, 50, 20 }, "Hidden");
+
+    GuiNavigationNode nodes[3];
+    EXPECT(GetGuiContainerNavigation(&container, nodes, 3) == 3);
+    EXPECT(nodes[0].element.index == first.index && nodes[0].reachable);
+    EXPECT(nodes[0].neighbours[DOWN].index == second.index);
+    EXPECT(nodes[0].neighbours[UP].index == -1);
+    EXPECT(nodes[1].reachable);
+    EXPECT(nodes[1].tabNext.index == hidden.index);
+    EXPECT(nodes[2].element.index == hidden.index && !nodes[2].reachable);
+    EXPECT(nodes[2].tabNext.index == first.index);
+
+    UnloadGuiContainer(container);
+}
+
+static void TestHitTestMatchesScalar(void) {
+    for (int trial = 0; trial < 30; trial++) {
+        GuiContainer container = InitGuiContainer();
+        int count = 1 + TestRandom(500);
+        for (int i = 0; i < count; i++) {
+            AddGuiButton(&container, TestRandomRectangle(500, 80), "Button");
+
+            // Mix in some elements that can't be selected.
+            if (TestRandom(5) == 0) {
+                container.flags[container.count - 1] = 0;
+            }
+        }
+
+        for (int i = 0; i < 1000; i++) {
+            Vector2 point = { (float)TestRandom(600) - 50, (float)TestRandom(600) - 50 };
+
+            // Also check points right on the edge of an element.
+            if (i % 5 == 0) {
+                Rectangle bounds = container.bounds[TestRandom(container.count)];
+                point = (Vector2){ bounds.x + bounds.width, bounds.y + bounds.height };
+            }
+
+            EXPECT(FindGuiElementAtPoint(&container, point) == FindGuiElementAtPointScalar(&container, point));
+        }
+
+        UnloadGuiContainer(container);
+    }
+}
+
+static void TestHandles(void) {
+    GuiContainer container = InitGuiContainer();
+    GuiElement first = AddSlider(&container, (Rectangle){ 0, 0, 100, 20 }, "Less", "More", 30, 0, 100);
+    GuiElement removed = AddGuiButton(&container, (Rectangle){ 0, 40, 100, 20 }, "Removed");
+
+    // Grow the container past its initial capacity.
+    for (int i = 0; i < RAYGUI_CONTAINER_INITIAL_CAPACITY * 4; i++) {
+        AddGuiButton(&container, (Rectangle){ 200, (float)i * 30, 100, 20 }, "Button");
+    }
+    EXPECT(container.capacity >= container.count);
+    EXPECT(IsGuiElementValid(&container, first));
+    EXPECT(GetGuiSliderValue(&container, first) == 30);
+
+    // Removed handles no longer resolve, even when their index is reused.
+    RemoveGuiElement(&container, removed);
+    EXPECT(!IsGuiElementValid(&container, removed));
+    GuiElement reused = AddCheckBox(&container, (Rectangle){ 0, 40, 20, 20 }, "Reused", true);
+    EXPECT(reused.index == removed.index);
+    EXPECT(!IsGuiElementValid(&container, removed));
+    EXPECT(IsGuiCheckBoxChecked(&container, reused));
+    EXPECT(GetGuiSliderValue(&container, first) == 30);
+
+    UnloadGuiContainer(container);
+}
+
+static void TestKeyboardNavigation(void) {
+    // The layout from the example.
+    GuiContainer container = InitGuiContainer();
+    GuiElement newGame = AddGuiButton(&container, (Rectangle){ 20, 20, 250, 60 }, "New Game");
+    GuiElement loadGame = AddGuiButton(&container, (Rectangle){ 20, 90, 250, 60 }, "Load Game");
+    GuiElement exit = AddGuiButton(&container, (Rectangle){ 20, 160, 250, 60 }, "Exit");
+    GuiElement options = AddGuiButton(&container, (Rectangle){ 280, 90, 250, 60 }, "Options");
+
+    EXPECT(container.activeElement == GetGuiElementIndex(&container, newGame));
+    TestPressKey(&container, KEY_DOWN);
+    EXPECT(container.activeElement == GetGuiElementIndex(&container, loadGame));
+    TestPressKey(&container, KEY_RIGHT);
+    EXPECT(container.activeElement == GetGuiElementIndex(&container, options));
+    TestPressKey(&container, KEY_LEFT);
+    TestPressKey(&container, KEY_DOWN);
+    EXPECT(container.activeElement == GetGuiElementIndex(&container, exit));
+
+    // Pressing a button only lasts a single frame.
+    TestPressKey(&container, KEY_ENTER);
+    EXPECT(IsGuiButtonPressed(&container, exit));
+    BeginHeadlessFrame();
+    UpdateGuiContainer(&container);
+    EXPECT(!IsGuiButtonPressed(&container, exit));
+
+    // Tab wraps around to the first element.
+    TestPressKey(&container, KEY_TAB);
+    EXPECT(container.activeElement == GetGuiElementIndex(&container, options));
+    TestPressKey(&container, KEY_TAB);
+    EXPECT(container.activeElement == GetGuiElementIndex(&container, newGame));
+
+    UnloadGuiContainer(container);
+}
+
+static void TestSlider(void) {
+    GuiContainer container = InitGuiContainer();
+    GuiElement slider = AddSlider(&container, (Rectangle){ 20, 20, 200, 20 }, "Less", "More", 50, 0, 100);
+    AddGuiButton(&container, (Rectangle){ 300, 20, 100, 20 }, "Button");
+
+    // The slider has to be focus locked before it can be moved.
+    TestPressKey(&container, KEY_ENTER);
+    EXPECT(container.focusLocked);
+    TestPressKey(&container, KEY_RIGHT);
+    EXPECT(GetGuiSliderValue(&container, slider) == 55);
+    for (int i = 0; i < 30; i++) {
+        TestPressKey(&container, KEY_LEFT);
+    }
+    EXPECT(GetGuiSliderValue(&container, slider) == 0);
+
+    // Unlocking lets the arrows switch focus again.
+    TestPressKey(&container, KEY_ENTER);
+    EXPECT(!container.focusLocked);
+    TestPressKey(&container, KEY_RIGHT);
+    EXPECT(container.activeElement == 1);
+
+    UnloadGuiContainer(container);
+}
+
+/**
+ * Hold a key through frames of the given length, for the given time after the frame it's pressed in, then release it.
+ */
+static void TestHoldKey(GuiContainer* container, int key, float seconds, float frameTime) {
+    SetHeadlessFrameTime(frameTime);
+    int frames = (int)(seconds / frameTime + 0.5f);
+    for (int frame = 0; frame <= frames; frame++) {
+        BeginHeadlessFrame();
+        SetHeadlessKeyDown(key, true);
+        UpdateGuiContainer(container);
+    }
+    BeginHeadlessFrame();
+    SetHeadlessKeyDown(key, false);
+    UpdateGuiContainer(container);
+    SetHeadlessFrameTime(1.0f / 60.0f);
+}
+
+static bool TestNear(float value, float expected) {
+    return value > expected - 0.01f && value < expected + 0.01f;
+}
+
+static void TestTimedAdjustment(void) {
+    GuiContainer container = InitGuiContainer();
+    GuiElement slider = AddSlider(&container, (Rectangle){ 20, 20, 200, 20 }, "Less", "More", 0, 0, 100);
+    GuiElement bar = AddGuiSliderBar(&container, (Rectangle){ 20, 60, 200, 20 }, "Less", "More", 0, 0, 100);
+    GuiElement spinner = AddGuiSpinner(&container, (Rectangle){ 20, 100, 200, 20 }, "Count", 5, 0, 10);
+    GuiElement box = AddGuiValueBox(&container, (Rectangle){ 20, 140, 200, 20 }, "Size", 50, 0, 100);
+
+    // Holding an arrow moves a locked slider by the time it's held, whatever the frame rate.
+    SetGuiElementStep(&container, slider, 1);
+    TestPressKey(&container, KEY_ENTER);
+    TestHoldKey(&container, KEY_RIGHT, 1.0f, 1.0f / 60.0f);
+    float perSecond = GetGuiSliderValue(&container, slider);
+    EXPECT(perSecond > 5);
+    SetGuiSliderValue(&container, slider, 0);
+    TestHoldKey(&container, KEY_RIGHT, 1.0f, 1.0f / 10.0f);
+    EXPECT(TestNear(GetGuiSliderValue(&container, slider), perSecond));
+
+    // The repeat speeds up the longer it's held.
+    SetGuiSliderValue(&container, slider, 0);
+    TestHoldKey(&container, KEY_RIGHT, 2.0f, 1.0f / 60.0f);
+    EXPECT(GetGuiSliderValue(&container, slider) - perSecond > 2 * perSecond);
+    TestPressKey(&container, KEY_ENTER);
+
+    // The modifiers scale a single press to a fraction of a step, or several.
+    TestPressKey(&container, KEY_DOWN);
+    EXPECT(container.activeElement == GetGuiElementIndex(&container, bar));
+    BeginHeadlessFrame();
+    SetHeadlessKeyDown(KEY_LEFT_SHIFT, true);
+    SetHeadlessGamepadButtonPressed(0, GAMEPAD_BUTTON_RIGHT_TRIGGER_1);
+    UpdateGuiContainer(&container);
+    SetHeadlessKeyDown(KEY_LEFT_SHIFT, false);
+    EXPECT(TestNear(GetGuiSliderValue(&container, bar), 1));
+    BeginHeadlessFrame();
+    SetHeadlessKeyDown(KEY_LEFT_CONTROL, true);
+    SetHeadlessGamepadButtonPressed(0, GAMEPAD_BUTTON_RIGHT_TRIGGER_1);
+    UpdateGuiContainer(&container);
+    SetHeadlessKeyDown(KEY_LEFT_CONTROL, false);
+    EXPECT(TestNear(GetGuiSliderValue(&container, bar), 26));
+
+    // With a step, fine adjustments add up until they reach it.
+    SetGuiElementStep(&container, bar, 10);
+    SetGuiSliderValue(&container, bar, 50);
+    for (int i = 0; i < 5; i++) {
+        BeginHeadlessFrame();
+        SetHeadlessKeyDown(KEY_LEFT_SHIFT, true);
+        SetHeadlessGamepadButtonPressed(0, GAMEPAD_BUTTON_RIGHT_TRIGGER_1);
+        UpdateGuiContainer(&container);
+        EXPECT(i > 0 || GetGuiSliderValue(&container, bar) == 50);
+    }
+    SetHeadlessKeyDown(KEY_LEFT_SHIFT, false);
+    EXPECT(GetGuiSliderValue(&container, bar) == 60);
+
+    // The right stick adjusts by how far it's pushed, past its dead zone.
+    SetGuiElementStep(&container, bar, 0);
+    SetGuiSliderValue(&container, bar, 0);
+    BeginHeadlessFrame();
+    SetHeadlessGamepadAxis(0, GAMEPAD_AXIS_RIGHT_X, 0.1f);
+    UpdateGuiContainer(&container);
+    EXPECT(GetGuiSliderValue(&container, bar) == 0);
+    SetHeadlessGamepadAxis(0, GAMEPAD_AXIS_RIGHT_X, 1.0f);
+    for (int frame = 0; frame < 60; frame++) {
+        BeginHeadlessFrame();
+        UpdateGuiContainer(&container);
+    }
+    SetHeadlessGamepadAxis(0, GAMEPAD_AXIS_RIGHT_X, 0);
+    EXPECT(TestNear(GetGuiSliderValue(&container, bar), 5 * RAYGUI_CONTAINER_AXIS_RATE));
+
+    // The mouse wheel adjusts the focused element, and the spinner's buttons step it.
+    TestPressKey(&container, KEY_DOWN);
+    EXPECT(container.activeElement == GetGuiElementIndex(&container, spinner));
+    BeginHeadlessFrame();
+    SetHeadlessMouseWheel(2);
+    UpdateGuiContainer(&container);
+    EXPECT(GetGuiSpinnerValue(&container, spinner) == 7);
+    BeginHeadlessFrame();
+    SetHeadlessMousePosition((Vector2){ 25, 110 });
+    UpdateGuiContainer(&container);
+    BeginHeadlessFrame();
+    SetHeadlessMouseButtonReleased(MOUSE_BUTTON_LEFT);
+    UpdateGuiContainer(&container);
+    EXPECT(GetGuiSpinnerValue(&container, spinner) == 6);
+
+    // A value box steps by whole numbers, and stays in its range.
+    TestPressKey(&container, KEY_DOWN);
+    TestPressKey(&container, KEY_ENTER);
+    TestPressKey(&container, KEY_RIGHT);
+    EXPECT(GetGuiSpinnerValue(&container, box) == 51);
+    TestHoldKey(&container, KEY_RIGHT, 3.0f, 1.0f / 30.0f);
+    EXPECT(GetGuiSpinnerValue(&container, box) == 100);
+    DrawGuiContainer(container);
+
+    // The new controls and steps survive the text format.
+    SetGuiElementStep(&container, spinner, 2);
+    EXPECT(ExportGuiContainerText(&container, "raygui-container-test.txt"));
+    GuiContainer text = LoadGuiContainerText("raygui-container-test.txt");
+    EXPECT(text.count == 4);
+    for (int i = 0; i < text.count && i < container.count; i++) {
+        EXPECT(text.types[i] == container.types[i]);
+        EXPECT(text.states[i].value.step == container.states[i].value.step);
+        EXPECT(text.states[i].value.value == container.states[i].value.value);
+    }
+    UnloadGuiContainer(text);
+    remove("raygui-container-test.txt");
+
+    UnloadGuiContainer(container);
+}
+
+/**
+ * Add one of each control that holds a state of its own.
+ */
+static void TestAddControls(GuiContainer* container, GuiElement* elements) {
+    elements[0] = AddGuiToggle(container, (Rectangle){ 20, 20, 200, 20 }, "Toggle", false);
+    elements[1] = AddGuiToggleGroup(container, (Rectangle){ 20, 50, 200, 20 }, "One;Two;Three", 5);
+    elements[2] = AddGuiComboBox(container, (Rectangle){ 20, 80, 200, 20 }, "Low;High", 0);
+    elements[3] = AddGuiDropdownBox(container, (Rectangle){ 20, 110, 200, 20 }, "Red\nGreen\nBlue", 0);
+    elements[4] = AddGuiTextBox(container, (Rectangle){ 20, 140, 200, 20 }, "Name", 8);
+    elements[5] = AddGuiProgressBar(container, (Rectangle){ 20, 170, 200, 20 }, "Loading", NULL, 0.5f, 0, 1);
+    elements[6] = AddGuiColorPicker(container, (Rectangle){ 20, 200, 100, 100 }, NULL, (Color){ 230, 41, 55, 255 });
+}
+
+static void TestControls(void) {
+    GuiContainer container = InitGuiContainer();
+    GuiElement elements[7];
+    TestAddControls(&container, elements);
+    GuiElement toggle = elements[0], group = elements[1], combo = elements[2], dropdown = elements[3];
+    GuiElement name = elements[4], progress = elements[5], color = elements[6];
+    EXPECT(sizeof(void*) != 8 || sizeof(GuiElementState) <= 40);
+    EXPECT(GetGuiElementType(&container, dropdown) == GUI_TYPE_DROPDOWNBOX);
+    EXPECT(GetGuiElementActive(&container, group) == 2);
+    EXPECT(strcmp(GetGuiTextBoxText(&container, name), "Name") == 0);
+
+    // A toggle flips like a check box.
+    int count;
+    TestPressKey(&container, KEY_ENTER);
+    const GuiEvent* events = GetGuiContainerEvents(&container, &count);
+    EXPECT(IsGuiCheckBoxChecked(&container, toggle));
+    EXPECT(count == 1 && events[0].type == GUI_EVENT_TOGGLED && events[0].newValue == 1);
+
+    // A focus locked toggle group chooses its item with left and right, and the mouse chooses the item clicked.
+    TestPressKey(&container, KEY_DOWN);
+    EXPECT(container.activeElement == GetGuiElementIndex(&container, group));
+    TestPressKey(&container, KEY_ENTER);
+    TestPressKey(&container, KEY_LEFT);
+    events = GetGuiContainerEvents(&container, &count);
+    EXPECT(count == 1 && events[0].type == GUI_EVENT_VALUE_CHANGED && events[0].oldValue == 2 && events[0].newValue == 1);
+    TestPressKey(&container, KEY_ENTER);
+    BeginHeadlessFrame();
+    SetHeadlessMousePosition((Vector2){ 40, 60 });
+    UpdateGuiContainer(&container);
+    BeginHeadlessFrame();
+    SetHeadlessMouseButtonReleased(MOUSE_BUTTON_LEFT);
+    UpdateGuiContainer(&container);
+    EXPECT(GetGuiElementActive(&container, group) == 0);
+
+    // A combo box moves on to its next item each time it's pressed.
+    TestPressKey(&container, KEY_DOWN);
+    TestPressKey(&container, KEY_ENTER);
+    EXPECT(GetGuiElementActive(&container, combo) == 1);
+    TestPressKey(&container, KEY_ENTER);
+    events = GetGuiContainerEvents(&container, &count);
+    EXPECT(count == 1 && events[0].oldValue == 1 && events[0].newValue == 0);
+
+    // An open dropdown box takes up and down, and closes when an item is clicked.
+    TestPressKey(&container, KEY_DOWN);
+    TestPressKey(&container, KEY_ENTER);
+    TestPressKey(&container, KEY_DOWN);
+    TestPressKey(&container, KEY_DOWN);
+    TestPressKey(&container, KEY_DOWN);
+    EXPECT(container.activeElement == GetGuiElementIndex(&container, dropdown));
+    EXPECT(GetGuiElementActive(&container, dropdown) == 2);
+    float itemHeight = 20.0f + (float)GuiGetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_SPACING);
+    BeginHeadlessFrame();
+    SetHeadlessMousePosition((Vector2){ 40, 110 + itemHeight + 10 });
+    UpdateGuiContainer(&container);
+    BeginHeadlessFrame();
+    SetHeadlessMouseButtonReleased(MOUSE_BUTTON_LEFT);
+    UpdateGuiContainer(&container);
+    EXPECT(GetGuiElementActive(&container, dropdown) == 0 && !container.focusLocked);
+
+    // A focus locked text box takes what's typed, while it fits, and keeps focus.
+    FocusGuiElement(&container, GetGuiElementIndex(&container, name));
+    TestPressKey(&container, KEY_ENTER);
+    BeginHeadlessFrame();
+    SetHeadlessCharPressed("ab\xc3\xa9");
+    UpdateGuiContainer(&container);
+    EXPECT(strcmp(GetGuiTextBoxText(&container, name), "Nameab") == 0);
+    events = GetGuiContainerEvents(&container, &count);
+    EXPECT(count == 2 && events[1].type == GUI_EVENT_TEXT_CHANGED && events[1].oldValue == 5 && events[1].newValue == 6);
+    TestPressKey(&container, KEY_DOWN);
+    EXPECT(container.activeElement == GetGuiElementIndex(&container, name));
+
+    // Backspace deletes a whole codepoint.
+    SetGuiTextBoxText(&container, name, "x");
+    BeginHeadlessFrame();
+    SetHeadlessCharPressed("\xc3\xa9");
+    UpdateGuiContainer(&container);
+    TestPressKey(&container, KEY_BACKSPACE);
+    events = GetGuiContainerEvents(&container, &count);
+    EXPECT(strcmp(GetGuiTextBoxText(&container, name), "x") == 0);
+    EXPECT(count == 1 && events[0].oldValue == 3 && events[0].newValue == 1);
+    TestPressKey(&container, KEY_ENTER);
+
+    // A progress bar can't take focus.
+    TestPressKey(&container, KEY_DOWN);
+    EXPECT(container.activeElement == GetGuiElementIndex(&container, color));
+    SetGuiSliderValue(&container, progress, 2);
+    EXPECT(GetGuiSliderValue(&container, progress) == 1);
+
+    // A focus locked color picker turns its hue with left and right, keeping its saturation and value.
+    float hue = GetGuiColorHue(GetGuiColorPickerColor(&container, color), 0);
+    TestPressKey(&container, KEY_ENTER);
+    TestPressKey(&container, KEY_RIGHT);
+    events = GetGuiContainerEvents(&container, &count);
+    float turned = hue + 360.0f * RAYGUI_CONTAINER_ADJUST_STEP - 360.0f;
+    EXPECT(count == 1 && events[0].type == GUI_EVENT_VALUE_CHANGED && TestNear(events[0].newValue, turned));
+    Color turnedColor = GetGuiColorPickerColor(&container, color);
+    EXPECT(GetGuiColorHue(turnedColor, 0) > turned - 1 && GetGuiColorHue(turnedColor, 0) < turned + 1);
+    EXPECT(turnedColor.r == 230 && turnedColor.a == 255);
+    TestPressKey(&container, KEY_ENTER);
+
+    // Drawing a color picker with the mouse down on it doesn't pick, but clicking its panel picks the saturation and
+    // value, keeping the hue, and clicking its hue bar picks the hue.
+    BeginHeadlessFrame();
+    SetHeadlessMousePosition((Vector2){ 70, 250 });
+    SetHeadlessMouseButtonDown(MOUSE_BUTTON_LEFT);
+    UpdateGuiContainer(&container);
+    DrawGuiContainer(container);
+    Color picked = GetGuiColorPickerColor(&container, color);
+    EXPECT(memcmp(&picked, &turnedColor, sizeof(Color)) == 0);
+    BeginHeadlessFrame();
+    SetHeadlessMouseButtonReleased(MOUSE_BUTTON_LEFT);
+    UpdateGuiContainer(&container);
+    events = GetGuiContainerEvents(&container, &count);
+    EXPECT(count == 1 && events[0].type == GUI_EVENT_VALUE_CHANGED && events[0].oldValue == events[0].newValue);
+    picked = GetGuiColorPickerColor(&container, color);
+    EXPECT(GetGuiColorHue(picked, 0) > turned - 1 && GetGuiColorHue(picked, 0) < turned + 1);
+    EXPECT(picked.r == 128 && picked.b == 64 && picked.a == 255);
+    float hueBarX = 120.0f + (float)GuiGetStyle(COLORPICKER, HUEBAR_PADDING) + (float)GuiGetStyle(COLORPICKER, HUEBAR_WIDTH) / 2;
+    BeginHeadlessFrame();
+    SetHeadlessMousePosition((Vector2){ hueBarX, 250 });
+    SetHeadlessMouseButtonReleased(MOUSE_BUTTON_LEFT);
+    UpdateGuiContainer(&container);
+    events = GetGuiContainerEvents(&container, &count);
+    EXPECT(count == 1 && events[0].type == GUI_EVENT_VALUE_CHANGED && TestNear(events[0].newValue, 180));
+    picked = GetGuiColorPickerColor(&container, color);
+    EXPECT(picked.r == 64 && picked.g == 128 && picked.b == 128);
+
+    // Text boxes own their text, so they can't be saved. The other controls survive both formats.
+    EXPECT(!ExportGuiContainerText(&container, "raygui-container-test.txt"));
+    RemoveGuiElement(&container, name);
+    EXPECT(ExportGuiContainerText(&container, "raygui-container-test.txt"));
+    EXPECT(ExportGuiContainer(&container, "raygui-container-test.rgc"));
+    GuiContainer loaded[2] = { LoadGuiContainerText("raygui-container-test.txt"), LoadGuiContainer("raygui-container-test.rgc") };
+    for (int format = 0; format < 2; format++) {
+        EXPECT(loaded[format].count == container.count);
+        for (int i = 0; i < loaded[format].count && i < container.count; i++) {
+            GuiElement a = GetGuiElementAt(&container, i);
+            GuiElement b = GetGuiElementAt(&loaded[format], i);
+            EXPECT(GetGuiElementType(&loaded[format], b) == GetGuiElementType(&container, a));
+            EXPECT(IsGuiCheckBoxChecked(&loaded[format], b) == IsGuiCheckBoxChecked(&container, a));
+            EXPECT(GetGuiElementActive(&loaded[format], b) == GetGuiElementActive(&container, a));
+            EXPECT(GetGuiSliderValue(&loaded[format], b) == GetGuiSliderValue(&container, a));
+            Color colors[2] = { GetGuiColorPickerColor(&loaded[format], b), GetGuiColorPickerColor(&container, a) };
+            EXPECT(memcmp(colors, colors + 1, sizeof(Color)) == 0);
+        }
+        UnloadGuiContainer(loaded[format]);
+    }
+    remove("raygui-container-test.txt");
+    remove("raygui-container-test.rgc");
+    UnloadGuiContainer(container);
+}
+
+static void TestGamepads(void) {
+    GuiContainer container = InitGuiContainer();
+    GuiElement slider = AddSlider(&container, (Rectangle){ 20, 20, 200, 20 }, "Less", "More", 50, 0, 100);
+    GuiElement button = AddGuiButton(&container, (Rectangle){ 20, 60, 200, 20 }, "Button");
+
+    // Any connected gamepad can navigate.
+    BeginHeadlessFrame();
+    SetHeadlessGamepadButtonPressed(2, GAMEPAD_BUTTON_LEFT_FACE_DOWN);
+    UpdateGuiContainer(&container);
+    EXPECT(container.activeElement == GetGuiElementIndex(&container, button));
+    BeginHeadlessFrame();
+    SetHeadlessGamepadButtonPressed(1, GAMEPAD_BUTTON_LEFT_FACE_UP);
+    UpdateGuiContainer(&container);
+    EXPECT(container.activeElement == GetGuiElementIndex(&container, slider));
+
+    // The shoulder buttons adjust the slider without locking focus.
+    BeginHeadlessFrame();
+    SetHeadlessGamepadButtonPressed(0, GAMEPAD_BUTTON_RIGHT_TRIGGER_1);
+    UpdateGuiContainer(&container);
+    EXPECT(GetGuiSliderValue(&container, slider) == 55);
+    EXPECT(!container.focusLocked);
+
+    UnloadGuiContainer(container);
+}
+
+static void TestBindings(void) {
+    GuiContainer container = InitGuiContainer();
+    AddGuiButton(&container, (Rectangle){ 20, 20, 200, 20 }, "Top");
+    GuiElement bottom = AddGuiButton(&container, (Rectangle){ 20, 60, 200, 20 }, "Bottom");
+
+    // Rebind navigation and activation.
+    ClearGuiContainerBindings(&container);
+    AddGuiContainerBinding(&container, (GuiInputBinding){ GUI_INPUT_KEY, KEY_S, GUI_ACTION_NAVIGATE, DOWN });
+    AddGuiContainerBinding(&container, (GuiInputBinding){ GUI_INPUT_KEY, KEY_SPACE, GUI_ACTION_ACTIVATE, 0 });
+    TestPressKey(&container, KEY_DOWN);
+    EXPECT(container.activeElement == 0);
+    TestPressKey(&container, KEY_S);
+    EXPECT(container.activeElement == GetGuiElementIndex(&container, bottom));
+    TestPressKey(&container, KEY_SPACE);
+    EXPECT(IsGuiButtonPressed(&container, bottom));
+
+    // Actions can be queued directly, without any input.
+    BeginHeadlessFrame();
+    PushGuiContainerAction(&container, (GuiAction){ GUI_ACTION_NAVIGATE, UP, (Vector2){ 0, 0 }, 0 });
+    int count;
+    GetGuiContainerActions(&container, &count);
+    EXPECT(count == 1);
+    ProcessGuiContainerActions(&container);
+    EXPECT(container.activeElement == 0);
+    EXPECT(!IsGuiButtonPressed(&container, bottom));
+    GetGuiContainerActions(&container, &count);
+    EXPECT(count == 0);
+
+    UnloadGuiContainer(container);
+}
+
+static void TestMouseHover(void) {
+    GuiContainer container = InitGuiContainer();
+    AddGuiButton(&container, (Rectangle){ 0, 0, 100, 100 }, "Below");
+    GuiElement above = AddGuiButton(&container, (Rectangle){ 50, 50, 100, 100 }, "Above");
+    AddGuiButton(&container, (Rectangle){ 300, 0, 100, 100 }, "Elsewhere");
+
+    // The element drawn last is on top.
+    BeginHeadlessFrame();
+    SetHeadlessMousePosition((Vector2){ 75, 75 });
+    UpdateGuiContainer(&container);
+    EXPECT(container.activeElement == GetGuiElementIndex(&container, above));
+
+    // Clicking the hovered button presses it.
+    BeginHeadlessFrame();
+    SetHeadlessMouseButtonReleased(MOUSE_BUTTON_LEFT);
+    UpdateGuiContainer(&container);
+    EXPECT(IsGuiButtonPressed(&container, above));
+
+    UnloadGuiContainer(container);
+}
+
+/**
+ * Draw the container, and get the hash of what it drew.
+ */
+static unsigned int TestDrawHash(GuiContainer* container) {
+    ResetHeadlessCounters();
+    headless.hashDraws = true;
+    DrawGuiContainer(*container);
+    headless.hashDraws = false;
+    return headless.drawHash;
+}
+
+/**
+ * Hash what raygui draws for a choice from its text, focused and locked, the way a container draws its only element.
+ */
+static unsigned int TestChoiceDrawHash(int type, Rectangle bounds, const char* text, int active) {
+    ResetHeadlessCounters();
+    headless.hashDraws = true;
+    guiState = STATE_FOCUSED;
+    guiLocked = true;
+    if (type == GUI_TYPE_TOGGLEGROUP) {
+        GuiToggleGroup(bounds, text, active);
+    }
+    else if (type == GUI_TYPE_COMBOBOX) {
+        GuiComboBox(bounds, text, active);
+    }
+    else {
+        GuiDropdownBox(bounds, text, &active, false);
+    }
+    guiState = STATE_NORMAL;
+    guiLocked = false;
+    headless.hashDraws = false;
+    return headless.drawHash;
+}
+
+static void TestChoiceDrawing(void) {
+    long liveBlocks = headless.liveBlocks;
+
+    // Choices are drawn from their items, split the first time they're drawn, the same as raygui draws their text.
+    static const int types[3] = { GUI_TYPE_TOGGLEGROUP, GUI_TYPE_COMBOBOX, GUI_TYPE_DROPDOWNBOX };
+    for (int i = 0; i < 3; i++) {
+        GuiContainer container = InitGuiContainer();
+        Rectangle bounds = { 20, 20, 300, 30 };
+        GuiElement element = AddGuiChoiceElement(&container, types[i], bounds, "One;Two;Three", 1);
+        int index = GetGuiElementIndex(&container, element);
+        Rectangle itemBounds = types[i] == GUI_TYPE_TOGGLEGROUP ? GetGuiToggleGroupItemBounds(&container, index, bounds, 0) : bounds;
+        EXPECT(container.states[index].choice.items == NULL);
+        EXPECT(TestDrawHash(&container) == TestChoiceDrawHash(types[i], itemBounds, "One;Two;Three", 1));
+        const char** items = container.states[index].choice.items;
+        EXPECT(items != NULL && strcmp(items[0], "One") == 0 && strcmp(items[2], "Three") == 0);
+        TestDrawHash(&container);
+        EXPECT(container.states[index].choice.items == items);
+
+        // Another chosen item is drawn from the same items.
+        SetGuiElementActive(&container, element, 2);
+        EXPECT(TestDrawHash(&container) == TestChoiceDrawHash(types[i], itemBounds, "One;Two;Three", 2));
+        EXPECT(container.states[index].choice.items == items);
+        SetGuiElementActive(&container, element, 1);
+
+        // New text is split again the next time it's drawn.
+        SetGuiElementText(&container, element, "Low;High");
+        EXPECT(container.states[index].choice.items == NULL);
+        itemBounds = types[i] == GUI_TYPE_TOGGLEGROUP ? GetGuiToggleGroupItemBounds(&container, index, bounds, 0) : bounds;
+        EXPECT(TestDrawHash(&container) == TestChoiceDrawHash(types[i], itemBounds, "Low;High", 1));
+        EXPECT(strcmp(container.states[index].choice.items[1], "High") == 0);
+        UnloadGuiContainer(container);
+    }
+
+    EXPECT(headless.liveBlocks == liveBlocks);
+}
+
+static void TestDrawCacheMatchesImmediate(void) {
+    // Two copies of the same layout, one drawn immediately and one through the draw cache.
+    GuiContainer immediate = InitGuiContainer();
+    GuiContainer retained = InitGuiContainer();
+    EnableGuiContainerDrawCache(&retained);
+    GuiElement elements[2][60];
+    for (int i = 0; i < 60; i++) {
+        Rectangle bounds = TestRandomRectangle(400, 80);
+        for (int copy = 0; copy < 2; copy++) {
+            GuiContainer* container = copy == 0 ? &immediate : &retained;
+            switch (i % 3) {
+                case 0: elements[copy][i] = AddGuiButton(container, bounds, "Button"); break;
+                case 1: elements[copy][i] = AddCheckBox(container, bounds, "CheckBox", i % 2 == 0); break;
+                case 2: elements[copy][i] = AddSlider(container, bounds, "Less", "More", 50, 0, 100); break;
+            }
+        }
+    }
+
+    // Run both through the same scripted input, comparing what they draw each frame.
+    int keys[] = { KEY_UP, KEY_RIGHT, KEY_DOWN, KEY_LEFT, KEY_ENTER, KEY_TAB };
+    for (int frame = 0; frame < 500; frame++) {
+        BeginHeadlessFrame();
+        switch (TestRandom(6)) {
+            case 0:
+                SetHeadlessKeyPressed(keys[TestRandom(6)]);
+                break;
+            case 1:
+                SetHeadlessMousePosition((Vector2){ (float)TestRandom(500), (float)TestRandom(500) });
+                break;
+            case 2:
+                SetHeadlessMouseButtonDown(MOUSE_BUTTON_LEFT);
+                break;
+            case 3:
+                SetHeadlessMouseButtonReleased(MOUSE_BUTTON_LEFT);
+                break;
+            case 4: {
+                int element = TestRandom(60);
+                Rectangle bounds = TestRandomRectangle(400, 80);
+                SetGuiElementBounds(&immediate, elements[0][element], bounds);
+                SetGuiElementBounds(&retained, elements[1][element], bounds);
+                break;
+            }
+            case 5:
+                // Idle frame.
+                break;
+        }
+        if (frame % 50 == 49) {
+            int element = TestRandom(60);
+            RemoveGuiElement(&immediate, elements[0][element]);
+            RemoveGuiElement(&retained, elements[1][element]);
+        }
+
+        UpdateGuiContainer(&immediate);
+        UpdateGuiContainer(&retained);
+        unsigned int immediateHash = TestDrawHash(&immediate);
+        long immediateRectangles = headless.rectanglesDrawn;
+        unsigned int retainedHash = TestDrawHash(&retained);
+        EXPECT(retainedHash == immediateHash);
+        EXPECT(headless.rectanglesDrawn == immediateRectangles);
+    }
+
+    UnloadGuiContainer(immediate);
+    UnloadGuiContainer(retained);
+}
+
+static void TestControlsDrawCacheMatchesImmediate(void) {
+    GuiContainer immediate = InitGuiContainer();
+    GuiContainer retained = InitGuiContainer();
+    EnableGuiContainerDrawCache(&retained);
+    GuiElement elements[7];
+    TestAddControls(&immediate, elements);
+    TestAddControls(&retained, elements);
+
+    // Run both through the same scripted input, typing and clicking as well as navigating.
+    int keys[] = { KEY_UP, KEY_RIGHT, KEY_DOWN, KEY_LEFT, KEY_ENTER, KEY_TAB, KEY_BACKSPACE };
+    for (int frame = 0; frame < 300; frame++) {
+        BeginHeadlessFrame();
+        switch (TestRandom(4)) {
+            case 0:
+                SetHeadlessKeyPressed(keys[TestRandom(7)]);
+                break;
+            case 1:
+                SetHeadlessCharPressed("x");
+                break;
+            case 2:
+                SetHeadlessMousePosition((Vector2){ (float)TestRandom(250), (float)TestRandom(320) });
+                break;
+            case 3:
+                SetHeadlessMouseButtonReleased(MOUSE_BUTTON_LEFT);
+                break;
+        }
+        UpdateGuiContainer(&immediate);
+        headless.charsRead = 0;
+        UpdateGuiContainer(&retained);
+        unsigned int immediateHash = TestDrawHash(&immediate);
+        EXPECT(TestDrawHash(&retained) == immediateHash);
+    }
+
+    UnloadGuiContainer(immediate);
+    UnloadGuiContainer(retained);
+}
+
+static void TestDrawCacheAllocations(void) {
+    GuiContainer container = InitGuiContainer();
+    EnableGuiContainerDrawCache(&container);
+    for (int i = 0; i < 100; i++) {
+        AddGuiButton(&container, (Rectangle){ (float)(i % 10) * 110, (float)(i / 10) * 40, 100, 30 }, "Button");
+    }
+
+    // Once both lists have grown, drawing doesn't allocate.
+    BeginHeadlessFrame();
+    SetHeadlessMousePosition((Vector2){ -10, -10 });
+    DrawGuiContainer(container);
+    DrawGuiContainer(container);
+    unsigned int hash = TestDrawHash(&container);
+    EXPECT(headless.allocations == 0);
+    EXPECT(TestDrawHash(&container) == hash);
+
+    UnloadGuiContainer(container);
+}
+
+/**
+ * A button above a scroll panel of rows, with another button to the right of the panel.
+ */
+static GuiContainer* TestAddRows(GuiContainer* container, int rows, GuiElement* elements) {
+    AddGuiButton(container, (Rectangle){ 20, 20, 200, 25 }, "Top");
+    GuiContainer* panel = AddGuiScrollPanel(container, (Rectangle){ 20, 60, 300, 200 }, NULL, (Rectangle){ 0, 0, 280, (float)rows * 30 });
+    AddGuiButton(container, (Rectangle){ 400, 100, 100, 25 }, "Right");
+    for (int i = 0; i < rows; i++) {
+        elements[i] = AddGuiButton(panel, (Rectangle){ 10, (float)i * 30, 200, 25 }, "Row");
+    }
+    return panel;
+}
+
+static void TestNestedNavigation(void) {
+    GuiContainer container = InitGuiContainer();
+    GuiElement rows[100];
+    GuiContainer* panel = TestAddRows(&container, 100, rows);
+    EXPECT(container.activeElement == 0);
+    EXPECT(panel->activeElement == -1);
+
+    // Moving down from the top button enters the panel.
+    TestPressKey(&container, KEY_DOWN);
+    EXPECT(GetGuiFocusedContainer(&container) == panel);
+    EXPECT(panel->activeElement == GetGuiElementIndex(panel, rows[0]));
+    EXPECT(container.activeElement == GetGuiElementIndex(&container, GetGuiContainerElement(panel)));
+
+    // Rows below the view are scrolled into it.
+    for (int i = 0; i < 20; i++) {
+        TestPressKey(&container, KEY_DOWN);
+    }
+    EXPECT(panel->activeElement == GetGuiElementIndex(panel, rows[20]));
+    Vector2 scroll = GetGuiContainerScroll(panel);
+    EXPECT(20 * 30 + 25 + scroll.y <= panel->group->view.height);
+    EXPECT(20 * 30 + scroll.y >= 0);
+
+    // The pressed row is in the panel.
+    TestPressKey(&container, KEY_ENTER);
+    EXPECT(IsGuiButtonPressed(panel, rows[20]));
+
+    // Nothing in the panel is to the right, so focus leaves it.
+    TestPressKey(&container, KEY_RIGHT);
+    EXPECT(GetGuiFocusedContainer(&container) == &container);
+    EXPECT(container.activeElement == 2);
+    EXPECT(panel->activeElement == -1);
+
+    // Coming back lands on a row in view.
+    TestPressKey(&container, KEY_LEFT);
+    EXPECT(GetGuiFocusedContainer(&container) == panel);
+    Rectangle bounds = panel->bounds[panel->activeElement];
+    EXPECT(bounds.y + scroll.y >= 0 && bounds.y + scroll.y < panel->group->view.height);
+
+    // Tab continues out of the end of the panel.
+    panel->activeElement = GetGuiElementIndex(panel, rows[99]);
+    TestPressKey(&container, KEY_TAB);
+    EXPECT(GetGuiFocusedContainer(&container) == &container);
+    EXPECT(container.activeElement == 2);
+    TestPressKey(&container, KEY_TAB);
+    TestPressKey(&container, KEY_TAB);
+    EXPECT(GetGuiFocusedContainer(&container) == panel);
+    EXPECT(panel->activeElement == GetGuiElementIndex(panel, rows[0]));
+
+    // A collapsed panel can't be navigated into.
+    SetGuiContainerCollapsed(panel, true);
+    EXPECT(GetGuiFocusedContainer(&container) == &container);
+    TestPressKey(&container, KEY_UP);
+    TestPressKey(&container, KEY_DOWN);
+    EXPECT(GetGuiFocusedContainer(&container) == &container);
+    EXPECT(container.activeElement == 2);
+    SetGuiContainerCollapsed(panel, false);
+    TestPressKey(&container, KEY_LEFT);
+    EXPECT(GetGuiFocusedContainer(&container) == panel);
+
+    UnloadGuiContainer(container);
+}
+
+static void TestNestedMouseHover(void) {
+    GuiContainer container = InitGuiContainer();
+    GuiElement rows[100];
+    GuiContainer* panel = TestAddRows(&container, 100, rows);
+    DrawGuiContainer(container);
+
+    // The mouse is over the rows as they're scrolled.
+    SetGuiContainerScroll(panel, (Vector2){ 0, -300 });
+    Rectangle view = panel->group->view;
+    BeginHeadlessFrame();
+    SetHeadlessMousePosition((Vector2){ view.x + 20, view.y + 5 });
+    UpdateGuiContainer(&container);
+    EXPECT(GetGuiFocusedContainer(&container) == panel);
+    EXPECT(panel->activeElement == GetGuiElementIndex(panel, rows[10]));
+
+    BeginHeadlessFrame();
+    SetHeadlessMouseButtonReleased(MOUSE_BUTTON_LEFT);
+    UpdateGuiContainer(&container);
+    EXPECT(IsGuiButtonPressed(panel, rows[10]));
+
+    // Rows scrolled out of the view can't be hovered, even where they'd overlap another element.
+    BeginHeadlessFrame();
+    SetHeadlessMousePosition((Vector2){ 30, 30 });
+    UpdateGuiContainer(&container);
+    EXPECT(GetGuiFocusedContainer(&container) == &container);
+    EXPECT(container.activeElement == 0);
+
+    UnloadGuiContainer(container);
+}
+
+static void TestScrollPanelCulling(void) {
+    // The cost of drawing a scroll panel depends on the rows in view, not on how many rows there are.
+    long rectangles[2];
+    int rowCounts[2] = { 50, 5000 };
+    for (int i = 0; i < 2; i++) {
+        GuiContainer container = InitGuiContainer();
+        GuiElement* rows = (GuiElement*)malloc(rowCounts[i] * sizeof(GuiElement));
+        GuiContainer* panel = TestAddRows(&container, rowCounts[i], rows);
+        SetGuiContainerScroll(panel, (Vector2){ 0, -600 });
+        BeginHeadlessFrame();
+        TestDrawHash(&container);
+        rectangles[i] = headless.rectanglesDrawn;
+
+        // Collapsing the panel skips everything in it.
+        SetGuiContainerCollapsed(panel, true);
+        TestDrawHash(&container);
+        EXPECT(headless.rectanglesDrawn < rectangles[i] / 4);
+
+        free(rows);
+        UnloadGuiContainer(container);
+    }
+    EXPECT(rectangles[0] == rectangles[1]);
+}
+
+static void TestNestedDrawCacheMatchesImmediate(void) {
+    // Two copies of a layout with nested panels, one drawn immediately and one through the draw cache.
+    GuiContainer containers[2];
+    GuiContainer* panels[2];
+    GuiElement rows[2][200];
+    for (int copy = 0; copy < 2; copy++) {
+        containers[copy] = InitGuiContainer();
+        if (copy == 1) {
+            EnableGuiContainerDrawCache(&containers[copy]);
+        }
+        panels[copy] = TestAddRows(&containers[copy], 200, rows[copy]);
+        GuiContainer* window = AddGuiWindowBox(&containers[copy], (Rectangle){ 350, 150, 200, 150 }, "Window");
+        AddCheckBox(window, (Rectangle){ 10, 10, 20, 20 }, "CheckBox", false);
+        GuiContainer* inner = AddGuiPanel(panels[copy], (Rectangle){ 220, 100, 50, 200 }, NULL);
+        AddGuiButton(inner, (Rectangle){ 5, 5, 40, 20 }, "Inner");
+    }
+
+    int keys[] = { KEY_UP, KEY_RIGHT, KEY_DOWN, KEY_LEFT, KEY_ENTER, KEY_TAB };
+    for (int frame = 0; frame < 500; frame++) {
+        BeginHeadlessFrame();
+        switch (TestRandom(5)) {
+            case 0:
+                SetHeadlessKeyPressed(keys[TestRandom(6)]);
+                break;
+            case 1:
+                SetHeadlessMousePosition((Vector2){ (float)TestRandom(600), (float)TestRandom(400) });
+                break;
+            case 2:
+                headless.mouseWheel = (float)TestRandom(5) - 2;
+                break;
+            case 3:
+                SetHeadlessMouseButtonReleased(MOUSE_BUTTON_LEFT);
+                break;
+        }
+        if (frame % 100 == 99) {
+            int row = TestRandom(200);
+            RemoveGuiElement(panels[0], rows[0][row]);
+            RemoveGuiElement(panels[1], rows[1][row]);
+        }
+
+        UpdateGuiContainer(&containers[0]);
+        UpdateGuiContainer(&containers[1]);
+        unsigned int immediateHash = TestDrawHash(&containers[0]);
+        unsigned int retainedHash = TestDrawHash(&containers[1]);
+        EXPECT(retainedHash == immediateHash);
+        EXPECT(GetGuiContainerScroll(panels[0]).y == GetGuiContainerScroll(panels[1]).y);
+    }
+
+    UnloadGuiContainer(containers[0]);
+    UnloadGuiContainer(containers[1]);
+}
+
+// The rows asked for by the list views, since the counter was last reset.
+static int testRowsRequested = 0;
+
+static int TestGetRowCount(void* userData) {
+    return *(int*)userData;
+}
+
+static const char* TestGetRowText(int row, void* userData) {
+    (void)userData;
+    static char text[32];
+    testRowsRequested++;
+    snprintf(text, sizeof(text), "Row %d", row);
+    return text;
+}
+
+static void TestListViewNavigation(void) {
+    int rowCount = 100000;
+    GuiContainer container = InitGuiContainer();
+    GuiElement top = AddGuiButton(&container, (Rectangle){ 20, 20, 200, 25 }, "Top");
+    GuiElement list = AddGuiListView(&container, (Rectangle){ 20, 60, 300, 200 }, TestGetRowCount, TestGetRowText, &rowCount);
+    GuiElement bottom = AddGuiButton(&container, (Rectangle){ 20, 300, 200, 25 }, "Bottom");
+    GuiList* rows = container.states[GetGuiElementIndex(&container, list)].list;
+    int visibleRows = GetGuiListVisibleRows(&container, (Rectangle){ 20, 60, 300, 200 });
+
+    // Moving down onto the list focuses its first row in view, and then moves between its rows, scrolling along.
+    TestPressKey(&container, KEY_DOWN);
+    EXPECT(container.activeElement == GetGuiElementIndex(&container, list));
+    EXPECT(rows->focus == 0);
+    for (int i = 0; i < 30; i++) {
+        TestPressKey(&container, KEY_DOWN);
+    }
+    EXPECT(rows->focus == 30);
+    EXPECT(rows->scrollIndex == 30 - visibleRows + 1);
+    TestPressKey(&container, KEY_ENTER);
+    EXPECT(GetGuiListViewActive(&container, list) == 30);
+
+    // A page at a time.
+    PushGuiContainerAction(&container, (GuiAction){ GUI_ACTION_ADJUST, 2, (Vector2){ 0, 0 }, 0 });
+    ProcessGuiContainerActions(&container);
+    EXPECT(rows->focus == 30 + 2 * visibleRows);
+
+    // Focus leaves from the first and last rows.
+    SetGuiListViewActive(&container, list, 0);
+    TestPressKey(&container, KEY_UP);
+    EXPECT(container.activeElement == GetGuiElementIndex(&container, top));
+    SetGuiListViewActive(&container, list, rowCount - 1);
+    EXPECT(rows->scrollIndex == rowCount - visibleRows);
+    TestPressKey(&container, KEY_DOWN);
+    EXPECT(rows->focus == rowCount - visibleRows);
+    TestPressKey(&container, KEY_RIGHT);
+    EXPECT(container.activeElement == GetGuiElementIndex(&container, list));
+    rows->focus = rowCount - 1;
+    TestPressKey(&container, KEY_DOWN);
+    EXPECT(container.activeElement == GetGuiElementIndex(&container, bottom));
+
+    // Moving up onto the list focuses its last row in view.
+    rows->scrollIndex = 500;
+    TestPressKey(&container, KEY_UP);
+    EXPECT(container.activeElement == GetGuiElementIndex(&container, list));
+    EXPECT(rows->focus == 500 + visibleRows - 1);
+
+    // Rows removed from the end are dropped from the selection.
+    rowCount = 10;
+    TestPressKey(&container, KEY_DOWN);
+    EXPECT(GetGuiListViewActive(&container, list) == -1);
+    EXPECT(container.activeElement == GetGuiElementIndex(&container, bottom));
+
+    UnloadGuiContainer(container);
+}
+
+static void TestListViewMouse(void) {
+    int rowCount = 1000;
+    GuiContainer container = InitGuiContainer();
+    GuiElement list = AddGuiListView(&container, (Rectangle){ 20, 60, 300, 200 }, TestGetRowCount, TestGetRowText, &rowCount);
+    SetGuiListViewActive(&container, list, 100);
+    SetGuiListViewActive(&container, list, -1);
+    GuiList* rows = container.states[GetGuiElementIndex(&container, list)].list;
+    int scrollIndex = rows->scrollIndex;
+
+    // Hovering a row focuses it, and clicking selects it.
+    float rowHeight = (float)(GuiGetStyle(LISTVIEW, LIST_ITEMS_HEIGHT) + GuiGetStyle(LISTVIEW, LIST_ITEMS_SPACING));
+    BeginHeadlessFrame();
+    SetHeadlessMousePosition((Vector2){ 100, 60 + 3.5f * rowHeight });
+    UpdateGuiContainer(&container);
+    EXPECT(rows->focus == scrollIndex + 3);
+    BeginHeadlessFrame();
+    SetHeadlessMouseButtonReleased(MOUSE_BUTTON_LEFT);
+    UpdateGuiContainer(&container);
+    EXPECT(GetGuiListViewActive(&container, list) == scrollIndex + 3);
+
+    // The mouse wheel scrolls the list as it's updated, rather than as it's drawn.
+    BeginHeadlessFrame();
+    SetHeadlessMouseWheel(2);
+    DrawGuiContainer(container);
+    EXPECT(rows->scrollIndex == scrollIndex);
+    UpdateGuiContainer(&container);
+    EXPECT(rows->scrollIndex == scrollIndex - 2);
+
+    // Holding the mouse down on the scroll bar scrolls to where it is, from the first row at the top of its track to
+    // halfway down the rows halfway down it.
+    float scrollBarX = 320.0f - (float)GuiGetStyle(LISTVIEW, BORDER_WIDTH) - (float)GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH) / 2;
+    float trackTop = 60.0f + (float)(GuiGetStyle(LISTVIEW, BORDER_WIDTH) + GuiGetStyle(SCROLLBAR, BORDER_WIDTH));
+    BeginHeadlessFrame();
+    SetHeadlessMousePosition((Vector2){ scrollBarX, trackTop });
+    SetHeadlessMouseButtonDown(MOUSE_BUTTON_LEFT);
+    DrawGuiContainer(container);
+    EXPECT(rows->scrollIndex == scrollIndex - 2);
+    UpdateGuiContainer(&container);
+    EXPECT(rows->scrollIndex == 0);
+    BeginHeadlessFrame();
+    SetHeadlessMousePosition((Vector2){ scrollBarX, 160 });
+    UpdateGuiContainer(&container);
+    int half = (rowCount - GetGuiListVisibleRows(&container, (Rectangle){ 20, 60, 300, 200 })) / 2;
+    EXPECT(rows->scrollIndex >= half - 2 && rows->scrollIndex <= half + 2);
+    BeginHeadlessFrame();
+    SetHeadlessMouseButtonReleased(MOUSE_BUTTON_LEFT);
+    UpdateGuiContainer(&container);
+
+    UnloadGuiContainer(container);
+}
+
+static void TestListViewDrawing(void) {
+    // The cost of drawing a list view depends on the rows in view, not on how many rows there are.
+    long rectangles[2];
+    int rowCounts[2] = { 100, 100000 };
+    for (int i = 0; i < 2; i++) {
+        int rowCount = rowCounts[i];
+        GuiContainer container = InitGuiContainer();
+        GuiElement list = AddGuiListView(&container, (Rectangle){ 20, 60, 300, 200 }, TestGetRowCount, TestGetRowText, &rowCount);
+        SetGuiListViewActive(&container, list, rowCount / 2);
+        BeginHeadlessFrame();
+        SetHeadlessMousePosition((Vector2){ -10, -10 });
+        TestDrawHash(&container);
+
+        testRowsRequested = 0;
+        TestDrawHash(&container);
+        rectangles[i] = headless.rectanglesDrawn;
+        EXPECT(testRowsRequested == GetGuiListVisibleRows(&container, (Rectangle){ 20, 60, 300, 200 }));
+        EXPECT(headless.allocations == 0);
+
+        UnloadGuiContainer(container);
+    }
+    EXPECT(rectangles[0] == rectangles[1]);
+}
+
+static void TestInputSources(void) {
+    // Two players, each with their own gamepad.
+    GuiContainer players[2];
+    for (int player = 0; player < 2; player++) {
+        players[player] = InitGuiContainer();
+        AddGuiButton(&players[player], (Rectangle){ 20, 20, 200, 20 }, "Top");
+        AddGuiButton(&players[player], (Rectangle){ 20, 60, 200, 20 }, "Bottom");
+        SetGuiContainerInputSource(&players[player], (GuiInputSource){ false, false, 1u << player });
+    }
+
+    BeginHeadlessFrame();
+    SetHeadlessGamepadButtonPressed(1, GAMEPAD_BUTTON_LEFT_FACE_DOWN);
+    SetHeadlessKeyPressed(KEY_DOWN);
+    SetHeadlessMousePosition((Vector2){ 30, 65 });
+    UpdateGuiContainer(&players[0]);
+    UpdateGuiContainer(&players[1]);
+    EXPECT(players[0].activeElement == 0);
+    EXPECT(players[1].activeElement == 1);
+    EXPECT(GetGuiContainerInputSource(&players[1]).gamepads == 2);
+
+    UnloadGuiContainer(players[0]);
+    UnloadGuiContainer(players[1]);
+}
+
+static void TestContainerStyles(void) {
+    GuiContainer plain = InitGuiContainer();
+    GuiContainer styled = InitGuiContainer();
+    GuiElement buttons[2];
+    buttons[0] = AddGuiButton(&plain, (Rectangle){ 20, 20, 200, 20 }, "Button");
+    buttons[1] = AddGuiButton(&styled, (Rectangle){ 20, 20, 200, 20 }, "Button");
+    BeginHeadlessFrame();
+    unsigned int plainHash = TestDrawHash(&plain);
+
+    // Overrides only apply while the container is drawn, including DEFAULT ones, which apply to every control.
+    int borderWidth = GuiGetStyle(BUTTON, BORDER_WIDTH);
+    int textColor = GuiGetStyle(LABEL, TEXT_COLOR_NORMAL);
+    EXPECT(SetGuiContainerStyle(&styled, BUTTON, BORDER_WIDTH, borderWidth + 3));
+    EXPECT(SetGuiContainerStyle(&styled, DEFAULT, TEXT_COLOR_NORMAL, 0x112233ff));
+    EXPECT(GetGuiContainerStyle(&styled, BUTTON, BORDER_WIDTH) == borderWidth + 3);
+    EXPECT(GetGuiContainerStyle(&styled, LISTVIEW, TEXT_COLOR_NORMAL) == 0x112233ff);
+    EXPECT(TestDrawHash(&styled) != plainHash);
+    EXPECT(GuiGetStyle(BUTTON, BORDER_WIDTH) == borderWidth);
+    EXPECT(GuiGetStyle(LABEL, TEXT_COLOR_NORMAL) == textColor);
+    EXPECT(TestDrawHash(&plain) == plainHash);
+
+    // Nested containers draw with the overrides of the containers they're in.
+    GuiContainer* panel = AddGuiPanel(&styled, (Rectangle){ 20, 60, 200, 200 }, NULL);
+    EXPECT(GetGuiContainerStyle(panel, BUTTON, BORDER_WIDTH) == borderWidth + 3);
+    SetGuiContainerStyle(panel, BUTTON, BORDER_WIDTH, borderWidth);
+    EXPECT(GetGuiContainerStyle(panel, BUTTON, BORDER_WIDTH) == borderWidth);
+    ClearGuiContainerStyles(&styled);
+    ClearGuiContainerStyles(panel);
+    RemoveGuiElement(&styled, GetGuiContainerElement(panel));
+    EXPECT(TestDrawHash(&styled) == plainHash);
+
+    // A locked container ignores input, and draws with raygui locked.
+    SetGuiContainerLocked(&styled, true);
+    EXPECT(IsGuiContainerLocked(&styled));
+    TestPressKey(&styled, KEY_ENTER);
+    EXPECT(!IsGuiButtonPressed(&styled, buttons[1]));
+    SetGuiContainerLocked(&styled, false);
+    SetGuiContainerAlpha(&styled, 0.5f);
+    EXPECT(TestDrawHash(&styled) != plainHash);
+    EXPECT(!guiLocked && guiAlpha == 1.0f && guiState == STATE_NORMAL);
+
+    UnloadGuiContainer(plain);
+    UnloadGuiContainer(styled);
+}
+
+static void TestElementText(void) {
+    // Text is copied into the container, and identical text is stored once.
+    GuiContainer container = InitGuiContainer();
+    char label[32] = "Start";
+    GuiElement buttons[3];
+    buttons[0] = AddGuiButton(&container, (Rectangle){ 20, 20, 200, 20 }, label);
+    buttons[1] = AddGuiButton(&container, (Rectangle){ 20, 50, 200, 20 }, "Start");
+    GuiElement slider = AddSlider(&container, (Rectangle){ 20, 80, 200, 20 }, "Less", NULL, 50, 0, 100);
+    strcpy(label, "Changed");
+    EXPECT(strcmp(GetGuiElementText(&container, buttons[0]), "Start") == 0);
+    EXPECT(GetGuiElementText(&container, buttons[0]) == GetGuiElementText(&container, buttons[1]));
+    SetGuiSliderText(&container, slider, "Left", "Right");
+    EXPECT(strcmp(GetGuiElementText(&container, slider), "Left") == 0);
+    EXPECT(strcmp(container.states[GetGuiElementIndex(&container, slider)].value.textRight, "Right") == 0);
+
+    // Text is only measured the first time it's drawn.
+    BeginHeadlessFrame();
+    unsigned int hash = TestDrawHash(&container);
+    EXPECT(headless.textsMeasured > 0);
+    EXPECT(TestDrawHash(&container) == hash);
+    EXPECT(headless.textsMeasured == 0);
+
+    // Changing the text size measures it again.
+    SetGuiContainerStyle(&container, DEFAULT, TEXT_SIZE, GuiGetStyle(DEFAULT, TEXT_SIZE) * 2);
+    EXPECT(TestDrawHash(&container) != hash);
+    EXPECT(headless.textsMeasured > 0);
+    ClearGuiContainerStyles(&container);
+    EXPECT(TestDrawHash(&container) == hash);
+
+    // Text that's no longer used is freed once it takes up more than the text that is, and the rest is kept.
+    buttons[2] = AddGuiButton(&container, (Rectangle){ 20, 110, 200, 20 }, "Counter");
+    for (int i = 0; i < 10000; i++) {
+        char counter[32];
+        snprintf(counter, sizeof(counter), "Counter %d", i);
+        SetGuiElementText(&container, buttons[2], counter);
+        EXPECT(container.strings->usedBytes <= container.strings->liveBytes + 2 * RAYGUI_CONTAINER_STRING_BLOCK_SIZE);
+    }
+    EXPECT(strcmp(GetGuiElementText(&container, buttons[2]), "Counter 9999") == 0);
+    EXPECT(strcmp(GetGuiElementText(&container, buttons[1]), "Start") == 0);
+    EXPECT(GetGuiElementText(&container, buttons[0]) == GetGuiElementText(&container, buttons[1]));
+    RemoveGuiElement(&container, buttons[2]);
+    EXPECT(TestDrawHash(&container) == hash);
+
+    UnloadGuiContainer(container);
+}
+
+static bool TestBoundsEqual(GuiContainer* container, GuiElement element, Rectangle bounds) {
+    Rectangle actual = container->bounds[GetGuiElementIndex(container, element)];
+    return actual.x == bounds.x && actual.y == bounds.y && actual.width == bounds.width && actual.height == bounds.height;
+}
+
+static void TestLayout(void) {
+    // A fixed header, a row of buttons sharing the width by weight, and a grid taking the rest of the height.
+    GuiContainer container = InitGuiContainer();
+    GuiLayout root = SetGuiContainerLayout(&container, GUI_LAYOUT_VERTICAL, (Rectangle){ 0, 0, 400, 300 });
+    SetGuiLayoutSpacing(&container, root, 10, 5);
+    GuiElement title = AddGuiButton(&container, (Rectangle){ 0 }, "Title");
+    AddGuiLayoutElement(&container, root, title, (GuiLayoutSize){ .min = 30 });
+    GuiLayout row = AddGuiLayout(&container, root, GUI_LAYOUT_HORIZONTAL, (GuiLayoutSize){ .min = 40 });
+    GuiLayout grid = AddGuiLayout(&container, root, GUI_LAYOUT_GRID, (GuiLayoutSize){ .weight = 1 });
+    SetGuiLayoutColumns(&container, grid, 3);
+    GuiElement buttons[3];
+    for (int i = 0; i < 3; i++) {
+        buttons[i] = AddGuiButton(&container, (Rectangle){ 0 }, "Button");
+        AddGuiLayoutElement(&container, row, buttons[i], (GuiLayoutSize){ .max = i == 0 ? 50.0f : 0, .weight = (float)(i + 1) });
+    }
+    GuiElement cells[7];
+    for (int i = 0; i < 7; i++) {
+        cells[i] = AddCheckBox(&container, (Rectangle){ 0 }, NULL, false);
+        AddGuiLayoutElement(&container, grid, cells[i], (GuiLayoutSize){ .min = 20 });
+    }
+    UpdateGuiContainer(&container);
+
+    EXPECT(TestBoundsEqual(&container, title, (Rectangle){ 10, 10, 380, 30 }));
+    EXPECT(TestBoundsEqual(&container, buttons[0], (Rectangle){ 10, 45, 50, 40 }));
+    EXPECT(TestBoundsEqual(&container, buttons[1], (Rectangle){ 60, 45, 132, 40 }));
+    EXPECT(TestBoundsEqual(&container, buttons[2], (Rectangle){ 192, 45, 198, 40 }));
+    EXPECT(TestBoundsEqual(&container, cells[0], (Rectangle){ 10, 90, 380.0f / 3, 20 }));
+    EXPECT(TestBoundsEqual(&container, cells[6], (Rectangle){ 10, 130, 380.0f / 3, 20 }));
+
+    // A pass with nothing changed visits nothing, and changing one element only visits its row and what moves in it.
+    ApplyGuiContainerLayout(&container);
+    EXPECT(container.layout->visited == 0);
+    SetGuiElementLayoutSize(&container, buttons[1], (GuiLayoutSize){ .min = 100 });
+    ApplyGuiContainerLayout(&container);
+    EXPECT(container.layout->visited == 3);
+    EXPECT(TestBoundsEqual(&container, buttons[1], (Rectangle){ 60, 45, 100, 40 }));
+    EXPECT(TestBoundsEqual(&container, buttons[2], (Rectangle){ 160, 45, 230, 40 }));
+    EXPECT(TestBoundsEqual(&container, title, (Rectangle){ 10, 10, 380, 30 }));
+
+    // Resizing only moves what the new size changes.
+    SetGuiContainerLayoutBounds(&container, (Rectangle){ 0, 0, 400, 400 });
+    ApplyGuiContainerLayout(&container);
+    EXPECT(container.layout->visited == 2);
+    SetGuiContainerLayoutBounds(&container, (Rectangle){ 0, 0, 700, 400 });
+    ApplyGuiContainerLayout(&container);
+    EXPECT(TestBoundsEqual(&container, title, (Rectangle){ 10, 10, 680, 30 }));
+    EXPECT(TestBoundsEqual(&container, buttons[2], (Rectangle){ 160, 45, 530, 40 }));
+
+    // Removing an element gives its space to the others.
+    RemoveGuiElement(&container, buttons[1]);
+    UpdateGuiContainer(&container);
+    EXPECT(TestBoundsEqual(&container, buttons[2], (Rectangle){ 60, 45, 630, 40 }));
+
+    // Text is fitted at the size it's drawn with.
+    GuiElement label = AddGuiButton(&container, (Rectangle){ 0 }, "Fits its text");
+    AddGuiLayoutElement(&container, row, label, (GuiLayoutSize){ .fitText = true });
+    UpdateGuiContainer(&container);
+    float width = container.bounds[GetGuiElementIndex(&container, label)].width;
+    EXPECT(width > 0);
+    SetGuiContainerStyle(&container, DEFAULT, TEXT_SIZE, GuiGetStyle(DEFAULT, TEXT_SIZE) * 2);
+    UpdateGuiContainer(&container);
+    EXPECT(container.bounds[GetGuiElementIndex(&container, label)].width > width);
+    SetGuiElementText(&container, label, "Fits");
+    UpdateGuiContainer(&container);
+    EXPECT(container.bounds[GetGuiElementIndex(&container, label)].width < width);
+
+    // A panel's layout fills the panel, and follows it as the panel is laid out.
+    GuiContainer* panel = AddGuiPanel(&container, (Rectangle){ 0 }, NULL);
+    AddGuiLayoutElement(&container, root, GetGuiContainerElement(panel), (GuiLayoutSize){ .min = 100 });
+    GuiLayout inside = SetGuiContainerLayout(panel, GUI_LAYOUT_VERTICAL, (Rectangle){ 0 });
+    GuiElement nested = AddGuiButton(panel, (Rectangle){ 0 }, "Nested");
+    AddGuiLayoutElement(panel, inside, nested, (GuiLayoutSize){ .weight = 1 });
+    UpdateGuiContainer(&container);
+    Rectangle view = panel->group->view;
+    EXPECT(TestBoundsEqual(panel, nested, (Rectangle){ 0, 0, view.width, view.height }));
+    EXPECT(view.width > 600);
+    SetGuiContainerLayoutBounds(&container, (Rectangle){ 0, 0, 300, 400 });
+    UpdateGuiContainer(&container);
+    EXPECT(TestBoundsEqual(panel, nested, (Rectangle){ 0, 0, panel->group->view.width, view.height }));
+    EXPECT(panel->group->view.width < 300);
+
+    // Clearing the layout leaves the elements where they are.
+    ClearGuiContainerLayout(&container);
+    SetGuiContainerLayoutBounds(&container, (Rectangle){ 0, 0, 100, 100 });
+    UpdateGuiContainer(&container);
+    EXPECT(TestBoundsEqual(&container, title, (Rectangle){ 10, 10, 280, 30 }));
+
+    UnloadGuiContainer(container);
+}
+
+static void TestContainerFile(void) {
+    long liveBlocks = headless.liveBlocks;
+
+    // A removed element leaves a free handle index in the file, and the text needs escaping in the text format.
+    GuiContainer container = InitGuiContainer();
+    GuiElement play = AddGuiButton(&container, (Rectangle){ 20, 20, 120, 30 }, "Play");
+    GuiElement removed = AddGuiButton(&container, (Rectangle){ 200, 20, 120, 30 }, "Removed");
+    GuiElement fullscreen = AddCheckBox(&container, (Rectangle){ 20, 60, 20, 20 }, "Full \"screen\"\n", true);
+    GuiElement volume = AddSlider(&container, (Rectangle){ 20, 100, 200, 20 }, "Volume", NULL, 0.5f, 0, 1);
+    GuiElement quit = AddGuiButton(&container, (Rectangle){ 20, 140, 120, 30 }, "Play");
+    RemoveGuiElement(&container, removed);
+    EXPECT(ExportGuiContainer(&container, "raygui-container-test.rgc"));
+    EXPECT(ExportGuiContainerText(&container, "raygui-container-test.txt"));
+
+    // Loading takes the same few allocations however many elements there are, plus the buffer the file is read into
+    // when it can't be mapped, and the navigation comes precomputed.
+    ResetHeadlessCounters();
+    GuiContainer loaded = LoadGuiContainer("raygui-container-test.rgc");
+#if defined(RAYGUI_CONTAINER_MMAP)
+    EXPECT(headless.allocations <= 8);
+#else
+    EXPECT(headless.allocations <= 9);
+#endif
+    EXPECT(loaded.file != NULL && loaded.file->shared);
+    EXPECT(loaded.count == 4);
+    EXPECT(IsGuiElementValid(&loaded, play) && IsGuiElementValid(&loaded, quit) && !IsGuiElementValid(&loaded, removed));
+    EXPECT(TestBoundsEqual(&loaded, volume, (Rectangle){ 20, 100, 200, 20 }));
+    EXPECT(strcmp(GetGuiElementText(&loaded, fullscreen), "Full \"screen\"\n") == 0);
+    EXPECT(GetGuiElementText(&loaded, play) == GetGuiElementText(&loaded, quit));
+    EXPECT(IsGuiCheckBoxChecked(&loaded, fullscreen));
+    EXPECT(GetGuiSliderValue(&loaded, volume) == 0.5f);
+    EXPECT(loaded.navigation->cached[play.index] == 0x1F);
+    TestPressKey(&loaded, KEY_DOWN);
+    EXPECT(loaded.activeElement == GetGuiElementIndex(&loaded, fullscreen));
+
+    // The text format builds the same elements, in the same order.
+    GuiContainer text = LoadGuiContainerText("raygui-container-test.txt");
+    EXPECT(text.count == loaded.count);
+    for (int i = 0; i < text.count && i < loaded.count; i++) {
+        GuiElement element = GetGuiElementAt(&text, i);
+        EXPECT(text.types[i] == loaded.types[i]);
+        EXPECT(TestBoundsEqual(&text, element, loaded.bounds[i]));
+        EXPECT(strcmp(GetGuiElementText(&text, element), GetGuiElementText(&loaded, GetGuiElementAt(&loaded, i))) == 0);
+    }
+    EXPECT(GetGuiSliderValue(&text, GetGuiElementAt(&text, 3)) == 0.5f);
+    EXPECT(text.states[3].value.textRight == NULL);
+    UnloadGuiContainer(text);
+
+    // The elements stay in the file until the container grows, and the strings until it gets new text.
+    AddGuiButton(&loaded, (Rectangle){ 200, 20, 120, 30 }, "Play");
+    EXPECT(loaded.file->shared && loaded.strings->mapped);
+    GuiElement added = AddGuiButton(&loaded, (Rectangle){ 200, 60, 120, 30 }, "Added");
+    EXPECT(!loaded.file->shared && !loaded.strings->mapped);
+    EXPECT(strcmp(GetGuiElementText(&loaded, fullscreen), "Full \"screen\"\n") == 0);
+    EXPECT(strcmp(GetGuiElementText(&loaded, added), "Added") == 0);
+    RemoveGuiElement(&loaded, play);
+    SetGuiElementText(&loaded, quit, "Quit");
+    EXPECT(strcmp(GetGuiElementText(&loaded, quit), "Quit") == 0);
+    UnloadGuiContainer(loaded);
+
+    // Files that aren't container files load as empty containers, and nested containers can't be saved.
+    GuiContainer invalid = LoadGuiContainer("raygui-container-test.txt");
+    EXPECT(invalid.count == 0 && invalid.file == NULL);
+    UnloadGuiContainer(invalid);
+    AddGuiPanel(&container, (Rectangle){ 200, 200, 100, 100 }, NULL);
+    EXPECT(!ExportGuiContainer(&container, "raygui-container-test.rgc"));
+    EXPECT(!ExportGuiContainerText(&container, "raygui-container-test.txt"));
+    UnloadGuiContainer(container);
+
+    remove("raygui-container-test.rgc");
+    remove("raygui-container-test.txt");
+    EXPECT(headless.liveBlocks == liveBlocks);
+}
+
+/**
+ * Save a copy of a container file with a value written over it at the given offset, and check that it's rejected.
+ */
+static void TestLoadCorruptedFile(const unsigned char* data, size_t size, size_t offset, const void* value, size_t valueSize) {
+    unsigned char* corrupted = (unsigned char*)malloc(size);
+    memcpy(corrupted, data, size);
+    memcpy(corrupted + offset, value, valueSize);
+    FILE* file = fopen("raygui-container-test.rgc", "wb");
+    fwrite(corrupted, 1, size, file);
+    fclose(file);
+    free(corrupted);
+
+    GuiContainer loaded = LoadGuiContainer("raygui-container-test.rgc");
+    if (loaded.count != 0 || loaded.file != NULL) {
+        printf("Corrupted container file at offset %d loaded\n", (int)offset);
+    }
+    EXPECT(loaded.count == 0 && loaded.file == NULL);
+    UnloadGuiContainer(loaded);
+}
+
+static void TestContainerFileCorrupted(void) {
+    long liveBlocks = headless.liveBlocks;
+
+    GuiContainer container = InitGuiContainer();
+    AddGuiButton(&container, (Rectangle){ 20, 20, 120, 30 }, "Play");
+    AddCheckBox(&container, (Rectangle){ 20, 60, 20, 20 }, "Fullscreen", true);
+    AddSlider(&container, (Rectangle){ 20, 100, 200, 20 }, "Volume", "Loud", 0.5f, 0, 1);
+    EXPECT(ExportGuiContainer(&container, "raygui-container-test.rgc"));
+    UnloadGuiContainer(container);
+
+    FILE* file = fopen("raygui-container-test.rgc", "rb");
+    fseek(file, 0, SEEK_END);
+    size_t size = (size_t)ftell(file);
+    fseek(file, 0, SEEK_SET);
+    unsigned char* data = (unsigned char*)malloc(size);
+    EXPECT(fread(data, 1, size, file) == size);
+    fclose(file);
+    GuiContainerFileHeader header;
+    memcpy(&header, data, sizeof(header));
+    const unsigned int* sections = header.sections;
+
+    // The untouched file loads.
+    GuiContainer loaded = LoadGuiContainer("raygui-container-test.rgc");
+    EXPECT(loaded.count == 3 && loaded.file != NULL);
+    UnloadGuiContainer(loaded);
+
+    // Element types past the last one, and types that can't be saved.
+    unsigned char type = 200;
+    TestLoadCorruptedFile(data, size, sections[GUI_FILE_TYPES], &type, sizeof(type));
+    type = GUI_TYPE_TEXTBOX;
+    TestLoadCorruptedFile(data, size, sections[GUI_FILE_TYPES], &type, sizeof(type));
+    unsigned char flags = GUI_ELEMENT_SELECTABLE | GUI_ELEMENT_GROUP;
+    TestLoadCorruptedFile(data, size, sections[GUI_FILE_FLAGS], &flags, sizeof(flags));
+
+    // Text offsets outside of the text, for an element's text, the text right of a slider, and an interned string.
+    const char* offset = (const char*)(uintptr_t)0x7fffffff;
+    TestLoadCorruptedFile(data, size, sections[GUI_FILE_STATES] + offsetof(GuiElementState, text), &offset, sizeof(offset));
+    TestLoadCorruptedFile(data, size, sections[GUI_FILE_STATES] + 2 * sizeof(GuiElementState) + offsetof(GuiElementState, value.textRight), &offset, sizeof(offset));
+    TestLoadCorruptedFile(data, size, sections[GUI_FILE_STRINGS] + offsetof(GuiString, text), &offset, sizeof(offset));
+    int length = header.textSize;
+    TestLoadCorruptedFile(data, size, sections[GUI_FILE_STRINGS] + offsetof(GuiString, length), &length, sizeof(length));
+    int string = header.stringCount;
+    TestLoadCorruptedFile(data, size, sections[GUI_FILE_TABLE], &string, sizeof(string));
+
+    // Text that doesn't end with a terminator.
+    char unterminated = 'x';
+    TestLoadCorruptedFile(data, size, sections[GUI_FILE_TEXT] + header.textSize - 1, &unterminated, sizeof(unterminated));
+
+    // Handle indices outside of the capacity, and a focused element before the first.
+    int slot = header.capacity;
+    TestLoadCorruptedFile(data, size, sections[GUI_FILE_IDS], &slot, sizeof(slot));
+    TestLoadCorruptedFile(data, size, sections[GUI_FILE_SLOTS], &slot, sizeof(slot));
+    TestLoadCorruptedFile(data, size, offsetof(GuiContainerFileHeader, freeSlot), &slot, sizeof(slot));
+    slot = -2;
+    TestLoadCorruptedFile(data, size, sections[GUI_FILE_SLOTS], &slot, sizeof(slot));
+    TestLoadCorruptedFile(data, size, offsetof(GuiContainerFileHeader, freeSlot), &slot, sizeof(slot));
+    TestLoadCorruptedFile(data, size, offsetof(GuiContainerFileHeader, activeElement), &slot, sizeof(slot));
+
+    // Elements whose handle index doesn't lead back to them, and a free list that would hand out an element's.
+    int id;
+    memcpy(&id, data + sections[GUI_FILE_IDS], sizeof(id));
+    TestLoadCorruptedFile(data, size, sections[GUI_FILE_IDS] + sizeof(int), &id, sizeof(id));
+    TestLoadCorruptedFile(data, size, offsetof(GuiContainerFileHeader, freeSlot), &id, sizeof(id));
+
+    // Cached navigation that leads outside of the elements, and an open list that doesn't agree with its positions.
+    int neighbours[4] = { 50000000, 50000000, 50000000, 50000000 };
+    TestLoadCorruptedFile(data, size, sections[GUI_FILE_NEIGHBOURS], neighbours, sizeof(neighbours));
+    TestLoadCorruptedFile(data, size, sections[GUI_FILE_TAB_NEXT], neighbours, sizeof(int));
+    int open = header.navigation.openCount;
+    TestLoadCorruptedFile(data, size, sections[GUI_FILE_OPEN_INDEX], &open, sizeof(open));
+    open = header.capacity + 1;
+    TestLoadCorruptedFile(data, size, offsetof(GuiContainerFileHeader, navigation.openCount), &open, sizeof(open));
+
+    // A spatial index with elements outside of the elements, missing, linked in a loop, or in the wrong bucket.
+    int bucketCount = header.spatialIndex.bucketMask + 1;
+    int* buckets = (int*)malloc(bucketCount * sizeof(int));
+    for (int i = 0; i < bucketCount; i++) {
+        buckets[i] = 50000000;
+    }
+    TestLoadCorruptedFile(data, size, sections[GUI_FILE_BUCKETS], buckets, bucketCount * sizeof(int));
+    for (int i = 0; i < bucketCount; i++) {
+        buckets[i] = -1;
+    }
+    TestLoadCorruptedFile(data, size, sections[GUI_FILE_BUCKETS], buckets, bucketCount * sizeof(int));
+    free(buckets);
+    TestLoadCorruptedFile(data, size, sections[GUI_FILE_NEXT] + id * sizeof(int), &id, sizeof(id));
+    TestLoadCorruptedFile(data, size, sections[GUI_FILE_PREV] + id * sizeof(int), neighbours, sizeof(int));
+    int count = header.count + 1;
+    TestLoadCorruptedFile(data, size, offsetof(GuiContainerFileHeader, spatialIndex.count), &count, sizeof(count));
+    GuiSpatialIndex index = header.spatialIndex;
+    int cellX, cellY;
+    memcpy(&cellX, data + sections[GUI_FILE_CELL_X] + id * sizeof(int), sizeof(cellX));
+    memcpy(&cellY, data + sections[GUI_FILE_CELL_Y] + id * sizeof(int), sizeof(cellY));
+    int bucket = GetGuiSpatialIndexBucket(&index, cellX, cellY);
+    while (GetGuiSpatialIndexBucket(&index, cellX, cellY) == bucket) {
+        cellX++;
+    }
+    TestLoadCorruptedFile(data, size, sections[GUI_FILE_CELL_X] + id * sizeof(int), &cellX, sizeof(cellX));
+
+    free(data);
+    remove("raygui-container-test.rgc");
+    EXPECT(headless.liveBlocks == liveBlocks);
+}
+
+#if defined(RAYGUI_CONTAINER_TEST_THREADS)
+#include <pthread.h>
+
+#define TEST_THREAD_COUNT 4
+#define TEST_THREAD_CONTAINERS 8
+
+typedef struct TestUpdateJob {
+    GuiContainer* containers;
+    int start;
+    int end;
+} TestUpdateJob;
+
+static void* TestUpdateContainers(void* data) {
+    TestUpdateJob* job = (TestUpdateJob*)data;
+    for (int i = job->start; i < job->end; i++) {
+        UpdateGuiContainer(job->containers + i);
+    }
+    return NULL;
+}
+
+static void TestThreadedUpdates(void) {
+    // One container per player, each with its own gamepad. Player 0 also has the keyboard and mouse.
+    int rowCount = 100000;
+    GuiContainer containers[2][TEST_THREAD_CONTAINERS];
+    for (int copy = 0; copy < 2; copy++) {
+        for (int i = 0; i < TEST_THREAD_CONTAINERS; i++) {
+            GuiContainer* container = &containers[copy][i];
+            GuiElement rows[200];
+            *container = InitGuiContainer();
+            TestAddRows(container, 200, rows);
+            AddGuiListView(container, (Rectangle){ 400, 150, 200, 200 }, TestGetRowCount, TestGetRowText, &rowCount);
+            AddSlider(container, (Rectangle){ 400, 400, 200, 20 }, "Less", "More", 50, 0, 100);
+            SetGuiContainerInputSource(container, (GuiInputSource){ i == 0, i == 0, 1u << (i % HEADLESS_MAX_GAMEPADS) });
+            SetGuiContainerStyle(container, DEFAULT, BORDER_WIDTH, 1 + i % 3);
+        }
+    }
+
+    // Update the first copy on worker threads, and the second on this one. Both have to draw the same.
+    int buttons[] = { GAMEPAD_BUTTON_LEFT_FACE_UP, GAMEPAD_BUTTON_LEFT_FACE_RIGHT, GAMEPAD_BUTTON_LEFT_FACE_DOWN,
+        GAMEPAD_BUTTON_LEFT_FACE_LEFT, GAMEPAD_BUTTON_RIGHT_FACE_DOWN, GAMEPAD_BUTTON_RIGHT_TRIGGER_1 };
+    int keys[] = { KEY_UP, KEY_RIGHT, KEY_DOWN, KEY_LEFT, KEY_ENTER, KEY_TAB };
+    for (int frame = 0; frame < 300; frame++) {
+        BeginHeadlessFrame();
+        for (int gamepad = 0; gamepad < HEADLESS_MAX_GAMEPADS; gamepad++) {
+            SetHeadlessGamepadButtonPressed(gamepad, buttons[TestRandom(6)]);
+        }
+        SetHeadlessKeyPressed(keys[TestRandom(6)]);
+        if (TestRandom(4) == 0) {
+            SetHeadlessMousePosition((Vector2){ (float)TestRandom(600), (float)TestRandom(400) });
+        }
+
+        pthread_t threads[TEST_THREAD_COUNT];
+        TestUpdateJob jobs[TEST_THREAD_COUNT];
+        for (int thread = 0; thread < TEST_THREAD_COUNT; thread++) {
+            jobs[thread] = (TestUpdateJob){ containers[0], thread * TEST_THREAD_CONTAINERS / TEST_THREAD_COUNT, (thread + 1) * TEST_THREAD_CONTAINERS / TEST_THREAD_COUNT };
+            pthread_create(&threads[thread], NULL, TestUpdateContainers, &jobs[thread]);
+        }
+        TestUpdateJob job = { containers[1], 0, TEST_THREAD_CONTAINERS };
+        TestUpdateContainers(&job);
+        for (int thread = 0; thread < TEST_THREAD_COUNT; thread++) {
+            pthread_join(threads[thread], NULL);
+        }
+
+        for (int i = 0; i < TEST_THREAD_CONTAINERS; i++) {
+            EXPECT(TestDrawHash(&containers[0][i]) == TestDrawHash(&containers[1][i]));
+        }
+    }
+
+    for (int copy = 0; copy < 2; copy++) {
+        for (int i = 0; i < TEST_THREAD_CONTAINERS; i++) {
+            UnloadGuiContainer(containers[copy][i]);
+        }
+    }
+}
+#endif
+
+static int testCallbackCount = 0;
+static GuiEvent testCallbackEvent;
+
+static void TestEventCallback(const GuiEvent* event) {
+    testCallbackCount++;
+    testCallbackEvent = *event;
+}
+
+static void TestEvents(void) {
+    GuiContainer container = InitGuiContainer();
+    GuiElement play = AddGuiButton(&container, (Rectangle){ 0, 0, 200, 30 }, "Play");
+    GuiElement sound = AddCheckBox(&container, (Rectangle){ 90, 40, 20, 20 }, "Sound", false);
+    GuiElement volume = AddSlider(&container, (Rectangle){ 0, 80, 200, 20 }, "Volume", NULL, 50, 0, 100);
+    GuiContainer* panel = AddGuiPanel(&container, (Rectangle){ 0, 120, 200, 100 }, "Panel");
+    GuiElement nested = AddGuiButton(panel, (Rectangle){ 0, 0, 100, 30 }, "Nested");
+    static const char* playMessage = "Play";
+    SetGuiElementUserData(&container, play, (void*)playMessage);
+    SetGuiElementCallback(&container, sound, TestEventCallback);
+    EXPECT(GetGuiElementUserData(&container, play) == playMessage);
+    EXPECT(GetGuiElementUserData(&container, sound) == NULL);
+
+    // Pressing a button lists it along with its user data.
+    int count;
+    TestPressKey(&container, KEY_ENTER);
+    const GuiEvent* events = GetGuiContainerEvents(&container, &count);
+    EXPECT(count == 1);
+    EXPECT(events[0].type == GUI_EVENT_PRESSED && events[0].container == &container);
+    EXPECT(events[0].element.index == play.index && events[0].element.generation == play.generation);
+    EXPECT(events[0].userData == playMessage);
+
+    // The list only lasts until the next update.
+    TestPressKey(&container, KEY_DOWN);
+    events = GetGuiContainerEvents(&container, &count);
+    EXPECT(count == 1 && events[0].type == GUI_EVENT_FOCUS_CHANGED && events[0].element.index == sound.index);
+    BeginHeadlessFrame();
+    UpdateGuiContainer(&container);
+    GetGuiContainerEvents(&container, &count);
+    EXPECT(count == 0);
+
+    // The check box's callback is called with each of its events: taking focus, and being toggled.
+    EXPECT(testCallbackCount == 1 && testCallbackEvent.type == GUI_EVENT_FOCUS_CHANGED);
+    TestPressKey(&container, KEY_ENTER);
+    events = GetGuiContainerEvents(&container, &count);
+    EXPECT(count == 1 && events[0].type == GUI_EVENT_TOGGLED && events[0].oldValue == 0 && events[0].newValue == 1);
+    EXPECT(testCallbackCount == 2);
+    EXPECT(testCallbackEvent.type == GUI_EVENT_TOGGLED && testCallbackEvent.element.index == sound.index);
+
+    // Adjusting a slider gives the value before and after, unless it's already at its max.
+    TestPressKey(&container, KEY_DOWN);
+    TestPressKey(&container, KEY_ENTER);
+    TestPressKey(&container, KEY_RIGHT);
+    events = GetGuiContainerEvents(&container, &count);
+    EXPECT(count == 1 && events[0].type == GUI_EVENT_VALUE_CHANGED && events[0].element.index == volume.index);
+    EXPECT(count == 1 && events[0].oldValue == 50 && events[0].newValue == 55);
+    for (int i = 0; i < 10; i++) {
+        TestPressKey(&container, KEY_RIGHT);
+    }
+    EXPECT(GetGuiSliderValue(&container, volume) == 100);
+    GetGuiContainerEvents(&container, &count);
+    EXPECT(count == 0);
+
+    // Focus moving into a nested container is listed in the root container, with the nested container.
+    TestPressKey(&container, KEY_ENTER);
+    TestPressKey(&container, KEY_DOWN);
+    events = GetGuiContainerEvents(panel, &count);
+    EXPECT(count == 1 && events[0].type == GUI_EVENT_FOCUS_CHANGED && events[0].container == panel);
+    EXPECT(count == 1 && events[0].element.index == nested.index);
+    EXPECT(testCallbackCount == 2);
+
+    // A new element doesn't inherit the callback or user data of the one whose handle index it reuses.
+    RemoveGuiElement(&container, sound);
+    GuiElement reused = AddCheckBox(&container, (Rectangle){ 300, 40, 20, 20 }, "Reused", false);
+    EXPECT(reused.index == sound.index);
+    FocusGuiElement(&container, GetGuiElementIndex(&container, reused));
+    TestPressKey(&container, KEY_ENTER);
+    events = GetGuiContainerEvents(&container, &count);
+    EXPECT(count == 1 && events[0].type == GUI_EVENT_TOGGLED && events[0].userData == NULL);
+    EXPECT(testCallbackCount == 2);
+
+    // Clicking a check box toggles it once, and it ends the frame the way its event says, once it's drawn.
+    BeginHeadlessFrame();
+    SetHeadlessMousePosition((Vector2){ 310, 50 });
+    SetHeadlessMouseButtonDown(MOUSE_BUTTON_LEFT);
+    UpdateGuiContainer(&container);
+    DrawGuiContainer(container);
+    BeginHeadlessFrame();
+    SetHeadlessMouseButtonReleased(MOUSE_BUTTON_LEFT);
+    UpdateGuiContainer(&container);
+    events = GetGuiContainerEvents(&container, &count);
+    EXPECT(count == 1 && events[0].type == GUI_EVENT_TOGGLED && events[0].oldValue == 1 && events[0].newValue == 0);
+    DrawGuiContainer(container);
+    EXPECT(!IsGuiCheckBoxChecked(&container, reused));
+    UnloadGuiContainer(container);
+}
+
+static void TestProfile(void) {
+    GuiContainer container = InitGuiContainer();
+    GuiElement first = AddGuiButton(&container, (Rectangle){ 20, 0, 200, 30 }, "Button");
+    for (int i = 1; i < 10; i++) {
+        AddGuiButton(&container, (Rectangle){ 20, (float)i * 40, 200, 30 }, "Button");
+    }
+    GuiContainer* panel = AddGuiPanel(&container, (Rectangle){ 300, 0, 200, 200 }, "Panel");
+    AddGuiButton(panel, (Rectangle){ 0, 0, 100, 30 }, "Nested");
+    EXPECT(panel->profile == NULL);
+
+    // Moving down searches for each neighbour the first time, and uses the navigation graph after that.
+    for (int i = 0; i < 3; i++) {
+        TestPressKey(&container, KEY_DOWN);
+    }
+    FocusGuiElement(&container, GetGuiElementIndex(&container, first));
+    for (int i = 0; i < 3; i++) {
+        TestPressKey(&container, KEY_DOWN);
+    }
+    GuiProfileCounters counters = GetGuiContainerCounters(&container);
+    EXPECT(counters.updates == 6);
+    EXPECT(counters.actions == 6);
+    EXPECT(counters.navigationQueries >= 6);
+    EXPECT(counters.navigationSearches >= 3 && counters.navigationSearches < counters.navigationQueries);
+    EXPECT(counters.phaseTime[GUI_PHASE_UPDATE] > 0);
+    EXPECT(counters.phaseTime[GUI_PHASE_UPDATE] >= counters.phaseTime[GUI_PHASE_ACTIONS]);
+
+    // Hit-testing goes through the panel's elements, and nested containers count towards their root container. The
+    // panel itself isn't drawn through DrawGuiElement().
+    BeginHeadlessFrame();
+    SetHeadlessMousePosition((Vector2){ 450, 150 });
+    UpdateGuiContainer(&container);
+    DrawGuiContainer(container);
+    counters = GetGuiContainerCounters(panel);
+    EXPECT(counters.draws == 1);
+    EXPECT(counters.elementsHitTested == container.count + panel->count);
+    EXPECT(counters.elementsVisible == container.count + panel->count);
+    EXPECT(counters.elementsDrawn == container.count - 1 + panel->count);
+
+    // Every timed phase ends up in the trace.
+    EXPECT(ExportGuiContainerTrace(&container, "raygui-container-test.json"));
+    char* trace = (char*)calloc(1 << 20, 1);
+    FILE* file = fopen("raygui-container-test.json", "r");
+    EXPECT(file != NULL && fread(trace, 1, (1 << 20) - 1, file) > 0);
+    EXPECT(strncmp(trace, "{\"traceEvents\":[", 16) == 0);
+    EXPECT(strstr(trace, "\"name\":\"FindGuiElementFromBounds\"") != NULL);
+    EXPECT(strstr(trace, "\"name\":\"FindGuiElementAtScreenPoint\"") != NULL);
+    EXPECT(strstr(trace, "\"name\":\"DrawGuiContainer\"") != NULL);
+    EXPECT(strstr(trace, "\"elementsDrawn\":") != NULL);
+    if (file != NULL) {
+        fclose(file);
+    }
+    free(trace);
+    remove("raygui-container-test.json");
+
+    ResetGuiContainerCounters(&container);
+    counters = GetGuiContainerCounters(&container);
+    EXPECT(counters.updates == 0 && counters.draws == 0 && counters.phaseTime[GUI_PHASE_UPDATE] == 0);
+    EXPECT(container.profile->eventCount == 0);
+    UnloadGuiContainer(container);
+}
+
+static bool TestRectanglesEqual(Rectangle a, Rectangle b) {
+    return a.x == b.x && a.y == b.y && a.width == b.width && a.height == b.height;
+}
+
+static void TestAnimation(void) {
+    long liveBlocks = headless.liveBlocks;
+    GuiContainer container = InitGuiContainer();
+    GuiElement top = AddGuiButton(&container, (Rectangle){ 20, 20, 200, 20 }, "Top");
+    GuiElement bottom = AddGuiButton(&container, (Rectangle){ 20, 120, 200, 20 }, "Bottom");
+    GuiContainer* panel = AddGuiPanel(&container, (Rectangle){ 300, 20, 200, 200 }, NULL);
+    GuiElement nested = AddGuiButton(panel, (Rectangle){ 0, 0, 100, 20 }, "Nested");
+
+    // Nothing is allocated for a container that's never animated.
+    TestPressKey(&container, KEY_DOWN);
+    DrawGuiContainer(container);
+    EXPECT(container.animation == NULL && panel->animation == NULL);
+    EXPECT(!IsGuiContainerAnimating(&container));
+
+    // The focus highlight appears on the focused element, and slides to the next one over RAYGUI_CONTAINER_FOCUS_TIME.
+    EnableGuiContainerAnimation(&container);
+    TestPressKey(&container, KEY_UP);
+    EXPECT(container.animation->focusShown && TestRectanglesEqual(container.animation->focusBounds, container.bounds[0]));
+    TestPressKey(&container, KEY_DOWN);
+    Rectangle bounds = container.animation->focusBounds;
+    EXPECT(IsGuiContainerAnimating(&container));
+    EXPECT(bounds.y > 20 && bounds.y < 120);
+    for (int frame = 0; frame < (int)(RAYGUI_CONTAINER_FOCUS_TIME * 60) + 1; frame++) {
+        BeginHeadlessFrame();
+        UpdateGuiContainer(&container);
+    }
+    EXPECT(TestRectanglesEqual(container.animation->focusBounds, container.bounds[GetGuiElementIndex(&container, bottom)]));
+    EXPECT(!IsGuiContainerAnimating(&container));
+
+    // Pressing an element pulses it, and the pulse ends on its own.
+    TestPressKey(&container, KEY_ENTER);
+    EXPECT(container.animation->tweenCount == 1 && container.animation->tweens[0].type == GUI_TWEEN_PULSE);
+    unsigned int pulsing = TestDrawHash(&container);
+    for (int frame = 0; frame < (int)(RAYGUI_CONTAINER_PULSE_TIME * 60) + 1; frame++) {
+        BeginHeadlessFrame();
+        UpdateGuiContainer(&container);
+    }
+    EXPECT(!IsGuiContainerAnimating(&container));
+    EXPECT(TestDrawHash(&container) != pulsing);
+
+    // A fade goes from the element's alpha to the one given, and stays there. It changes what's drawn.
+    unsigned int opaque = TestDrawHash(&container);
+    FadeGuiElement(&container, top, 0, 0.5f);
+    FadeGuiElement(panel, nested, 0.5f, 0.5f);
+    EXPECT(container.animation->tweenCount == 2 && panel->animation->alphas != NULL);
+    SetHeadlessFrameTime(0.25f);
+    BeginHeadlessFrame();
+    UpdateGuiContainer(&container);
+    float alpha = GetGuiElementAlpha(&container, top);
+    EXPECT(alpha > 0 && alpha < 1);
+    EXPECT(GetGuiElementAlpha(panel, nested) > 0.5f && GetGuiElementAlpha(panel, nested) < 1);
+    BeginHeadlessFrame();
+    UpdateGuiContainer(&container);
+    SetHeadlessFrameTime(1.0f / 60.0f);
+    EXPECT(GetGuiElementAlpha(&container, top) == 0 && GetGuiElementAlpha(panel, nested) == 0.5f);
+    EXPECT(GetGuiElementAlpha(&container, bottom) == 1);
+    EXPECT(!IsGuiContainerAnimating(&container));
+    EXPECT(TestDrawHash(&container) != opaque);
+    FadeGuiElement(&container, top, 1, 0);
+    FadeGuiElement(panel, nested, 1, 0);
+    EXPECT(GetGuiElementAlpha(&container, top) == 1);
+    BeginHeadlessFrame();
+    UpdateGuiContainer(&container);
+    EXPECT(TestDrawHash(&container) == opaque);
+
+    // Restarting a fade restarts its tween, wherever the tweens that finished before it moved it to in the pool.
+    FadeGuiElement(&container, bottom, 0, 0.1f);
+    FadeGuiElement(&container, top, 0, 1);
+    SetHeadlessFrameTime(0.2f);
+    BeginHeadlessFrame();
+    UpdateGuiContainer(&container);
+    EXPECT(container.animation->tweenCount == 1 && container.animation->tweens[0].slot == top.index);
+    FadeGuiElement(&container, top, 1, 0.5f);
+    FadeGuiElement(&container, bottom, 1, 0.5f);
+    EXPECT(container.animation->tweenCount == 2);
+    SetHeadlessFrameTime(1.0f);
+    BeginHeadlessFrame();
+    UpdateGuiContainer(&container);
+    SetHeadlessFrameTime(1.0f / 60.0f);
+    EXPECT(!IsGuiContainerAnimating(&container));
+    EXPECT(GetGuiElementAlpha(&container, top) == 1 && GetGuiElementAlpha(&container, bottom) == 1);
+
+    // Removing an element stops its tweens, and those of the elements nested in it, and its handle index is opaque again.
+    FadeGuiElement(&container, top, 0, 1);
+    FadeGuiElement(panel, nested, 0, 1);
+    RemoveGuiElement(&container, GetGuiContainerElement(panel));
+    EXPECT(container.animation->tweenCount == 1);
+    RemoveGuiElement(&container, top);
+    EXPECT(container.animation->tweenCount == 0);
+    GuiElement added = AddGuiButton(&container, (Rectangle){ 20, 20, 200, 20 }, "Added");
+    EXPECT(added.index == top.index && GetGuiElementAlpha(&container, added) == 1);
+
+    // Disabling animation drops the focus highlight, but lets fades carry on.
+    FadeGuiElement(&container, added, 0, 1);
+    TestPressKey(&container, KEY_UP);
+    DisableGuiContainerAnimation(&container);
+    EXPECT(container.animation->tweenCount == 1 && !container.animation->focusShown);
+    UnloadGuiContainer(container);
+    EXPECT(headless.liveBlocks == liveBlocks);
+}
+
+static void TestAnimationDrawCacheMatchesImmediate(void) {
+    // Fades change what the draw cache recorded, so faded elements are recorded again.
+    GuiContainer immediate = InitGuiContainer();
+    GuiContainer retained = InitGuiContainer();
+    EnableGuiContainerDrawCache(&retained);
+    GuiContainer* containers[2] = { &immediate, &retained };
+    GuiElement elements[2][20];
+    for (int i = 0; i < 2; i++) {
+        EnableGuiContainerAnimation(containers[i]);
+        for (int j = 0; j < 20; j++) {
+            elements[i][j] = AddGuiButton(containers[i], (Rectangle){ (float)(j % 5) * 110, (float)(j / 5) * 40, 100, 30 }, "Button");
+        }
+    }
+
+    int keys[] = { KEY_UP, KEY_RIGHT, KEY_DOWN, KEY_LEFT, KEY_ENTER };
+    for (int frame = 0; frame < 200; frame++) {
+        BeginHeadlessFrame();
+        SetHeadlessKeyPressed(keys[TestRandom(5)]);
+        int faded = TestRandom(20);
+        float alpha = (float)TestRandom(5) / 4.0f;
+        for (int i = 0; i < 2; i++) {
+            if (frame % 10 == 0) {
+                FadeGuiElement(containers[i], elements[i][faded], alpha, 0.1f);
+            }
+            UpdateGuiContainer(containers[i]);
+        }
+        unsigned int immediateHash = TestDrawHash(&immediate);
+        EXPECT(TestDrawHash(&retained) == immediateHash);
+    }
+
+    UnloadGuiContainer(immediate);
+    UnloadGuiContainer(retained);
+}
+
+#define TEST_RECORDED_FRAMES 120
+
+/**
+ * The state a replay has to reproduce after each frame.
+ */
+typedef struct TestFrameState {
+    int activeElement;
+    bool focusLocked;
+    int active[4];
+    float value;
+    char text[16];
+    unsigned int drawHash;
+} TestFrameState;
+
+/**
+ * Script a frame of typing, key presses, mouse movement and gamepad input, with the frame time varying.
+ */
+static void TestScriptFrame(int frame) {
+    BeginHeadlessFrame();
+    SetHeadlessFrameTime(frame % 7 == 0 ? 1.0f / 30.0f : 1.0f / 60.0f);
+    SetHeadlessKeyDown(KEY_DOWN, frame == 2);
+    SetHeadlessKeyDown(KEY_ENTER, frame == 10 || frame == 45 || frame == 70);
+    SetHeadlessKeyDown(KEY_LEFT, frame >= 15 && frame < 40);
+    if (frame >= 50 && frame < 60) {
+        SetHeadlessMousePosition((Vector2){ 30.0f + (float)frame, 150 });
+    }
+    if (frame == 61) {
+        SetHeadlessMousePosition((Vector2){ 40.5f, 150.25f });
+    }
+    if (frame == 62) {
+        SetHeadlessMouseButtonDown(MOUSE_BUTTON_LEFT);
+    }
+    if (frame == 63) {
+        SetHeadlessMouseButtonReleased(MOUSE_BUTTON_LEFT);
+    }
+    if (frame == 65) {
+        SetHeadlessCharPressed("hi\xc3\xa9");
+    }
+    if (frame == 75) {
+        SetHeadlessMousePosition((Vector2){ 40, 320 });
+    }
+    if (frame == 76) {
+        SetHeadlessMouseWheel(1);
+    }
+    SetHeadlessGamepadAxis(0, GAMEPAD_AXIS_RIGHT_X, frame >= 80 && frame < 90 ? 0.5f + (float)(frame - 80) * 0.05f : 0);
+}
+
+static GuiElement TestAddRecordedControls(GuiContainer* container, GuiElement* elements) {
+    TestAddControls(container, elements);
+    return AddSlider(container, (Rectangle){ 20, 310, 200, 20 }, "Less", "More", 50, 0, 100);
+}
+
+static TestFrameState TestGetFrameState(GuiContainer* container, GuiElement* elements, GuiElement slider) {
+    TestFrameState state;
+    memset(&state, 0, sizeof(state));
+    state.activeElement = container->activeElement;
+    state.focusLocked = container->focusLocked;
+    for (int i = 0; i < 4; i++) {
+        state.active[i] = GetGuiElementActive(container, elements[i]);
+    }
+    state.value = GetGuiSliderValue(container, slider);
+    strncpy(state.text, GetGuiTextBoxText(container, elements[4]), sizeof(state.text) - 1);
+    state.drawHash = TestDrawHash(container);
+    return state;
+}
+
+static void TestInputRecording(void) {
+    long liveBlocks = headless.liveBlocks;
+    static TestFrameState recorded[TEST_RECORDED_FRAMES];
+    GuiElement elements[7];
+
+    // Record a scripted session, drawing after each update.
+    GuiContainer container = InitGuiContainer();
+    GuiElement slider = TestAddRecordedControls(&container, elements);
+    EXPECT(StartGuiInputRecording(&container, "raygui-container-test.rgir"));
+    for (int frame = 0; frame < TEST_RECORDED_FRAMES; frame++) {
+        TestScriptFrame(frame);
+        UpdateGuiContainer(&container);
+        recorded[frame] = TestGetFrameState(&container, elements, slider);
+    }
+    StopGuiInputRecording(&container);
+    UnloadGuiContainer(container);
+    SetHeadlessFrameTime(1.0f / 60.0f);
+    EXPECT(recorded[30].active[1] != recorded[0].active[1]);
+    EXPECT(strcmp(recorded[TEST_RECORDED_FRAMES - 1].text, recorded[0].text) != 0);
+    EXPECT(recorded[TEST_RECORDED_FRAMES - 1].value != 50);
+
+    // The same controls replayed without any input go through the same states, and draw the same.
+    container = InitGuiContainer();
+    slider = TestAddRecordedControls(&container, elements);
+    EXPECT(StartGuiInputReplay(&container, "raygui-container-test.rgir"));
+    int matched = 0;
+    for (int frame = 0; frame < TEST_RECORDED_FRAMES; frame++) {
+        BeginHeadlessFrame();
+        EXPECT(IsGuiInputReplaying(&container));
+        UpdateGuiContainer(&container);
+        SetHeadlessInputFrame(GetGuiInputFrame(&container));
+        TestFrameState state = TestGetFrameState(&container, elements, slider);
+        matched += memcmp(&state, recorded + frame, sizeof(state)) == 0;
+    }
+    EXPECT(matched == TEST_RECORDED_FRAMES);
+    EXPECT(GetGuiInputReplayMismatch(&container) == -1);
+    BeginHeadlessFrame();
+    UpdateGuiContainer(&container);
+    EXPECT(!IsGuiInputReplaying(&container));
+
+    // Replaying into a different layout is caught by the draw hash.
+    UnloadGuiContainer(container);
+    container = InitGuiContainer();
+    slider = TestAddRecordedControls(&container, elements);
+    SetGuiElementText(&container, slider, "Fewer");
+    EXPECT(StartGuiInputReplay(&container, "raygui-container-test.rgir"));
+    for (int frame = 0; frame < TEST_RECORDED_FRAMES; frame++) {
+        BeginHeadlessFrame();
+        UpdateGuiContainer(&container);
+        SetHeadlessInputFrame(GetGuiInputFrame(&container));
+        TestDrawHash(&container);
+    }
+    EXPECT(GetGuiInputReplayMismatch(&container) == 0);
+    UnloadGuiContainer(container);
+
+    // A session where nothing happens takes a few bytes, however long it is.
+    container = InitGuiContainer();
+    TestAddRecordedControls(&container, elements);
+    EXPECT(StartGuiInputRecording(&container, "raygui-container-test.rgir"));
+    for (int frame = 0; frame < 1000; frame++) {
+        BeginHeadlessFrame();
+        UpdateGuiContainer(&container);
+        TestDrawHash(&container);
+    }
+    long bindingSize = container.input->bindingCount * (long)sizeof(GuiInputBinding);
+    UnloadGuiContainer(container);
+    FILE* file = fopen("raygui-container-test.rgir", "rb");
+    EXPECT(file != NULL);
+    if (file != NULL) {
+        fseek(file, 0, SEEK_END);
+        long size = ftell(file) - (long)sizeof(GuiRecordingHeader) - bindingSize;
+        EXPECT(size <= 32);
+        fclose(file);
+    }
+
+    remove("raygui-container-test.rgir");
+    EXPECT(headless.liveBlocks == liveBlocks);
+}
+
+static void TestNoLeaks(void) {
+    long liveBlocks = headless.liveBlocks;
+    GuiContainer container = InitGuiContainer();
+    EnableGuiContainerDrawCache(&container);
+    for (int i = 0; i < 1000; i++) {
+        AddGuiButton(&container, TestRandomRectangle(1000, 50), "Button");
+    }
+
+    // Nested containers are freed with their group, or with the root container.
+    GuiContainer* removed = AddGuiScrollPanel(&container, (Rectangle){ 0, 0, 200, 200 }, "Removed", (Rectangle){ 0, 0, 200, 400 });
+    GuiContainer* kept = AddGuiPanel(AddGuiWindowBox(&container, (Rectangle){ 0, 0, 200, 200 }, "Kept"), (Rectangle){ 0, 0, 100, 100 }, NULL);
+    for (int i = 0; i < 100; i++) {
+        AddGuiButton(removed, TestRandomRectangle(200, 50), "Button");
+        AddGuiButton(kept, TestRandomRectangle(100, 50), "Button");
+    }
+
+    // So are list views and text boxes.
+    int rowCount = 1000;
+    GuiElement list = AddGuiListView(kept, (Rectangle){ 0, 0, 100, 100 }, TestGetRowCount, TestGetRowText, &rowCount);
+    AddGuiListView(&container, (Rectangle){ 0, 0, 100, 100 }, TestGetRowCount, TestGetRowText, &rowCount);
+    GuiElement textBox = AddGuiTextBox(kept, (Rectangle){ 0, 0, 100, 20 }, "Removed", 32);
+    AddGuiTextBox(&container, (Rectangle){ 0, 0, 100, 20 }, "Kept", 32);
+    DrawGuiContainer(container);
+    RemoveGuiElement(kept, list);
+    RemoveGuiElement(kept, textBox);
+    RemoveGuiElement(&container, GetGuiContainerElement(removed));
+    DrawGuiContainer(container);
+    UnloadGuiContainer(container);
+
+    EXPECT(headless.liveBlocks == liveBlocks);
+}
+
+int main(void) {
+    struct {
+        const char* name;
+        void (*run)(void);
+    } tests[] = {
+        { "SpatialIndexMatchesLinear", TestSpatialIndexMatchesLinear },
+        { "NavigationGraph", TestNavigationGraph },
+        { "NavigationGraphGrid", TestNavigationGraphGrid },
+        { "NavigationDump", TestNavigationDump },
+        { "HitTestMatchesScalar", TestHitTestMatchesScalar },
+        { "Handles", TestHandles },
+        { "KeyboardNavigation", TestKeyboardNavigation },
+        { "Slider", TestSlider },
+        { "TimedAdjustment", TestTimedAdjustment },
+        { "Controls", TestControls },
+        { "ChoiceDrawing", TestChoiceDrawing },
+        { "Gamepads", TestGamepads },
+        { "Bindings", TestBindings },
+        { "MouseHover", TestMouseHover },
+        { "DrawCacheMatchesImmediate", TestDrawCacheMatchesImmediate },
+        { "ControlsDrawCacheMatchesImmediate", TestControlsDrawCacheMatchesImmediate },
+        { "DrawCacheAllocations", TestDrawCacheAllocations },
+        { "NestedNavigation", TestNestedNavigation },
+        { "NestedMouseHover", TestNestedMouseHover },
+        { "ScrollPanelCulling", TestScrollPanelCulling },
+        { "NestedDrawCacheMatchesImmediate", TestNestedDrawCacheMatchesImmediate },
+        { "ListViewNavigation", TestListViewNavigation },
+        { "ListViewMouse", TestListViewMouse },
+        { "ListViewDrawing", TestListViewDrawing },
+        { "InputSources", TestInputSources },
+        { "ContainerStyles", TestContainerStyles },
+        { "ElementText", TestElementText },
+        { "Layout", TestLayout },
+        { "ContainerFile", TestContainerFile },
+        { "ContainerFileCorrupted", TestContainerFileCorrupted },
+        { "Events", TestEvents },
+        { "Profile", TestProfile },
+        { "InputRecording", TestInputRecording },
+        { "Animation", TestAnimation },
+        { "AnimationDrawCacheMatchesImmediate", TestAnimationDrawCacheMatchesImmediate },
+#if defined(RAYGUI_CONTAINER_TEST_THREADS)
+        { "ThreadedUpdates", TestThreadedUpdates },
+#endif
+        { "NoLeaks", TestNoLeaks },
+    };
+
+    for (int i = 0; i < (int)(sizeof(tests) / sizeof(tests[0])); i++) {
+        int failures = testFailures;
+        tests[i].run();
+        printf("%s %s\n", testFailures == failures ? "[PASS]" : "[FAIL]", tests[i].name);
+    }
+
+    return testFailures == 0 ? 0 : 1;
+}
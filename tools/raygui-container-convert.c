@@ -0,0 +1,44 @@
+/**
+ * raygui-container-convert
+ *
+ * Converts a container between the text format, which is written by hand, and the binary format, which is loaded
+ * without building the container element by element. The navigation between the elements is computed when the binary
+ * file is written.
+ *
+ * Usage:
+ *   raygui-container-convert <input> <output>
+ *
+ * Files ending in .rgc are read and written in the binary format, and any other files in the text format.
+ */
+
+#include "raygui-container-standalone.h"
+
+static bool IsBinaryFileName(const char* fileName) {
+    size_t length = strlen(fileName);
+    return length >= 4 && strcmp(fileName + length - 4, ".rgc") == 0;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        printf("Usage: %s <input> <output>\n", argv[0]);
+        return 1;
+    }
+
+    GuiContainer container = IsBinaryFileName(argv[1]) ? LoadGuiContainer(argv[1]) : LoadGuiContainerText(argv[1]);
+    if (container.count == 0) {
+        printf("No elements loaded from %s\n", argv[1]);
+        UnloadGuiContainer(container);
+        return 1;
+    }
+
+    bool exported = IsBinaryFileName(argv[2]) ? ExportGuiContainer(&container, argv[2]) : ExportGuiContainerText(&container, argv[2]);
+    if (!exported) {
+        printf("Failed to write %s\n", argv[2]);
+    }
+    else {
+        printf("Converted %d elements from %s to %s\n", container.count, argv[1], argv[2]);
+    }
+
+    UnloadGuiContainer(container);
+    return exported ? 0 : 1;
+}
@@ -0,0 +1,117 @@
+/**
+ * raygui-container-standalone
+ *
+ * Compiles raygui in RAYGUI_STANDALONE mode, along with raygui-container, against a backend without input or drawing,
+ * for tools that load, change and save containers without a window. Text is measured as if every glyph were half as
+ * wide as it is tall.
+ *
+ * Include this from a single source file, instead of raylib.h, raygui.h and raygui-container.h.
+ */
+
+#ifndef RAYGUI_CONTAINER_STANDALONE_H_
+#define RAYGUI_CONTAINER_STANDALONE_H_
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#define RAYGUI_STANDALONE
+
+// raygui 3.2 uses a few raylib definitions even in standalone mode.
+typedef struct Image {
+    void *data;
+    int width;
+    int height;
+    int mipmaps;
+    int format;
+} Image;
+#define BLANK (Color){ 0, 0, 0, 0 }
+#define KEY_LEFT_CONTROL 341
+#define KEY_RIGHT_SHIFT 344
+
+// GuiTextBoxMulti() reads raylib's Font.glyphs, which raygui's standalone Font names chars.
+#define glyphs chars
+
+#include "raygui.h"
+
+// raylib functions raygui calls without declaring them in standalone mode.
+static int GetGlyphIndex(Font font, int codepoint);
+static void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint);
+static void UnloadTexture(Texture2D texture);
+
+#define RAYGUI_IMPLEMENTATION
+#include "raygui.h"
+
+// raylib definitions used by raygui-container.
+#define KEY_TAB 258
+#define KEY_SPACE 32
+#define KEY_S 83
+#define KEY_LEFT_SHIFT 340
+#define MOUSE_BUTTON_LEFT 0
+#define GAMEPAD_BUTTON_LEFT_FACE_UP 1
+#define GAMEPAD_BUTTON_LEFT_FACE_RIGHT 2
+#define GAMEPAD_BUTTON_LEFT_FACE_DOWN 3
+#define GAMEPAD_BUTTON_LEFT_FACE_LEFT 4
+#define GAMEPAD_BUTTON_RIGHT_FACE_DOWN 7
+#define GAMEPAD_BUTTON_LEFT_TRIGGER_1 9
+#define GAMEPAD_BUTTON_LEFT_TRIGGER_2 10
+#define GAMEPAD_BUTTON_RIGHT_TRIGGER_1 11
+#define GAMEPAD_BUTTON_RIGHT_TRIGGER_2 12
+#define GAMEPAD_AXIS_LEFT_X 0
+#define GAMEPAD_AXIS_LEFT_Y 1
+#define GAMEPAD_AXIS_RIGHT_X 2
+#define GAMEPAD_AXIS_RIGHT_Y 3
+
+// Memory
+//-------------------------------------------------------------------------------
+static void *MemAlloc(unsigned int size) { return calloc(size, 1); }
+static void *MemRealloc(void *ptr, unsigned int size) { return realloc(ptr, size); }
+static void MemFree(void *ptr) { free(ptr); }
+
+// Input
+//-------------------------------------------------------------------------------
+static Vector2 GetMousePosition(void) { return (Vector2){ 0, 0 }; }
+static Vector2 GetMouseDelta(void) { return (Vector2){ 0, 0 }; }
+static float GetMouseWheelMove(void) { return 0; }
+static bool IsMouseButtonDown(int button) { (void)button; return false; }
+static bool IsMouseButtonPressed(int button) { (void)button; return false; }
+static bool IsMouseButtonReleased(int button) { (void)button; return false; }
+static bool IsKeyDown(int key) { (void)key; return false; }
+static bool IsKeyPressed(int key) { (void)key; return false; }
+static bool IsGamepadAvailable(int gamepad) { (void)gamepad; return false; }
+static bool IsGamepadButtonPressed(int gamepad, int button) { (void)gamepad; (void)button; return false; }
+static bool IsGamepadButtonDown(int gamepad, int button) { (void)gamepad; (void)button; return false; }
+static float GetGamepadAxisMovement(int gamepad, int axis) { (void)gamepad; (void)axis; return 0; }
+static float GetFrameTime(void) { return 1.0f / 60.0f; }
+static int GetCharPressed(void) { return 0; }
+
+// Drawing
+//-------------------------------------------------------------------------------
+static void DrawRectangle(int x, int y, int width, int height, Color color) { (void)x; (void)y; (void)width; (void)height; (void)color; }
+static void DrawRectangleGradientEx(Rectangle rec, Color col1, Color col2, Color col3, Color col4) { (void)rec; (void)col1; (void)col2; (void)col3; (void)col4; }
+static void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint) { (void)font; (void)text; (void)position; (void)fontSize; (void)spacing; (void)tint; }
+static void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint) { (void)font; (void)codepoint; (void)position; (void)fontSize; (void)tint; }
+static void BeginScissorMode(int x, int y, int width, int height) { (void)x; (void)y; (void)width; (void)height; }
+static void EndScissorMode(void) { }
+
+// Text
+//-------------------------------------------------------------------------------
+static Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing) {
+    (void)font;
+    int length = (int)strlen(text);
+    return (Vector2){ length * fontSize / 2 + (length > 0 ? (length - 1) * spacing : 0), fontSize };
+}
+
+static int GetGlyphIndex(Font font, int codepoint) { (void)font; (void)codepoint; return 0; }
+static Font GetFontDefault(void) { Font font = { 0 }; font.baseSize = 10; return font; }
+static Font LoadFontEx(const char *fileName, int fontSize, int *fontChars, int glyphCount) { (void)fileName; (void)fontSize; (void)fontChars; (void)glyphCount; return GetFontDefault(); }
+static inline Texture2D LoadTextureFromImage(Image image) { (void)image; Texture2D texture = { 0 }; return texture; }
+static void UnloadTexture(Texture2D texture) { (void)texture; }
+static inline void SetShapesTexture(Texture2D texture, Rectangle source) { (void)texture; (void)source; }
+static char *LoadFileText(const char *fileName) { (void)fileName; return NULL; }
+static const char *GetDirectoryPath(const char *filePath) { (void)filePath; return ""; }
+
+#define RAYGUI_CONTAINER_IMPLEMENTATION
+#include "raygui-container.h"
+
+#endif  // RAYGUI_CONTAINER_STANDALONE_H_